@@ -0,0 +1,554 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_AABB_TREE_H_
+#define _H_AABB_TREE_H_
+
+#include <ray/aabb.h>
+#include <ray/frustum.h>
+#include <ray/raycast.h>
+
+_NAME_BEGIN
+
+template<typename _Ty>
+struct AABBTreeNode
+{
+	AABB aabb;
+
+	_Ty data;
+
+	std::int32_t parent;
+	std::int32_t left;
+	std::int32_t right;
+	std::int32_t height;
+
+	bool isLeaf() const noexcept
+	{
+		return left == -1;
+	}
+};
+
+// Dynamic bounding volume hierarchy with fattened leaves, the leaves only reinsert
+// when the object leaves its fat box, so small motions are nearly free.
+template<typename _Ty>
+class AABBTree final
+{
+public:
+	typedef std::int32_t proxy_type;
+	typedef AABBTreeNode<_Ty> node_type;
+
+	enum { nullnode = -1 };
+	enum { stacksize = 256 };
+
+public:
+	AABBTree(float margin = 0.1f) noexcept
+		: _root(nullnode)
+		, _freeList(nullnode)
+		, _proxyCount(0)
+		, _margin(margin)
+	{
+	}
+
+	~AABBTree() noexcept
+	{
+	}
+
+	void setMargin(float margin) noexcept
+	{
+		_margin = margin;
+	}
+
+	float getMargin() const noexcept
+	{
+		return _margin;
+	}
+
+	proxy_type createProxy(const AABB& aabb, const _Ty& data) noexcept
+	{
+		proxy_type proxy = this->allocateNode();
+
+		Vector3 margin(_margin, _margin, _margin);
+		_nodes[proxy].aabb.min = aabb.min - margin;
+		_nodes[proxy].aabb.max = aabb.max + margin;
+		_nodes[proxy].data = data;
+		_nodes[proxy].height = 0;
+
+		this->insertLeaf(proxy);
+
+		_proxyCount++;
+
+		return proxy;
+	}
+
+	void destroyProxy(proxy_type proxy) noexcept
+	{
+		assert(proxy >= 0 && proxy < (proxy_type)_nodes.size());
+		assert(_nodes[proxy].isLeaf());
+
+		this->removeLeaf(proxy);
+		this->freeNode(proxy);
+
+		_proxyCount--;
+	}
+
+	bool moveProxy(proxy_type proxy, const AABB& aabb) noexcept
+	{
+		assert(proxy >= 0 && proxy < (proxy_type)_nodes.size());
+		assert(_nodes[proxy].isLeaf());
+
+		const AABB& fat = _nodes[proxy].aabb;
+		if (fat.min.x <= aabb.min.x && fat.min.y <= aabb.min.y && fat.min.z <= aabb.min.z &&
+			fat.max.x >= aabb.max.x && fat.max.y >= aabb.max.y && fat.max.z >= aabb.max.z)
+		{
+			return false;
+		}
+
+		this->removeLeaf(proxy);
+
+		Vector3 margin(_margin, _margin, _margin);
+		_nodes[proxy].aabb.min = aabb.min - margin;
+		_nodes[proxy].aabb.max = aabb.max + margin;
+
+		this->insertLeaf(proxy);
+
+		return true;
+	}
+
+	const _Ty& getUserData(proxy_type proxy) const noexcept
+	{
+		assert(proxy >= 0 && proxy < (proxy_type)_nodes.size());
+		return _nodes[proxy].data;
+	}
+
+	const AABB& getFatAABB(proxy_type proxy) const noexcept
+	{
+		assert(proxy >= 0 && proxy < (proxy_type)_nodes.size());
+		return _nodes[proxy].aabb;
+	}
+
+	std::size_t size() const noexcept
+	{
+		return _proxyCount;
+	}
+
+	bool empty() const noexcept
+	{
+		return _proxyCount == 0;
+	}
+
+	std::int32_t height() const noexcept
+	{
+		return _root == nullnode ? 0 : _nodes[_root].height;
+	}
+
+	void clear() noexcept
+	{
+		_nodes.clear();
+		_root = nullnode;
+		_freeList = nullnode;
+		_proxyCount = 0;
+	}
+
+	template<typename Function>
+	void query(const AABB& aabb, Function callback) const noexcept
+	{
+		this->traverse([&](const AABB& box) { return this->overlap(box, aabb); }, callback);
+	}
+
+	template<typename Function>
+	void query(const Frustum& fru, Function callback) const noexcept
+	{
+		this->traverse([&](const AABB& box) { return fru.contains(box); }, callback);
+	}
+
+	template<typename Function>
+	void query(const Vector3& center, float radius, Function callback) const noexcept
+	{
+		float radiusSqrt = radius * radius;
+		this->traverse([&](const AABB& box) { return this->distanceSqrt(box, center) <= radiusSqrt; }, callback);
+	}
+
+	template<typename Function>
+	void query(const Raycast3& ray, float maxDistance, Function callback) const noexcept
+	{
+		Vector3 invDir;
+		invDir.x = ray.normal.x != 0.0f ? 1.0f / ray.normal.x : BIG_NUMBER;
+		invDir.y = ray.normal.y != 0.0f ? 1.0f / ray.normal.y : BIG_NUMBER;
+		invDir.z = ray.normal.z != 0.0f ? 1.0f / ray.normal.z : BIG_NUMBER;
+
+		this->traverse([&](const AABB& box) { return this->slab(box, ray.origin, invDir, maxDistance); }, callback);
+	}
+
+	// The callback returns the distance the ray is clipped to, so a closest hit query stops
+	// descending into nodes that lie behind the nearest hit found so far.
+	template<typename Function>
+	void raycast(const Raycast3& ray, float maxDistance, Function callback) const noexcept
+	{
+		if (_root == nullnode)
+			return;
+
+		Vector3 invDir;
+		invDir.x = ray.normal.x != 0.0f ? 1.0f / ray.normal.x : BIG_NUMBER;
+		invDir.y = ray.normal.y != 0.0f ? 1.0f / ray.normal.y : BIG_NUMBER;
+		invDir.z = ray.normal.z != 0.0f ? 1.0f / ray.normal.z : BIG_NUMBER;
+
+		proxy_type stack[stacksize];
+		std::size_t count = 0;
+
+		stack[count++] = _root;
+
+		while (count > 0)
+		{
+			const node_type& node = _nodes[stack[--count]];
+			if (!this->slab(node.aabb, ray.origin, invDir, maxDistance))
+				continue;
+
+			if (node.isLeaf())
+			{
+				maxDistance = std::min(maxDistance, callback(node.data, maxDistance));
+			}
+			else
+			{
+				assert(count + 2 <= stacksize);
+				stack[count++] = node.left;
+				stack[count++] = node.right;
+			}
+		}
+	}
+
+private:
+	template<typename Test, typename Function>
+	void traverse(Test test, Function callback) const noexcept
+	{
+		if (_root == nullnode)
+			return;
+
+		proxy_type stack[stacksize];
+		std::size_t count = 0;
+
+		stack[count++] = _root;
+
+		while (count > 0)
+		{
+			const node_type& node = _nodes[stack[--count]];
+			if (!test(node.aabb))
+				continue;
+
+			if (node.isLeaf())
+			{
+				callback(node.data);
+			}
+			else
+			{
+				assert(count + 2 <= stacksize);
+				stack[count++] = node.left;
+				stack[count++] = node.right;
+			}
+		}
+	}
+
+	static bool overlap(const AABB& a, const AABB& b) noexcept
+	{
+		if (a.max.x < b.min.x || a.min.x > b.max.x) return false;
+		if (a.max.y < b.min.y || a.min.y > b.max.y) return false;
+		if (a.max.z < b.min.z || a.min.z > b.max.z) return false;
+		return true;
+	}
+
+	static float distanceSqrt(const AABB& box, const Vector3& pt) noexcept
+	{
+		float d = 0.0f;
+		for (std::uint8_t i = 0; i < 3; i++)
+		{
+			if (pt[i] < box.min[i]) d += (box.min[i] - pt[i]) * (box.min[i] - pt[i]);
+			else if (pt[i] > box.max[i]) d += (pt[i] - box.max[i]) * (pt[i] - box.max[i]);
+		}
+
+		return d;
+	}
+
+	static bool slab(const AABB& box, const Vector3& origin, const Vector3& invDir, float maxDistance) noexcept
+	{
+		float tmin = 0.0f;
+		float tmax = maxDistance;
+
+		for (std::uint8_t i = 0; i < 3; i++)
+		{
+			float t1 = (box.min[i] - origin[i]) * invDir[i];
+			float t2 = (box.max[i] - origin[i]) * invDir[i];
+
+			tmin = std::max(tmin, std::min(t1, t2));
+			tmax = std::min(tmax, std::max(t1, t2));
+		}
+
+		return tmin <= tmax;
+	}
+
+	static float perimeter(const AABB& box) noexcept
+	{
+		Vector3 d = box.max - box.min;
+		return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+	}
+
+	static AABB combine(const AABB& a, const AABB& b) noexcept
+	{
+		AABB result;
+		result.min = math::min(a.min, b.min);
+		result.max = math::max(a.max, b.max);
+		return result;
+	}
+
+	proxy_type allocateNode() noexcept
+	{
+		proxy_type proxy;
+
+		if (_freeList != nullnode)
+		{
+			proxy = _freeList;
+			_freeList = _nodes[proxy].parent;
+		}
+		else
+		{
+			proxy = (proxy_type)_nodes.size();
+			_nodes.emplace_back();
+		}
+
+		_nodes[proxy].parent = nullnode;
+		_nodes[proxy].left = nullnode;
+		_nodes[proxy].right = nullnode;
+		_nodes[proxy].height = 0;
+
+		return proxy;
+	}
+
+	void freeNode(proxy_type proxy) noexcept
+	{
+		_nodes[proxy].data = _Ty();
+		_nodes[proxy].parent = _freeList;
+		_nodes[proxy].height = -1;
+		_freeList = proxy;
+	}
+
+	void insertLeaf(proxy_type leaf) noexcept
+	{
+		if (_root == nullnode)
+		{
+			_root = leaf;
+			_nodes[_root].parent = nullnode;
+			return;
+		}
+
+		AABB leafAABB = _nodes[leaf].aabb;
+
+		proxy_type index = _root;
+		while (!_nodes[index].isLeaf())
+		{
+			proxy_type left = _nodes[index].left;
+			proxy_type right = _nodes[index].right;
+
+			float area = perimeter(_nodes[index].aabb);
+			float combinedArea = perimeter(combine(_nodes[index].aabb, leafAABB));
+
+			float cost = 2.0f * combinedArea;
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			float costLeft = perimeter(combine(leafAABB, _nodes[left].aabb)) + inheritanceCost;
+			if (!_nodes[left].isLeaf())
+				costLeft -= perimeter(_nodes[left].aabb);
+
+			float costRight = perimeter(combine(leafAABB, _nodes[right].aabb)) + inheritanceCost;
+			if (!_nodes[right].isLeaf())
+				costRight -= perimeter(_nodes[right].aabb);
+
+			if (cost < costLeft && cost < costRight)
+				break;
+
+			index = costLeft < costRight ? left : right;
+		}
+
+		proxy_type sibling = index;
+		proxy_type oldParent = _nodes[sibling].parent;
+		proxy_type newParent = this->allocateNode();
+
+		_nodes[newParent].parent = oldParent;
+		_nodes[newParent].aabb = combine(leafAABB, _nodes[sibling].aabb);
+		_nodes[newParent].height = _nodes[sibling].height + 1;
+		_nodes[newParent].left = sibling;
+		_nodes[newParent].right = leaf;
+		_nodes[sibling].parent = newParent;
+		_nodes[leaf].parent = newParent;
+
+		if (oldParent != nullnode)
+		{
+			if (_nodes[oldParent].left == sibling)
+				_nodes[oldParent].left = newParent;
+			else
+				_nodes[oldParent].right = newParent;
+		}
+		else
+		{
+			_root = newParent;
+		}
+
+		this->refit(_nodes[leaf].parent);
+	}
+
+	void removeLeaf(proxy_type leaf) noexcept
+	{
+		if (leaf == _root)
+		{
+			_root = nullnode;
+			return;
+		}
+
+		proxy_type parent = _nodes[leaf].parent;
+		proxy_type grandParent = _nodes[parent].parent;
+		proxy_type sibling = _nodes[parent].left == leaf ? _nodes[parent].right : _nodes[parent].left;
+
+		if (grandParent != nullnode)
+		{
+			if (_nodes[grandParent].left == parent)
+				_nodes[grandParent].left = sibling;
+			else
+				_nodes[grandParent].right = sibling;
+
+			_nodes[sibling].parent = grandParent;
+			this->freeNode(parent);
+			this->refit(grandParent);
+		}
+		else
+		{
+			_root = sibling;
+			_nodes[sibling].parent = nullnode;
+			this->freeNode(parent);
+		}
+	}
+
+	void refit(proxy_type index) noexcept
+	{
+		while (index != nullnode)
+		{
+			index = this->balance(index);
+
+			proxy_type left = _nodes[index].left;
+			proxy_type right = _nodes[index].right;
+
+			_nodes[index].height = 1 + std::max(_nodes[left].height, _nodes[right].height);
+			_nodes[index].aabb = combine(_nodes[left].aabb, _nodes[right].aabb);
+
+			index = _nodes[index].parent;
+		}
+	}
+
+	proxy_type balance(proxy_type a) noexcept
+	{
+		node_type* A = &_nodes[a];
+		if (A->isLeaf() || A->height < 2)
+			return a;
+
+		proxy_type b = A->left;
+		proxy_type c = A->right;
+
+		std::int32_t diff = _nodes[c].height - _nodes[b].height;
+		if (diff > 1)
+			return this->rotate(a, c, b, true);
+		if (diff < -1)
+			return this->rotate(a, b, c, false);
+
+		return a;
+	}
+
+	proxy_type rotate(proxy_type a, proxy_type up, proxy_type other, bool upIsRight) noexcept
+	{
+		node_type* A = &_nodes[a];
+		node_type* U = &_nodes[up];
+
+		proxy_type f = U->left;
+		proxy_type g = U->right;
+
+		U->left = a;
+		U->parent = A->parent;
+		A->parent = up;
+
+		if (U->parent != nullnode)
+		{
+			if (_nodes[U->parent].left == a)
+				_nodes[U->parent].left = up;
+			else
+				_nodes[U->parent].right = up;
+		}
+		else
+		{
+			_root = up;
+		}
+
+		proxy_type keep = f;
+		proxy_type move = g;
+		if (_nodes[f].height <= _nodes[g].height)
+			std::swap(keep, move);
+
+		U->right = keep;
+
+		if (upIsRight)
+			A->right = move;
+		else
+			A->left = move;
+
+		_nodes[move].parent = a;
+
+		A->aabb = combine(_nodes[other].aabb, _nodes[move].aabb);
+		A->height = 1 + std::max(_nodes[other].height, _nodes[move].height);
+
+		U->aabb = combine(A->aabb, _nodes[keep].aabb);
+		U->height = 1 + std::max(A->height, _nodes[keep].height);
+
+		return up;
+	}
+
+private:
+	std::vector<node_type> _nodes;
+
+	proxy_type _root;
+	proxy_type _freeList;
+
+	std::size_t _proxyCount;
+
+	float _margin;
+};
+
+_NAME_END
+
+#endif
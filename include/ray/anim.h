@@ -37,7 +37,8 @@
 #ifndef _H_ANIM_H_
 #define _H_ANIM_H_
 
-#include <ray/bone.h>
+#include <ray/anim_pose.h>
+#include <ray/anim_clip.h>
 
 _NAME_BEGIN
 
@@ -55,6 +56,22 @@ struct MotionSegment
 	int m1;
 };
 
+struct MotionKey
+{
+	std::int32_t frame;
+	std::uint32_t curves[4];
+
+	Vector3 position;
+	Quaternion rotation;
+};
+
+struct MotionTrack
+{
+	std::size_t offset;
+	std::size_t count;
+	std::size_t cursor;
+};
+
 class EXPORT BoneAnimation
 {
 public:
@@ -115,6 +132,11 @@ public:
 	void setIKArray(InverseKinematics&& ik) noexcept;
 	const InverseKinematics& getIKArray() const noexcept;
 
+	const AnimationPosePtr& getPose() const noexcept;
+
+	void setClip(const AnimationClipPtr& clip) noexcept;
+	const AnimationClipPtr& getClip() const noexcept;
+
 	void addBoneAnimation(const BoneAnimation& anim) noexcept;
 	BoneAnimation& getBoneAnimation(std::size_t index) noexcept;
 	const BoneAnimation& getBoneAnimation(std::size_t index) const noexcept;
@@ -132,7 +154,7 @@ public:
 	void updateBoneMotion() noexcept;
 	bool updateBoneMotion(std::size_t index) noexcept;
 	void updateBoneMatrix() noexcept;
-	void updateBoneMatrix(Bone& bone) noexcept;
+	void updateBoneMatrix(std::size_t index) noexcept;
 	void updateIK() noexcept;
 
 	MotionSegment findMotionSegment(int frame, const std::vector<std::size_t>& motions) noexcept;
@@ -143,9 +165,13 @@ private:
 	AnimationProperty& operator=(const AnimationProperty&) = delete;
 
 private:
-	void updateIK(Bones& _bones, const IKAttr& ik) noexcept;
+	void updateIK(const IKAttr& ik) noexcept;
 	void updateBones(const Bones& _bones) noexcept;
-	void updateTransform(Bone& bone, const float3& translate, const Quaternion& rotate) noexcept;
+
+	std::uint32_t bakeMotionCurve(const std::uint8_t interp[4], std::map<std::uint32_t, std::uint32_t>& curves) noexcept;
+	float sampleMotionCurve(std::uint32_t curve, float t) const noexcept;
+	std::size_t findMotionKey(MotionTrack& track, std::int32_t frame) noexcept;
+	void sampleMotion(MotionTrack& track, std::int32_t frame, Vector3& position, Quaternion& rotation) noexcept;
 
 private:
 
@@ -159,10 +185,17 @@ private:
 	Bones _bones;
 	InverseKinematics _iks;
 
+	AnimationPosePtr _pose;
+
 	std::vector<BoneAnimation> _boneAnimation;
 	std::vector<MorphAnimation> _morphAnimation;
-	std::vector<std::vector<std::size_t>> _bindAnimation;
-	std::vector<std::vector<std::size_t>> _bindAnimations;
+	std::vector<MotionKey> _motionKeys;
+	std::vector<MotionTrack> _motionTracks;
+	std::vector<float> _motionCurves;
+
+	AnimationClipPtr _clip;
+	std::vector<std::int32_t> _clipTracks;
+	std::vector<std::size_t> _clipCursors;
 };
 
 _NAME_END
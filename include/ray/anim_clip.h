@@ -0,0 +1,117 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_ANIM_CLIP_H_
+#define _H_ANIM_CLIP_H_
+
+#include <ray/modtypes.h>
+
+_NAME_BEGIN
+
+struct MotionClipTrack
+{
+	std::string name;
+
+	std::uint32_t offset;
+	std::uint32_t count;
+	std::uint32_t positionOffset;
+	bool hasPosition;
+
+	float3 minimum;
+	float3 extent;
+};
+
+class EXPORT AnimationClip final
+{
+public:
+	static const std::size_t CurveSamples = 33;
+
+public:
+	AnimationClip() noexcept;
+	~AnimationClip() noexcept;
+
+	bool build(const AnimationProperty& animation, float positionError = 0.005f, float rotationError = 0.001f) noexcept;
+
+	bool load(StreamReader& stream) noexcept;
+	bool save(StreamWrite& stream) const noexcept;
+
+	void setFps(float fps) noexcept;
+	float getFps() const noexcept;
+
+	std::size_t getNumFrames() const noexcept;
+	std::size_t getNumKeys() const noexcept;
+	std::size_t getNumTracks() const noexcept;
+
+	std::int32_t findTrack(const std::string& name) const noexcept;
+	const MotionClipTrack& getTrack(std::size_t index) const noexcept;
+
+	float getDuration() const noexcept;
+	std::size_t getMemoryUsage() const noexcept;
+	float getBytesPerBoneSecond() const noexcept;
+
+	void sample(std::size_t track, std::int32_t frame, std::size_t& cursor, Vector3& position, Quaternion& rotation) const noexcept;
+
+	static void bakeCurve(const std::uint8_t interp[4], float xs[CurveSamples], float ys[CurveSamples]) noexcept;
+	static float sampleCurve(const float xs[CurveSamples], const float ys[CurveSamples], float t) noexcept;
+
+private:
+	void _bakeCurves() noexcept;
+
+	void _decodePosition(const MotionClipTrack& track, std::size_t key, Vector3& position) const noexcept;
+	void _decodeRotation(const MotionClipTrack& track, std::size_t key, Quaternion& rotation) const noexcept;
+
+private:
+	AnimationClip(const AnimationClip&) = delete;
+	AnimationClip& operator=(const AnimationClip&) = delete;
+
+private:
+	float _fps;
+	std::uint32_t _numFrames;
+
+	std::vector<MotionClipTrack> _tracks;
+
+	std::vector<std::uint8_t> _curvePalette;
+	std::vector<float> _curveTables;
+
+	std::vector<std::uint16_t> _frames;
+	std::vector<std::uint16_t> _curves;
+	std::vector<std::uint16_t> _rotations;
+	std::vector<std::uint16_t> _positions;
+};
+
+_NAME_END
+
+#endif
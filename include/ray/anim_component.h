@@ -59,15 +59,28 @@ public:
 	void enablePhysics(bool physics) noexcept;
 	bool enablePhysics() const noexcept;
 
+	void enableTransformSync(bool sync) noexcept;
+	bool enableTransformSync() const noexcept;
+
 	void setTransforms(GameObjects&& transforms) noexcept;
 	void setTransforms(const GameObjects& transforms) noexcept;
 	const GameObjects& getTransforms() const noexcept;
 
+	AnimationPosePtr getPose() const noexcept;
+
+	void syncTransforms() noexcept;
+
+	void addPoseUpdateListener(std::function<void(const AnimationPose&)>* listener) noexcept;
+	void removePoseUpdateListener(std::function<void(const AnimationPose&)>* listener) noexcept;
+
 	GameComponentPtr clone() const noexcept;
 
 private:
 	bool _playAnimation(const util::string& filename) noexcept;
 	void _updateAnimation() noexcept;
+	void _updatePose(float delta) noexcept;
+	void _updateTransforms() noexcept;
+	void _updateTransformSync(bool force) noexcept;
 	void _destroyAnimation() noexcept;
 
 private:
@@ -80,19 +93,26 @@ private:
 	virtual void onMeshChange() noexcept;
 	virtual void onMeshWillRender(const class Camera&) noexcept;
 
-	virtual void onFrameEnd() noexcept;
-
 private:
+	friend class AnimationManager;
+
 	bool _enableAnimation;
 	bool _enableAnimOnVisableOnly;
 	bool _enablePhysics;
 	bool _needUpdate;
+	bool _enableTransformSync;
+	bool _needTransformSync;
+
+	std::size_t _syncVersion;
+	std::size_t _hierarchyVersion;
 
 	GameObjects _transforms;
 	AnimationPropertyPtr _animtion;
 
 	std::function<void()> _onMeshChange;
 	std::function<void(const Camera&)> _onMeshWillRender;
+
+	delegate<void(const AnimationPose&)> _onPoseUpdate;
 };
 
 _NAME_END
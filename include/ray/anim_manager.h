@@ -0,0 +1,82 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_ANIM_MANAGER_H_
+#define _H_ANIM_MANAGER_H_
+
+#include <ray/game_types.h>
+#include <ray/thread.h>
+
+_NAME_BEGIN
+
+class AnimationComponent;
+
+class EXPORT AnimationManager final
+{
+	__DeclareSingleton(AnimationManager)
+public:
+	AnimationManager() noexcept;
+	~AnimationManager() noexcept;
+
+	void setParallelThreshold(std::size_t count) noexcept;
+	std::size_t getParallelThreshold() const noexcept;
+
+	std::size_t getNumAnimations() const noexcept;
+
+	void onFrameEnd() noexcept;
+
+private:
+	friend class AnimationComponent;
+
+	void _addAnimation(AnimationComponent* component) noexcept;
+	void _removeAnimation(AnimationComponent* component) noexcept;
+
+private:
+	AnimationManager(const AnimationManager&) = delete;
+	AnimationManager& operator=(const AnimationManager&) = delete;
+
+private:
+	std::size_t _parallelThreshold;
+
+	std::vector<AnimationComponent*> _animations;
+	std::vector<AnimationComponent*> _updates;
+
+	ThreadTaskGroup _group;
+};
+
+_NAME_END
+
+#endif
@@ -0,0 +1,100 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_ANIM_POSE_H_
+#define _H_ANIM_POSE_H_
+
+#include <ray/bone.h>
+
+_NAME_BEGIN
+
+class EXPORT AnimationPose final
+{
+public:
+	AnimationPose() noexcept;
+	~AnimationPose() noexcept;
+
+	void setBoneArray(const Bones& bones) noexcept;
+
+	std::size_t getNumBones() const noexcept;
+
+	void setParent(std::size_t index, std::int16_t parent) noexcept;
+	std::int16_t getParent(std::size_t index) const noexcept;
+
+	void setLocalTranslate(std::size_t index, const float3& translate) noexcept;
+	const float3& getLocalTranslate(std::size_t index) const noexcept;
+
+	void setLocalRotation(std::size_t index, const Quaternion& rotation) noexcept;
+	const Quaternion& getLocalRotation(std::size_t index) const noexcept;
+
+	void setLocalScaling(std::size_t index, const float3& scaling) noexcept;
+	const float3& getLocalScaling(std::size_t index) const noexcept;
+
+	void setLocalTransform(std::size_t index, const float3& translate, const Quaternion& rotation) noexcept;
+
+	const float4x4& getWorldTransform(std::size_t index) const noexcept;
+	const std::vector<float4x4>& getWorldTransforms() const noexcept;
+
+	const std::vector<std::uint16_t>& getEvaluationOrder() const noexcept;
+
+	std::size_t getVersion() const noexcept;
+
+	void updateWorldTransforms() noexcept;
+	void updateWorldTransform(std::size_t index) noexcept;
+
+private:
+	void _updateEvaluationOrder() noexcept;
+
+private:
+	AnimationPose(const AnimationPose&) = delete;
+	AnimationPose& operator=(const AnimationPose&) = delete;
+
+private:
+	std::size_t _version;
+
+	std::vector<std::int16_t> _parents;
+	std::vector<std::uint16_t> _order;
+
+	std::vector<float3> _localTranslates;
+	std::vector<float3> _localScalings;
+	std::vector<Quaternion> _localRotations;
+
+	std::vector<float4x4> _worldTransforms;
+};
+
+_NAME_END
+
+#endif
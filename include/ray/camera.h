@@ -94,6 +94,9 @@ public:
 	CameraOrder getCameraOrder() const noexcept;
 	CameraRenderFlags getCameraRenderFlags() const noexcept;
 
+	void setOcclusionCull(bool enable) noexcept;
+	bool getOcclusionCull() const noexcept;
+
 	void setSwapchain(GraphicsSwapchainPtr swapchin) noexcept;
 	const GraphicsSwapchainPtr& getSwapchain() const noexcept;
 
@@ -103,6 +106,9 @@ public:
 	void setRenderDataManager(const RenderDataManagerPtr& manager) noexcept;
 	const RenderDataManagerPtr& getRenderDataManager() const noexcept;
 
+	void assginVisiable() noexcept;
+	void resetVisiable() noexcept;
+
 private:
 	void _updateOrtho() const noexcept;
 	void _updatePerspective() const noexcept;
@@ -135,6 +141,9 @@ private:
 
 	GraphicsSwapchainPtr _swapchain;
 
+	bool _visiableAssigned;
+	bool _isOcclusionCull;
+
 	RenderDataManagerPtr _dataManager;
 	RenderPipelineFramebufferPtr _pipelineFramebuffer;
 
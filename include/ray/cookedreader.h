@@ -0,0 +1,116 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_COOKEDREADER_H_
+#define _H_COOKEDREADER_H_
+
+#include <ray/ioarchive.h>
+
+_NAME_BEGIN
+
+class CookedImage;
+
+// CookedReader keeps the cooked image and answers lookups from its node table,
+// so a scene is decoded into archivebuf one subtree at a time instead of as a whole.
+class EXPORT CookedReader final : public ios_base
+{
+public:
+	using type_t = archivebuf::type_t;
+	using node_t = std::uint32_t;
+
+	static const node_t npos = 0xFFFFFFFF;
+
+public:
+	CookedReader() noexcept;
+	CookedReader(StreamReader& stream) except;
+	CookedReader(const std::string& path) except;
+	~CookedReader() noexcept;
+
+	CookedReader& open(StreamReader& stream) except;
+	CookedReader& open(const std::string& path) except;
+
+	bool is_open() const noexcept;
+
+	void close() noexcept;
+
+	node_t root() const noexcept;
+
+	type_t type(node_t node) const noexcept;
+	std::size_t size(node_t node) const noexcept;
+
+	node_t at(node_t node, std::size_t n) const noexcept;
+	node_t find(node_t node, const char* key) const noexcept;
+
+	void read(node_t node, archivebuf& buf) const except;
+
+	static bool can_read(StreamReader& stream) noexcept;
+
+private:
+	CookedReader(const CookedReader&) noexcept = delete;
+	CookedReader& operator=(const CookedReader&) noexcept = delete;
+
+private:
+	std::vector<std::uint32_t> _data;
+	std::unique_ptr<CookedImage> _image;
+};
+
+class EXPORT CookedWrite final : public oarchive
+{
+public:
+	CookedWrite() noexcept;
+	~CookedWrite() noexcept;
+
+	CookedWrite& save(StreamWrite& stream) except;
+	CookedWrite& save(const std::string& path) except;
+
+	CookedWrite& save(StreamWrite& stream, const archivebuf& buf) except;
+	CookedWrite& save(const std::string& path, const archivebuf& buf) except;
+
+	void close() noexcept;
+
+	bool is_open() const noexcept;
+
+private:
+	CookedWrite(const CookedWrite&) noexcept = delete;
+	CookedWrite& operator=(const CookedWrite&) noexcept = delete;
+
+private:
+	archivebuf _buf;
+};
+
+_NAME_END
+
+#endif
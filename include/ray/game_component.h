@@ -106,6 +106,7 @@ private:
 
 private:
 	friend GameObject;
+	friend GameObjectManager;
 	void _setGameObject(GameObject* gameobj) noexcept;
 
 private:
@@ -115,6 +116,8 @@ private:
 	std::string _name;
 
 	GameObject* _gameObject;
+
+	std::size_t _componentIndex;
 };
 
 _NAME_END
@@ -62,6 +62,7 @@ public:
 	std::uint8_t getLayer() const noexcept;
 
 	std::size_t getInstanceID() const noexcept;
+	std::size_t getHierarchyVersion() const noexcept;
 
 	void setParent(const GameObjectPtr& parent) noexcept;
 	GameObject* getParent() const noexcept;
@@ -171,6 +172,7 @@ private:
 
 	void _onMoveBefore() except;
 	void _onMoveAfter() except;
+	void _dispatchMoveBefore() except;
 
 	void _onLayerChangeBefore() except;
 	void _onLayerChangeAfter() except;
@@ -191,6 +193,7 @@ private:
 
 	std::uint8_t _layer;
 	std::size_t _instanceID;
+	std::size_t _hierarchyVersion;
 
 	util::string _name;
 
@@ -210,6 +213,10 @@ private:
 
 	mutable bool _localNeedUpdates;
 	mutable bool _worldNeedUpdates;
+	mutable bool _localInverseNeedUpdates;
+	mutable bool _worldInverseNeedUpdates;
+
+	bool _moveNeedUpdates;
 
 	GameObjects _children;
 	GameObjectWeakPtr _parent;
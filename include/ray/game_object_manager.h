@@ -38,17 +38,24 @@
 #define _H_GAME_OBJECT_MANAGER_H_
 
 #include <stack>
+#include <unordered_map>
 #include <ray/game_features.h>
+#include <ray/aabb_tree.h>
 
 _NAME_BEGIN
 
+class MeshComponent;
+
 struct EXPORT RaycastHit
 {
 	RaycastHit() noexcept;
 
 	GameObject* object;
 	std::size_t mesh;
+	std::size_t triangle;
 	float distance;
+	float2 barycentric;
+	float3 point;
 };
 
 class EXPORT GameObjectManager final
@@ -63,21 +70,59 @@ public:
 
 	GameObjectPtr instantiate(const util::string& name) noexcept;
 
+	void findObjects(const util::string& name, GameObjects& objects) noexcept;
+
+	template<typename T>
+	void getComponents(std::vector<T*>& components) const noexcept
+	{
+		for (auto& it : _componentLists)
+		{
+			if (!it.first->isDerivedFrom(T::getRtti()))
+				continue;
+
+			for (auto& component : it.second)
+				components.push_back(static_cast<T*>(component));
+		}
+	}
+
+	void getComponents(const rtti::Rtti* type, std::vector<GameComponent*>& components) const noexcept;
+	void getComponents(const rtti::Rtti& type, std::vector<GameComponent*>& components) const noexcept;
+
+	const std::vector<GameComponent*>& getComponentsExact(const rtti::Rtti* type) const noexcept;
+	const std::vector<GameComponent*>& getComponentsExact(const rtti::Rtti& type) const noexcept;
+
 	std::size_t raycastHit(const Raycast3& ray, RaycastHit& hit, std::function<bool(GameObject*)> comp = nullptr) noexcept;
 	std::size_t raycastHit(const Vector3& orgin, const Vector3& end, RaycastHit& hit, std::function<bool(GameObject*)> comp = nullptr) noexcept;
+	std::size_t raycastHit(const Raycast3 rays[], RaycastHit hits[], std::size_t count, std::function<bool(GameObject*)> comp = nullptr) noexcept;
 
 	bool activeObject(const util::string& name) noexcept;
 
+	void updateTransforms() noexcept;
+
 	void onFrameBegin() noexcept;
 	void onFrame() noexcept;
 	void onFrameEnd() noexcept;
 
 private:
 	friend GameObject;
+	friend GameComponent;
+	friend MeshComponent;
 
 	void _instanceObject(GameObject* entity, std::size_t& instanceID) noexcept;
 	void _unsetObject(GameObject* entity) noexcept;
+	void _renameObject(GameObject* entity, const util::string& oldName) noexcept;
+	void _removeName(GameObject* entity, const util::string& name) noexcept;
 	void _activeObject(GameObject* entity, bool active) noexcept;
+	void _moveObject(GameObject* entity) noexcept;
+
+	void _addComponent(GameComponent* component) noexcept;
+	void _removeComponent(GameComponent* component) noexcept;
+
+	void _updateRaycastMesh(MeshComponent* component) noexcept;
+	void _removeRaycastMesh(MeshComponent* component) noexcept;
+
+	GameObject* _findObject(const util::string& name) const noexcept;
+	const std::vector<GameObject*>* _findNameList(const util::string& name) const noexcept;
 
 private:
 	bool _hasEmptyActors;
@@ -85,6 +130,15 @@ private:
 	std::stack<std::size_t> _emptyLists;
 	std::vector<GameObject*> _instanceLists;
 	std::vector<GameObject*> _activeActors;
+
+	std::vector<GameObject*> _moveActors;
+	std::vector<GameObject*> _moveUpdates;
+	std::vector<std::pair<GameObject*, std::size_t>> _moveQueue;
+
+	std::unordered_map<util::string, std::vector<GameObject*>> _nameLists;
+	std::unordered_map<const rtti::Rtti*, std::vector<GameComponent*>> _componentLists;
+
+	AABBTree<MeshComponent*> _raycastTree;
 };
 
 _NAME_END
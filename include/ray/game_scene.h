@@ -38,6 +38,7 @@
 #define _H_GAME_SCENE_H_
 
 #include <ray/game_object.h>
+#include <ray/cookedreader.h>
 
 _NAME_BEGIN
 
@@ -66,6 +67,7 @@ public:
 	void sendMessage(const MessagePtr& message) except;
 
 	bool load(const iarchive& reader) noexcept;
+	bool load(const CookedReader& reader) noexcept;
 	bool save(oarchive& reader) noexcept;
 
 	bool load(const util::string& sceneURL) noexcept;
@@ -73,6 +75,9 @@ public:
 
 	GameScenePtr clone() const noexcept;
 
+private:
+	bool loadObject(const archivebuf& object) except;
+
 private:
 	class RootObject : public GameObject
 	{
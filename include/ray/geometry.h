@@ -70,6 +70,7 @@ public:
 
 	void setMaterial(const MaterialPtr& material) noexcept;
 	const MaterialPtr& getMaterial() noexcept;
+	const MaterialTechPtr& getMaterialTech(RenderQueue queue) const noexcept;
 
 	void setVertexBuffer(const GraphicsDataPtr& data, std::intptr_t offset) noexcept;
 	const GraphicsDataPtr& getVertexBuffer() const noexcept;
@@ -81,6 +82,9 @@ public:
 	void setGraphicsIndirect(const GraphicsIndirectPtr& renderable) noexcept;
 	GraphicsIndirectPtr getGraphicsIndirect() noexcept;
 
+	bool isInstancing(const Geometry& geometry, RenderQueue queue) const noexcept;
+	void onRenderObjectInstancing(RenderPipeline& pipeline, RenderQueue queue, MaterialTech* tech, std::uint32_t numInstances) noexcept;
+
 private:
 	bool onVisiableTest(const Camera& camera, const Frustum& fru) noexcept;
 
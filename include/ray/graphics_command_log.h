@@ -0,0 +1,148 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_GRAPHICS_COMMAND_LOG_H_
+#define _H_GRAPHICS_COMMAND_LOG_H_
+
+#include <ray/graphics_types.h>
+#include <mutex>
+
+_NAME_BEGIN
+
+enum class GraphicsCommandLogType : std::uint8_t
+{
+	GraphicsCommandLogTypeCreateBuffer = 0,
+	GraphicsCommandLogTypeCreateTexture = 1,
+	GraphicsCommandLogTypeCreateProgram = 2,
+	GraphicsCommandLogTypeCreatePipeline = 3,
+	GraphicsCommandLogTypeCreateFramebuffer = 4,
+	GraphicsCommandLogTypeCreateDescriptorSet = 5,
+	GraphicsCommandLogTypeUploadBuffer = 6,
+	GraphicsCommandLogTypeUploadTexture = 7,
+	GraphicsCommandLogTypeUploadUniform = 8,
+	GraphicsCommandLogTypeGenerateMipmap = 9,
+	GraphicsCommandLogTypeSetViewport = 10,
+	GraphicsCommandLogTypeSetScissor = 11,
+	GraphicsCommandLogTypeSetStencilCompareMask = 12,
+	GraphicsCommandLogTypeSetStencilReference = 13,
+	GraphicsCommandLogTypeSetStencilWriteMask = 14,
+	GraphicsCommandLogTypeSetPipeline = 15,
+	GraphicsCommandLogTypeSetDescriptorSet = 16,
+	GraphicsCommandLogTypeSetVertexBuffer = 17,
+	GraphicsCommandLogTypeSetIndexBuffer = 18,
+	GraphicsCommandLogTypeSetFramebuffer = 19,
+	GraphicsCommandLogTypeClearFramebuffer = 20,
+	GraphicsCommandLogTypeDiscardFramebuffer = 21,
+	GraphicsCommandLogTypeBlitFramebuffer = 22,
+	GraphicsCommandLogTypeReadFramebuffer = 23,
+	GraphicsCommandLogTypeDraw = 24,
+	GraphicsCommandLogTypeDrawIndexed = 25,
+	GraphicsCommandLogTypeDrawIndirect = 26,
+	GraphicsCommandLogTypeDrawIndexedIndirect = 27,
+	GraphicsCommandLogTypePresent = 28,
+	GraphicsCommandLogTypeBeginRange = GraphicsCommandLogTypeCreateBuffer,
+	GraphicsCommandLogTypeEndRange = GraphicsCommandLogTypePresent,
+	GraphicsCommandLogTypeRangeSize = (GraphicsCommandLogTypeEndRange - GraphicsCommandLogTypeBeginRange + 1),
+};
+
+struct EXPORT GraphicsCommandLogRecord
+{
+	GraphicsCommandLogType type;
+	std::uint32_t args[4];
+};
+
+struct EXPORT GraphicsCommandLogCounter
+{
+	std::uint32_t numDraws;
+	std::uint32_t numInstances;
+	std::uint64_t numPrimitives;
+
+	std::uint32_t numPipelineChanges;
+	std::uint32_t numDescriptorSetChanges;
+	std::uint32_t numVertexBufferChanges;
+	std::uint32_t numIndexBufferChanges;
+	std::uint32_t numFramebufferChanges;
+	std::uint32_t numViewportChanges;
+	std::uint32_t numStencilChanges;
+
+	std::uint32_t numClears;
+	std::uint32_t numPresents;
+
+	std::uint64_t numUploadBytes;
+	std::uint64_t numUniformBytes;
+
+	GraphicsCommandLogCounter() noexcept;
+
+	std::uint32_t getStateChanges() const noexcept;
+};
+
+typedef std::vector<GraphicsCommandLogRecord> GraphicsCommandLogRecords;
+
+class EXPORT GraphicsCommandLog final
+{
+	__DeclareSingleton(GraphicsCommandLog)
+public:
+	GraphicsCommandLog() noexcept;
+	~GraphicsCommandLog() noexcept;
+
+	void setRecordEnable(bool enable) noexcept;
+	bool getRecordEnable() const noexcept;
+
+	void record(GraphicsCommandLogType type, std::uint32_t arg0 = 0, std::uint32_t arg1 = 0, std::uint32_t arg2 = 0, std::uint32_t arg3 = 0) noexcept;
+
+	void clear() noexcept;
+
+	GraphicsCommandLogRecords getRecords() const noexcept;
+	GraphicsCommandLogCounter getCounter() const noexcept;
+
+	void save(std::ostream& stream) const noexcept;
+
+	static const char* getTypeName(GraphicsCommandLogType type) noexcept;
+
+private:
+	GraphicsCommandLog(const GraphicsCommandLog&) = delete;
+	GraphicsCommandLog& operator=(const GraphicsCommandLog&) = delete;
+
+private:
+	bool _enableRecord;
+	mutable std::mutex _mutex;
+	GraphicsCommandLogCounter _counter;
+	GraphicsCommandLogRecords _records;
+};
+
+_NAME_END
+
+#endif
@@ -51,7 +51,11 @@ public:
 	void setSwapchain(GraphicsSwapchainPtr swapchain) noexcept;
 	GraphicsSwapchainPtr getSwapchain() const noexcept;
 
+	void setUniformStreamSize(std::uint32_t size) noexcept;
+	std::uint32_t getUniformStreamSize() const noexcept;
+
 private:
+	std::uint32_t _uniformStreamSize;
 	GraphicsSwapchainPtr _swapchain;
 };
 
@@ -92,6 +96,12 @@ public:
 	virtual void setIndexBufferData(const GraphicsDataPtr& data, std::intptr_t offset, GraphicsIndexType indexType) noexcept = 0;
 	virtual GraphicsDataPtr getIndexBufferData() const noexcept = 0;
 
+	virtual bool uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept = 0;
+	virtual GraphicsDataPtr getUniformStreamData() const noexcept = 0;
+
+	virtual std::uint32_t getUniformUploadBytes() const noexcept = 0;
+	virtual std::uint32_t getUniformUploadSkips() const noexcept = 0;
+
 	virtual void generateMipmap(const GraphicsTexturePtr& texture) noexcept = 0;
 
 	virtual void setFramebuffer(const GraphicsFramebufferPtr& target) noexcept = 0;
@@ -177,6 +177,7 @@ public:
 	virtual void uniform4fmatv(std::size_t num, const float* mat4) noexcept = 0;
 	virtual void uniformTexture(GraphicsTexturePtr texture, GraphicsSamplerPtr sampler = nullptr) noexcept = 0;
 	virtual void uniformBuffer(GraphicsDataPtr ubo) noexcept = 0;
+	virtual void uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept = 0;
 
 	virtual bool getBool() const noexcept = 0;
 	virtual int getInt() const noexcept = 0;
@@ -212,6 +213,10 @@ public:
 	virtual const GraphicsTexturePtr& getTexture() const noexcept = 0;
 	virtual const GraphicsSamplerPtr& getTextureSampler() const noexcept = 0;
 	virtual const GraphicsDataPtr& getBuffer() const noexcept = 0;
+	virtual std::uint32_t getBufferOffset() const noexcept = 0;
+	virtual std::uint32_t getBufferSize() const noexcept = 0;
+
+	virtual std::uint32_t getVersion() const noexcept = 0;
 
 	virtual const GraphicsParamPtr& getGraphicsParam() const noexcept = 0;
 
@@ -215,8 +215,9 @@ enum class GraphicsDeviceType : std::uint8_t
 	GraphicsDeviceTypeOpenGLES31 = 7,
 	GraphicsDeviceTypeOpenGLES32 = 8,
 	GraphicsDeviceTypeVulkan = 9,
+	GraphicsDeviceTypeNull = 10,
 	GraphicsDeviceTypeBeginRange = GraphicsDeviceTypeD3D9,
-	GraphicsDeviceTypeEndRange = GraphicsDeviceTypeVulkan,
+	GraphicsDeviceTypeEndRange = GraphicsDeviceTypeNull,
 	GraphicsDeviceTypeRangeSize = (GraphicsDeviceTypeEndRange - GraphicsDeviceTypeBeginRange + 1),
 };
 
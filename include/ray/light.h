@@ -60,6 +60,8 @@ public:
 	void setShadowBias(float bias) noexcept;
 	void setShadowFactor(float factor) noexcept;
 	void setShadowMode(ShadowMode shadowType) noexcept;
+	void setShadowCascades(std::uint8_t cascades) noexcept;
+	void setShadowCascadeLambda(float lambda) noexcept;
 
 	void setGlobalIllumination(bool enable) noexcept;
 	bool getGlobalIllumination() const noexcept;
@@ -71,6 +73,8 @@ public:
 	float getShadowBias() const noexcept;
 	float getShadowFactor() const noexcept;
 	ShadowMode getShadowMode() const noexcept;
+	std::uint8_t getShadowCascades() const noexcept;
+	float getShadowCascadeLambda() const noexcept;
 
 	const float2& getSpotInnerCone() const noexcept;
 	const float2& getSpotOuterCone() const noexcept;
@@ -89,14 +93,26 @@ public:
 
 	const CameraPtr& getCamera() const noexcept;
 
+	bool getShadowCascadeEnable() const noexcept;
+
+	const Cameras& getShadowCascadeCameras(const Camera& camera) const noexcept;
+	const std::vector<float>& getShadowCascadeSplits(const Camera& camera) const noexcept;
+
+	void updateShadowCascades(const Camera& camera, const std::uint32_t shadowMapSize[]) noexcept;
+
 	RenderObjectPtr clone() const noexcept;
 
 private:
 	bool setupShadowMap() noexcept;
 	bool setupReflectiveShadowMap() noexcept;
+	bool setupShadowCascades() noexcept;
 
 	void destroyShadowMap() noexcept;
 	void destroyReflectiveShadowMap() noexcept;
+	void destroyShadowCascades() noexcept;
+
+	struct ShadowCascadeSet;
+	ShadowCascadeSet* createShadowCascades(const Camera& camera) noexcept;
 
 	void _updateTransform() noexcept;
 	void _updateBoundingBox() noexcept;
@@ -138,6 +154,19 @@ private:
 	CameraPtr _shadowCamera;
 	ShadowMode _shadowMode;
 
+	// every main camera fits its own cascades, so two views of the same sun never share the cascade cameras
+	struct ShadowCascadeSet
+	{
+		const Camera* camera;
+		Cameras cameras;
+		std::vector<float> splits;
+	};
+
+	std::uint8_t _shadowCascades;
+	float _shadowCascadeLambda;
+	bool _shadowCascadeEnable;
+	std::vector<ShadowCascadeSet> _shadowCascadeSets;
+
 	GraphicsTexturePtr _skybox;
 	GraphicsTexturePtr _skyDiffuseIBL;
 	GraphicsTexturePtr _skySpecularIBL;
@@ -0,0 +1,135 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_LIGHT_CLUSTER_H_
+#define _H_LIGHT_CLUSTER_H_
+
+#include <ray/render_types.h>
+
+_NAME_BEGIN
+
+class EXPORT LightCluster final
+{
+public:
+	LightCluster() noexcept;
+	~LightCluster() noexcept;
+
+	void setup(std::uint32_t clusterX, std::uint32_t clusterY, std::uint32_t clusterZ) noexcept;
+
+	std::uint32_t getClusterX() const noexcept;
+	std::uint32_t getClusterY() const noexcept;
+	std::uint32_t getClusterZ() const noexcept;
+	std::uint32_t getNumClusters() const noexcept;
+
+	void setProject(const float4x4& projectInverse, float znear, float zfar) noexcept;
+
+	const float2& getDepthSliceFactor() const noexcept;
+
+	void clear() noexcept;
+
+	std::uint32_t addPointLight(const float3& eyePosition, float range) noexcept;
+	std::uint32_t addSpotLight(const float3& eyePosition, const float3& eyeDirection, float range, float cosOuter) noexcept;
+
+	std::uint32_t getNumLights() const noexcept;
+
+	void compute() noexcept;
+
+	AABB getClusterAABB(std::uint32_t index) const noexcept;
+
+	const std::vector<std::uint32_t>& getClusterOffsets() const noexcept;
+	const std::vector<std::uint32_t>& getClusterCounts() const noexcept;
+	const std::vector<std::uint32_t>& getLightIndices() const noexcept;
+
+private:
+	struct LightBounds
+	{
+		float3 position;
+		float3 direction;
+		float range;
+		float cosOuter;
+		float sinOuter;
+		bool isSpot;
+
+		std::uint32_t sliceMin;
+		std::uint32_t sliceMax;
+	};
+
+	void computeClusterBounds() noexcept;
+	void computeSlice(std::uint32_t slice, std::vector<std::uint32_t>& masks) noexcept;
+
+	std::uint32_t computeSliceIndex(float depth) const noexcept;
+
+private:
+	LightCluster(const LightCluster&) = delete;
+	LightCluster& operator=(const LightCluster&) = delete;
+
+private:
+	std::uint32_t _clusterX;
+	std::uint32_t _clusterY;
+	std::uint32_t _clusterZ;
+	std::uint32_t _sliceStride;
+
+	float _znear;
+	float _zfar;
+	float2 _depthSliceFactor;
+	float4x4 _projectInverse;
+
+	bool _needUpdateBounds;
+
+	std::vector<float> _minX;
+	std::vector<float> _minY;
+	std::vector<float> _minZ;
+	std::vector<float> _maxX;
+	std::vector<float> _maxY;
+	std::vector<float> _maxZ;
+	std::vector<float> _centerX;
+	std::vector<float> _centerY;
+	std::vector<float> _centerZ;
+	std::vector<float> _radius;
+
+	std::vector<LightBounds> _lights;
+
+	std::vector<std::uint32_t> _clusterOffsets;
+	std::vector<std::uint32_t> _clusterCounts;
+	std::vector<std::uint32_t> _lightIndices;
+
+	std::vector<std::vector<std::uint32_t>> _sliceIndices;
+	std::vector<std::vector<std::uint32_t>> _sliceMasks;
+};
+
+_NAME_END
+
+#endif
\ No newline at end of file
@@ -76,6 +76,12 @@ public:
 	void setShadowBias(float bias) noexcept;
 	float getShadowBias() const noexcept;
 
+	void setShadowCascades(std::uint8_t cascades) noexcept;
+	std::uint8_t getShadowCascades() const noexcept;
+
+	void setShadowCascadeLambda(float lambda) noexcept;
+	float getShadowCascadeLambda() const noexcept;
+
 	void setGlobalIllumination(bool enable) noexcept;
 	bool getGlobalIllumination() const noexcept;
 
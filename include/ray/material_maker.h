@@ -66,6 +66,7 @@ private:
 	void instanceParameter(MaterialManager& manager, Material& material, ixmlarchive& reader) except;
 	void instanceMacro(MaterialManager& manager, Material& material, ixmlarchive& reader) except;
 	void instanceBuffer(MaterialManager& manager, Material& material, ixmlarchive& reader) except;
+	void instanceBufferMember(MaterialManager& manager, Material& material, ixmlarchive& reader, bool bindSemantic) except;
 	void instanceCodes(MaterialManager& manager, ixmlarchive& reader) except;
 	void instanceShader(MaterialManager& manager, Material& material, GraphicsProgramDesc& programDesc, ixmlarchive& reader) except;
 	void instanceInputLayout(MaterialManager& manager, Material& material, ixmlarchive& reader) except;
@@ -90,6 +91,7 @@ private:
 private:
 	bool _isHlsl;
 	std::string _hlslCodes;
+	std::map<std::string, std::string> _macros;
 	std::map<std::string, bool> _onceInclude;
 	std::map<std::string, std::vector<char>> _shaderCodes;
 };
@@ -195,6 +195,8 @@ public:
 
 	const MaterialVariant& value() const noexcept;
 
+	std::uint32_t getVersion() const noexcept;
+
 	void addParamListener(MaterialParamListener* listener) noexcept;
 	void removeParamListener(MaterialParamListener* listener) noexcept;
 
@@ -135,9 +135,13 @@ public:
 	void setGraphicsUniformSet(GraphicsUniformSetPtr uniformSet) noexcept;
 	const GraphicsUniformSetPtr& getGraphicsUniformSet() const noexcept;
 
+	void setVersion(std::uint32_t version) noexcept;
+	std::uint32_t getVersion() const noexcept;
+
 private:
 	GlobalSemanticType _semanticType;
 	GraphicsUniformSetPtr _uniformSet;
+	std::uint32_t _version;
 };
 
 class EXPORT MaterialPass final : public rtti::Interface
@@ -174,6 +178,8 @@ public:
 	const GraphicsPipelinePtr& getRenderPipeline() const noexcept;
 	const GraphicsDescriptorSetPtr& getDescriptorSet() const noexcept;
 
+	bool hasSemantic(GlobalSemanticType semanticType) const noexcept;
+
 	void update(const MaterialSemanticManager& semanticManager) noexcept;
 
 	MaterialPassPtr clone() const noexcept;
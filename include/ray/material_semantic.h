@@ -116,6 +116,7 @@ public:
 	void uniform4fmatv(const std::vector<float4x4>& value) noexcept;
 	void uniformTexture(GraphicsTexturePtr texture, GraphicsSamplerPtr sampler = nullptr) noexcept;
 	void uniformBuffer(GraphicsDataPtr ubo) noexcept;
+	void uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept;
 
 	bool getBool() const noexcept;
 	int getInt() const noexcept;
@@ -151,6 +152,10 @@ public:
 	GraphicsTexturePtr getTexture() const noexcept;
 	GraphicsSamplerPtr getTextureSampler() const noexcept;
 	GraphicsDataPtr getBuffer() const noexcept;
+	std::uint32_t getBufferOffset() const noexcept;
+	std::uint32_t getBufferSize() const noexcept;
+
+	std::uint32_t getVersion() const noexcept;
 
 private:
 	MaterialSemantic(const MaterialSemantic&) = delete;
@@ -111,6 +111,7 @@ public:
 	void uniform4fmatv(const std::vector<float4x4>& value) noexcept;
 	void uniformTexture(GraphicsTexturePtr texture, GraphicsSamplerPtr sampler = nullptr) noexcept;
 	void uniformBuffer(GraphicsDataPtr ubo) noexcept;
+	void uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept;
 
 	bool getBool() const noexcept;
 	int getInt() const noexcept;
@@ -146,6 +147,10 @@ public:
 	const GraphicsTexturePtr& getTexture() const noexcept;
 	const GraphicsSamplerPtr& getTextureSampler() const noexcept;
 	const GraphicsDataPtr& getBuffer() const noexcept;
+	std::uint32_t getBufferOffset() const noexcept;
+	std::uint32_t getBufferSize() const noexcept;
+
+	std::uint32_t getVersion() const noexcept;
 
 	void copy(const MaterialVariant& other) noexcept;
 
@@ -160,15 +165,19 @@ private:
 		GraphicsSamplerPtr sampler;
 	};
 
+	struct BufferPack
+	{
+		GraphicsDataPtr data;
+		std::uint32_t offset;
+		std::uint32_t size;
+	};
+
 	union
 	{
 		bool b;
 		int i[4];
 		uint1 ui[4];
-		float f[4];
-		float2x2* m2;
-		float3x3* m3;
-		float4x4* m4;
+		float f[16];
 		std::vector<int1>* iarray;
 		std::vector<int2>* iarray2;
 		std::vector<int3>* iarray3;
@@ -185,10 +194,11 @@ private:
 		std::vector<float3x3>* m3array;
 		std::vector<float4x4>* m4array;
 		TexturePack* texture;
-		GraphicsDataPtr* buffer;
+		BufferPack* buffer;
 	} _value;
 
 	GraphicsUniformType _type;
+	std::uint32_t _version;
 };
 
 _NAME_END
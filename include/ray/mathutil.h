@@ -861,6 +861,38 @@ namespace math
 		return *reinterpret_cast<std::uint32_t*>(&fp);
 	}
 
+	inline std::uint16_t fpToHalf(float fp) noexcept
+	{
+		std::uint32_t raw = fpToIEEE(fp);
+		std::uint32_t sign = (raw >> 16) & 0x8000;
+		std::uint32_t mantissa = raw & 0x007FFFFF;
+		std::int32_t exponent = (std::int32_t)((raw >> 23) & 0xFF) - 127 + 15;
+
+		if (((raw >> 23) & 0xFF) == 0xFF)
+			return (std::uint16_t)(sign | (mantissa ? 0x7E00 : 0x7C00));
+
+		if (exponent <= 0)
+		{
+			if (exponent < -10)
+				return (std::uint16_t)sign;
+
+			mantissa = (mantissa | 0x00800000) >> (1 - exponent);
+			return (std::uint16_t)(sign | ((mantissa + 0x00001000) >> 13));
+		}
+
+		mantissa += 0x00001000;
+		if (mantissa & 0x00800000)
+		{
+			mantissa = 0;
+			exponent++;
+		}
+
+		if (exponent >= 31)
+			return (std::uint16_t)(sign | 0x7C00);
+
+		return (std::uint16_t)(sign | (exponent << 10) | (mantissa >> 13));
+	}
+
 	inline double fpFromIEEE(std::uint64_t raw) noexcept
 	{
 		return *reinterpret_cast<double*>(&raw);
@@ -0,0 +1,103 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_MESH_BVH_H_
+#define _H_MESH_BVH_H_
+
+#include <ray/modtypes.h>
+
+_NAME_BEGIN
+
+struct MeshBVHNode
+{
+	float3 min;
+	std::uint32_t offset;
+	float3 max;
+	std::uint32_t count;
+};
+
+struct MeshBVHHit
+{
+	std::size_t triangle;
+	std::size_t subset;
+
+	float distance;
+	float u;
+	float v;
+};
+
+// Static triangle hierarchy built with binned SAH, the triangles are stored as one vertex and
+// two edges in leaf order, so the traversal never touches the source mesh arrays.
+class EXPORT MeshBVH final
+{
+public:
+	static const std::size_t LeafSize = 4;
+	static const std::size_t BinCount = 16;
+
+public:
+	MeshBVH() noexcept;
+	~MeshBVH() noexcept;
+
+	bool build(const MeshProperty& mesh) noexcept;
+	void clear() noexcept;
+
+	bool empty() const noexcept;
+
+	std::size_t getNumNodes() const noexcept;
+	std::size_t getNumTriangles() const noexcept;
+	std::size_t getMemoryUsage() const noexcept;
+
+	bool raycast(const float3& origin, const float3& direction, float maxDistance, MeshBVHHit& hit) const noexcept;
+
+private:
+	void subdivide(std::uint32_t index, std::uint32_t first, std::uint32_t count, std::uint32_t depth, const std::vector<float3>& centers, const std::vector<MeshBVHNode>& bounds, std::vector<std::uint32_t>& order) noexcept;
+
+	static bool slab(const MeshBVHNode& node, const float3& origin, const float3& invDir, float maxDistance, float& distance) noexcept;
+
+private:
+	MeshBVH(const MeshBVH&) = delete;
+	MeshBVH& operator=(const MeshBVH&) = delete;
+
+private:
+	std::vector<MeshBVHNode> _nodes;
+	std::vector<float3> _triangles;
+	std::vector<std::uint32_t> _triangleIndices;
+	std::vector<std::uint32_t> _triangleSubsets;
+};
+
+_NAME_END
+
+#endif
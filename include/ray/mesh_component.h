@@ -80,6 +80,8 @@ private:
 	void onActivate() noexcept;
 	void onDeactivate() noexcept;
 
+	void onMoveAfter() noexcept;
+
 	void onMeshChangeBefore() noexcept;
 	void onMeshChangeAfter() noexcept;
 
@@ -88,8 +90,12 @@ private:
 	MeshComponent& operator=(const MeshComponent&) noexcept = delete;
 
 private:
+	friend GameObjectManager;
+
 	bool _needUpdate;
 
+	std::int32_t _raycastProxy;
+
 	MeshPropertyPtr _mesh;
 	MeshPropertyPtr _sharedMesh;
 
@@ -61,6 +61,15 @@ public:
 	void setReceiveShadow(bool value) noexcept;
 	bool getReceiveShadow() const noexcept;
 
+	void setVertexCompression(bool value) noexcept;
+	bool getVertexCompression() const noexcept;
+
+	void setOccluder(bool value) noexcept;
+	bool getOccluder() const noexcept;
+
+	void setStatic(bool value) noexcept;
+	bool getStatic() const noexcept;
+
 	void setMaterial(const MaterialPtr& material) noexcept;
 	void setMaterial(const MaterialPtr& material, std::size_t n) noexcept;
 	void setSharedMaterial(const MaterialPtr& material) noexcept;
@@ -125,6 +134,9 @@ private:
 
 	bool _isCastShadow;
 	bool _isReceiveShadow;
+	bool _isVertexCompression;
+	bool _isOccluder;
+	bool _isStatic;
 
 	Materials _materials;
 	Materials _sharedMaterials;
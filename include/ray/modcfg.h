@@ -67,6 +67,7 @@ _NAME_BEGIN
 #define _BUILD_VMD_HANDLER   1
 #define _BUILD_X_HANDLER     1
 #define _BUILD_SDKMESH_HANDLER   1
+#define _BUILD_CLIP_HANDLER  1
 
 _NAME_END
 
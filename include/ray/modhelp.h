@@ -309,8 +309,10 @@ public:
 	void computeTangents(std::uint8_t texSlot = 0) noexcept;
 	void computeTangentQuats(Float4Array& tangentQuat) const noexcept;
 	void computeBoundingBox() noexcept;
+	void computeBVH() noexcept;
 
 	const BoundingBox& getBoundingBox() const noexcept;
+	const MeshBVHPtr& getBVH() const noexcept;
 
 	void clear() noexcept;
 	MeshPropertyPtr clone() noexcept;
@@ -332,6 +334,8 @@ private:
 	BoundingBox _boundingBox;
 
 	MeshSubsets _meshSubsets;
+
+	MeshBVHPtr _bvh;
 };
 
 _NAME_END
@@ -46,10 +46,13 @@
 _NAME_BEGIN
 
 typedef std::shared_ptr<class AnimationProperty> AnimationPropertyPtr;
+typedef std::shared_ptr<class AnimationPose> AnimationPosePtr;
+typedef std::shared_ptr<class AnimationClip> AnimationClipPtr;
 typedef std::shared_ptr<class TextureProperty> TexturePropertyPtr;
 typedef std::shared_ptr<class CameraProperty> CameraPropertyPtr;
 typedef std::shared_ptr<class LightProperty> LightPropertyPtr;
 typedef std::shared_ptr<class MeshProperty> MeshPropertyPtr;
+typedef std::shared_ptr<class MeshBVH> MeshBVHPtr;
 typedef std::shared_ptr<class MaterialProperty> MaterialPropertyPtr;
 typedef std::shared_ptr<class Model> ModelPtr;
 typedef std::shared_ptr<class Bone> BonePtr;
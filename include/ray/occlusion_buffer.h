@@ -0,0 +1,135 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_OCCLUSION_BUFFER_H_
+#define _H_OCCLUSION_BUFFER_H_
+
+#include <ray/render_types.h>
+
+_NAME_BEGIN
+
+class EXPORT OcclusionHull final
+{
+public:
+	OcclusionHull() noexcept;
+	OcclusionHull(const float3* vertices, std::size_t numVertices, const std::uint32_t* indices, std::size_t numIndices) noexcept;
+	~OcclusionHull() noexcept;
+
+	void setVertices(std::vector<float3>&& vertices) noexcept;
+	void setIndices(std::vector<std::uint32_t>&& indices) noexcept;
+
+	const std::vector<float3>& getVertices() const noexcept;
+	const std::vector<std::uint32_t>& getIndices() const noexcept;
+
+	std::size_t getNumTriangles() const noexcept;
+
+private:
+	std::vector<float3> _vertices;
+	std::vector<std::uint32_t> _indices;
+};
+
+class EXPORT OcclusionBuffer final
+{
+public:
+	OcclusionBuffer() noexcept;
+	~OcclusionBuffer() noexcept;
+
+	void setup(std::uint32_t width, std::uint32_t height) noexcept;
+
+	std::uint32_t getWidth() const noexcept;
+	std::uint32_t getHeight() const noexcept;
+
+	void clear(const float4x4& viewProject) noexcept;
+
+	void addOccluder(const OcclusionHull& hull, const float4x4& transform) noexcept;
+	void rasterize() noexcept;
+
+	bool isVisiable(const AABB& aabb) const noexcept;
+
+	std::size_t getNumOccluders() const noexcept;
+	std::size_t getNumTriangles() const noexcept;
+
+	const std::vector<float>& getDepthBuffer() const noexcept;
+
+private:
+	struct Occluder
+	{
+		const OcclusionHull* hull;
+		float4x4 transform;
+	};
+
+	struct Triangle
+	{
+		float x[3];
+		float y[3];
+		float z[3];
+
+		std::int32_t minX;
+		std::int32_t minY;
+		std::int32_t maxX;
+		std::int32_t maxY;
+	};
+
+	typedef std::vector<Triangle> Triangles;
+
+	void setupTriangles(const Occluder& occluder, Triangles& triangles) const noexcept;
+	void rasterizeTile(std::uint32_t tileY) noexcept;
+	void rasterizeTriangle(const Triangle& triangle, std::int32_t minY, std::int32_t maxY) noexcept;
+
+private:
+	OcclusionBuffer(const OcclusionBuffer&) = delete;
+	OcclusionBuffer& operator=(const OcclusionBuffer&) = delete;
+
+private:
+	std::uint32_t _width;
+	std::uint32_t _height;
+	std::uint32_t _tileCountX;
+	std::uint32_t _tileCountY;
+
+	std::size_t _numTriangles;
+
+	float4x4 _viewProject;
+
+	std::vector<float> _depth;
+	std::vector<float> _depthTiles;
+
+	std::vector<Occluder> _occluders;
+	std::vector<Triangles> _triangles;
+};
+
+_NAME_END
+
+#endif
\ No newline at end of file
@@ -43,11 +43,30 @@ class btMotionState;
 
 _NAME_BEGIN
 
+struct PhysicsContact
+{
+	class PhysicsBody* body0;
+	class PhysicsBody* body1;
+
+	Vector3 point;
+	Vector3 normal;
+
+	float distance;
+	float impulse;
+
+	std::uint32_t numContacts;
+};
+
+typedef std::vector<PhysicsContact> PhysicsContacts;
+
 class EXPORT PhysicsBodyListener
 {
 public:
 	virtual void onFetchResult() noexcept = 0;
-	virtual void onCollisionStay() noexcept = 0;
+
+	virtual void onCollisionEnter(const PhysicsContact contacts[], std::size_t count) noexcept = 0;
+	virtual void onCollisionStay(const PhysicsContact contacts[], std::size_t count) noexcept = 0;
+	virtual void onCollisionExit(const PhysicsContact contacts[], std::size_t count) noexcept = 0;
 };
 
 class EXPORT PhysicsBody
@@ -108,6 +127,9 @@ private:
 	friend class PhysicsScene;
 	btRigidBody* getRigidbody() noexcept;
 
+	void fetchResult() noexcept;
+	void waitSimulation() const noexcept;
+
 private:
 	PhysicsBody(const PhysicsBody&) = delete;
 	PhysicsBody& operator=(const PhysicsBody&) = delete;
@@ -136,6 +158,8 @@ private:
 	Vector3 _linearVelocity;
 	Vector3 _angularVelocity;
 
+	float4x4 _worldTransform;
+
 	class MotionState* _motion;
 	PhysicsSceneWeakPtr _scene;
 	PhysicsBodyListener* _listener;
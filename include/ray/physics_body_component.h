@@ -90,6 +90,14 @@ public:
 	void addTorque(const Vector3& force) noexcept;
 	void addImpulse(const Vector3& force, const Vector3& axis) noexcept;
 
+	void addCollisionEnterListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept;
+	void addCollisionStayListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept;
+	void addCollisionExitListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept;
+
+	void removeCollisionEnterListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept;
+	void removeCollisionStayListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept;
+	void removeCollisionExitListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept;
+
 	virtual GameComponentPtr clone() const noexcept;
 
 private:
@@ -107,9 +115,9 @@ private:
 	virtual void onDetachComponent(const GameComponentPtr& component) noexcept;
 
 	virtual void onCollisionChange() noexcept;
-	virtual void onCollisionEnter() noexcept;
-	virtual void onCollisionExit() noexcept;
-	virtual void onCollisionStay() noexcept;
+	virtual void onCollisionEnter(const PhysicsContact contacts[], std::size_t count) noexcept;
+	virtual void onCollisionStay(const PhysicsContact contacts[], std::size_t count) noexcept;
+	virtual void onCollisionExit(const PhysicsContact contacts[], std::size_t count) noexcept;
 
 	virtual void onMoveAfter() noexcept;
 
@@ -130,8 +138,16 @@ private:
 	delegate<void()> _onActivate;
 	delegate<void()> _onDeactivate;
 
+	delegate<void(const PhysicsContact[], std::size_t)> _onCollisionEnter;
+	delegate<void(const PhysicsContact[], std::size_t)> _onCollisionStay;
+	delegate<void(const PhysicsContact[], std::size_t)> _onCollisionExit;
+
 	std::function<void()> _onCollisionChange;
 
+	// move notifications are flushed after the fetch, a move that only carries the simulated transform isn't written back
+	bool _isFetchResult;
+	float4x4 _fetchTransform;
+
 	std::unique_ptr<PhysicsBody> _body;
 };
 
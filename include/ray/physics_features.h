@@ -54,6 +54,7 @@ private:
 	void onActivate() except;
 	void onDeactivate() noexcept;
 
+	void onFrameBegin() noexcept;
 	void onFrameEnd() noexcept;
 
 private:
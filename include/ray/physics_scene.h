@@ -38,6 +38,7 @@
 #define _H_PHYSICS_SECENE_H_
 
 #include <ray/physics_body.h>
+#include <ray/thread.h>
 
 _NAME_BEGIN
 
@@ -50,6 +51,9 @@ public:
 		float mass;
 		float speed;
 		float skinWidth;
+		float fixedTimeStep;
+		std::uint32_t maxSubSteps;
+		bool async;
 		Vector3 gravity;
 
 		AABB aabb;
@@ -69,14 +73,21 @@ public:
 	void setSpeed(float speed) noexcept;
 	void setSkitWindow(float width) noexcept;
 	void setGravity(const Vector3& gravity) noexcept;
+	void setFixedTimeStep(float step) noexcept;
+	void setMaxSubSteps(std::uint32_t steps) noexcept;
+	void setAsync(bool async) noexcept;
 
 	float getLength() const noexcept;
 	float getMass() const noexcept;
 	float getSpeed() const noexcept;
 	float getSkitWindow() const noexcept;
 	const Vector3& getGravity() const noexcept;
+	float getFixedTimeStep() const noexcept;
+	std::uint32_t getMaxSubSteps() const noexcept;
+	bool getAsync() const noexcept;
 
 	bool isFetchResult() const noexcept;
+	bool isSimulating() const noexcept;
 
 	void addJoint(btTypedConstraint* joint) noexcept;
 	void removeJoint(btTypedConstraint* joint) noexcept;
@@ -91,10 +102,43 @@ public:
 	void removeAction(btActionInterface* action) noexcept;
 
 	void simulation(float delta) noexcept;
+	void fetchResult() noexcept;
+	void wait() noexcept;
+
+private:
+	enum ContactType
+	{
+		ContactTypeEnter,
+		ContactTypeStay,
+		ContactTypeExit,
+	};
+
+	struct ContactPair
+	{
+		const btCollisionObject* object0;
+		const btCollisionObject* object1;
+
+		PhysicsContact contact;
+	};
+
+	struct ContactEvent
+	{
+		std::uint64_t key;
+		PhysicsBody* body;
+		std::uint8_t type;
+		bool swap;
+		std::uint32_t index;
+	};
+
+	void _simulation(float delta) noexcept;
+	void _updateContacts() noexcept;
+	void _dispatchContacts() noexcept;
 
 private:
 
 	bool _isFetchResult;
+	bool _isSimulating;
+	bool _needFetchResult;
 
 	Setting _setting;
 
@@ -105,6 +149,17 @@ private:
 	btDiscreteDynamicsWorld* _dynamicsWorld;
 
 	std::vector<PhysicsBody*> _rigidbodys;
+
+	std::vector<ContactPair> _contactPairs;
+	std::vector<ContactPair> _lastContactPairs;
+	std::vector<ContactEvent> _contactEvents;
+	std::vector<ContactEvent> _contactEventsTemp;
+
+	PhysicsContacts _contacts[3];
+	PhysicsContacts _contactBatch;
+
+	ThreadTaskGroup _simulationGroup;
+	std::unique_ptr<ThreadPool> _simulationThread;
 };
 
 _NAME_END
@@ -56,6 +56,7 @@ public:
 	PhysicsScenePtr getPhysicsScene() noexcept;
 
 	void simulation(float delta) noexcept;
+	void fetchResult() noexcept;
 
 private:
 	PhysicsScenePtr _scene;
@@ -0,0 +1,94 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef _H_RADIX_SORT_H_
+#define _H_RADIX_SORT_H_
+
+#include <ray/def.h>
+
+_NAME_BEGIN
+
+// Stable LSD radix sort of anything with a 64-bit `key` member, one 8-bit digit per pass.
+// A pass whose digit is the same for every element is skipped, so narrow keys cost fewer passes.
+template<typename _Ty>
+void radixSort64(std::vector<_Ty>& keys, std::vector<_Ty>& temp) noexcept
+{
+	std::size_t count = keys.size();
+	if (count < 2)
+		return;
+
+	std::size_t histogram[8][256];
+	std::memset(histogram, 0, sizeof(histogram));
+
+	for (auto& it : keys)
+	{
+		for (std::size_t pass = 0; pass < 8; pass++)
+			histogram[pass][(it.key >> (pass << 3)) & 0xFF]++;
+	}
+
+	temp.resize(count);
+
+	auto src = keys.data();
+	auto dst = temp.data();
+
+	for (std::size_t pass = 0; pass < 8; pass++)
+	{
+		std::size_t shift = pass << 3;
+
+		auto& offsets = histogram[pass];
+		if (offsets[(src[0].key >> shift) & 0xFF] == count)
+			continue;
+
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < 256; i++)
+		{
+			std::size_t size = offsets[i];
+			offsets[i] = offset;
+			offset += size;
+		}
+
+		for (std::size_t i = 0; i < count; i++)
+			dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+
+		std::swap(src, dst);
+	}
+
+	if (src != keys.data())
+		keys.swap(temp);
+}
+
+_NAME_END
+
+#endif
@@ -54,6 +54,7 @@ public:
 class EXPORT RenderObject : public rtti::Interface
 {
 	__DeclareSubInterface(RenderObject, rtti::Interface)
+	friend class RenderScene;
 public:
 	RenderObject() noexcept;
 	virtual ~RenderObject() noexcept;
@@ -67,10 +68,16 @@ public:
 	void setVisible(bool enable) noexcept;
 	bool getVisible() const noexcept;
 
+	void setStatic(bool enable) noexcept;
+	bool getStatic() const noexcept;
+
 	void setBoundingBox(const BoundingBox& bound) noexcept;
 	const BoundingBox& getBoundingBox() const noexcept;
 	const BoundingBox& getBoundingBoxInWorld() const noexcept;
 
+	void setOcclusionHull(const OcclusionHullPtr& hull) noexcept;
+	const OcclusionHullPtr& getOcclusionHull() const noexcept;
+
 	void setRenderScene(RenderScenePtr scene) noexcept;
 	const RenderScenePtr& getRenderScene() const noexcept;
 
@@ -100,17 +107,23 @@ public:
 
 private:
 	bool _visible;
+	bool _static;
 
 	std::uint8_t _layer;
 
 	BoundingBox _boundingBox;
 	BoundingBox _worldBoundingxBox;
 
+	OcclusionHullPtr _occlusionHull;
+
 	float4x4 _transform;
 	float4x4 _transformInverse;
 
 	RenderListener* _renderListener;
 	RenderScenePtr  _renderScene;
+
+	std::int32_t _renderSceneProxy;
+	std::int32_t _renderSceneIndex;
 };
 
 _NAME_END
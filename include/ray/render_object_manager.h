@@ -39,9 +39,18 @@
 
 #include <ray/render_scene.h>
 #include <ray/render_object_manager_base.h>
+#include <ray/occlusion_buffer.h>
 
 _NAME_BEGIN
 
+struct RenderDrawKey
+{
+	std::uint64_t key;
+	RenderObject* object;
+};
+
+typedef std::vector<RenderDrawKey> RenderDrawKeys;
+
 class DefaultRenderDataManager final : public RenderDataManager
 {
 public:
@@ -56,14 +65,31 @@ public:
 	void noticeObjectsRenderBefore(const Camera& camera) noexcept;
 	void noticeObjectsRenderAfter(const Camera& camera) noexcept;
 
+	void collectStatistics(RenderStatistics& statistics) const noexcept;
+
 private:
-	void sortMaterial(RenderObjectRaws& list) noexcept;
-	void sortMaterialDistance(RenderObjectRaws& list) noexcept;
-	void sortDistance(OcclusionCullList& list) noexcept;
+	void computeOcclusion(const Camera& camera) noexcept;
+
+	std::uint64_t makeRenderKey(RenderQueue queue, RenderObject* object) const noexcept;
 
 private:
+	float _visiableDepth;
+
 	OcclusionCullList _visiable;
+	RenderObjectMasks _visiableMask;
 	RenderObjectRaws _renderQueue[RenderQueue::RenderQueueRangeSize];
+	RenderDrawKeys _renderKeys[RenderQueue::RenderQueueRangeSize];
+	RenderDrawKeys _renderKeysTemp;
+
+	OcclusionBuffer _occlusionBuffer;
+	std::vector<std::pair<float, RenderObject*>> _occluders;
+	std::vector<std::uint8_t> _occludedMask;
+
+	std::uint32_t _numOccluders;
+	std::uint32_t _numOccluderTriangles;
+	std::uint32_t _numOccludees;
+	std::uint32_t _numOccluded;
+	double _occlusionTime;
 };
 
 _NAME_END
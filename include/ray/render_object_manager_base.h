@@ -37,7 +37,7 @@
 #ifndef _H_RENDER_PIPELINE_MANAGER_BASE_H_
 #define _H_RENDER_PIPELINE_MANAGER_BASE_H_
 
-#include <ray/render_types.h>
+#include <ray/render_setting.h>
 
 _NAME_BEGIN
 
@@ -54,6 +54,8 @@ public:
 
 	virtual void noticeObjectsRenderBefore(const Camera& camera) noexcept = 0;
 	virtual void noticeObjectsRenderAfter(const Camera& camera) noexcept = 0;
+
+	virtual void collectStatistics(RenderStatistics& statistics) const noexcept;
 };
 
 _NAME_END
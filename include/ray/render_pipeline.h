@@ -100,6 +100,11 @@ public:
 	void drawRenderQueue(RenderQueue queue) noexcept;
 	void drawRenderQueue(RenderQueue queue, const MaterialTechPtr& tech) noexcept;
 
+	std::uint32_t getDrawCallCount() const noexcept;
+	std::uint32_t getDrawInstanceCount() const noexcept;
+	std::uint32_t getUniformUploadBytes() const noexcept;
+	std::uint32_t getUniformUploadSkips() const noexcept;
+
 	void addPostProcess(RenderPostProcessPtr& postprocess) noexcept;
 	void removePostProcess(RenderPostProcessPtr& postprocess) noexcept;
 	bool drawPostProcess(RenderQueue queue, const GraphicsFramebufferPtr& source, const GraphicsFramebufferPtr& swap) noexcept;
@@ -136,6 +141,12 @@ private:
 	void destroyMaterialSemantic() noexcept;
 	void destroyBaseMeshes() noexcept;
 	void destroyDataManager() noexcept;
+	void destroyInstanceData() noexcept;
+	void destroyModelData() noexcept;
+
+	void drawRenderObjects(RenderQueue queue, MaterialTech* tech) noexcept;
+	bool updateInstanceData(std::intptr_t& offset) noexcept;
+	bool updateModelData() noexcept;
 
 	void makePlane(float width, float height, std::uint32_t widthSegments, std::uint32_t heightSegments) noexcept;
 	void makeCone(float radius, float height, std::uint32_t segments, float thetaStart = 0, float thetaLength = M_TWO_PI) noexcept;
@@ -146,6 +157,14 @@ private:
 	RenderPipeline& operator=(const RenderPipeline&) = delete;
 
 private:
+	struct InstanceBatch
+	{
+		std::size_t first;
+		std::size_t count;
+		std::intptr_t offset;
+		MaterialTech* tech;
+	};
+
 	std::uint32_t _width;
 	std::uint32_t _height;
 
@@ -175,6 +194,17 @@ private:
 	GraphicsIndexType _coneIndexType;
 	std::uint32_t _coneIndices;
 
+	std::uint32_t _drawCalls;
+	std::uint32_t _drawInstances;
+
+	std::size_t _instanceOffset;
+	GraphicsDataPtr _instanceData;
+	std::vector<float4x4> _instanceTransforms;
+	std::vector<InstanceBatch> _instanceBatchs;
+
+	bool _modelDataDirty;
+	GraphicsDataPtr _modelData;
+
 	MaterialSemanticManagerPtr _semanticsManager;
 
 	RenderDataManagerPtr _dataManager;
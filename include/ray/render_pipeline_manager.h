@@ -67,6 +67,8 @@ public:
 	bool setRenderSetting(const RenderSetting& setting) noexcept;
 	const RenderSetting& getRenderSetting() const noexcept;
 
+	const RenderStatistics& getRenderStatistics() const noexcept;
+
 	void addPostProcess(RenderPostProcessPtr postprocess) noexcept;
 	void removePostProcess(RenderPostProcessPtr postprocess) noexcept;
 	void destroyPostProcess() noexcept;
@@ -79,12 +81,16 @@ private:
 	bool setupShadowRenderer(RenderPipelinePtr pipeline, const RenderSetting& setting) noexcept;
 	void destroyShadowRenderer() noexcept;
 
+	void assginVisiable(const RenderScene& scene) noexcept;
+	void assginVisiable(const CameraRaws& cameras) noexcept;
+
 private:
 	RenderPipelineManager(const RenderPipelineManager&) noexcept = delete;
 	RenderPipelineManager& operator = (const RenderPipelineManager&) noexcept = delete;
 
 private:
 	RenderSetting _setting;
+	RenderStatistics _statistics;
 	RenderPostProcessPtr _SSGI;
 	RenderPostProcessPtr _SSDO;
 	RenderPostProcessPtr _SSSS;
@@ -103,6 +109,8 @@ private:
 	RenderPipelineControllerPtr _lightProbeGen;
 	RenderPipelineControllerPtr _deferredLighting;
 	RenderPipelineControllerPtr _shadowMapGen;
+
+	CameraRaws _visiableCameras;
 };
 
 _NAME_END
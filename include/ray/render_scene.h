@@ -38,6 +38,7 @@
 #define _H_RENDER_SCENE_H_
 
 #include <ray/render_types.h>
+#include <ray/aabb_tree.h>
 
 _NAME_BEGIN
 
@@ -101,9 +102,17 @@ public:
 
 	void addRenderObject(RenderObject* object) except;
 	void removeRenderObject(RenderObject* object) noexcept;
+	void moveRenderObject(RenderObject* object) noexcept;
+
+	const RenderObjectRaws& getRenderObjectList() const noexcept;
+
+	void addStaticChange(const AABB& aabb) noexcept;
+	std::uint32_t getStaticVersion() const noexcept;
+	bool isStaticChanged(const AABB& aabb, std::uint32_t version) const noexcept;
 
 	void computVisiable(const Camera& camera, OcclusionCullList& list) except;
 	void computVisiableLight(const Camera& camera, OcclusionCullList& list) except;
+	void computVisiableMask(const Frustum& fru, RenderObjectMasks& masks) const noexcept;
 
 	void onRenderBefore() except;
 	void onRenderAfter() except;
@@ -114,6 +123,10 @@ private:
 	void addRenderScene(RenderScene* _this) except;
 	void removeRenderScene(RenderScene* _this) noexcept;
 
+	void updateBoundsCache(std::size_t index, const AABB& aabb) noexcept;
+
+	static AABB computeProxyBound(const RenderObject& object) noexcept;
+
 private:
 	bool _visible;
 
@@ -122,6 +135,15 @@ private:
 
 	RenderObjectRaws _renderObjectList;
 
+	AABBTree<RenderObject*> _renderObjectTree;
+	AABBTree<RenderObject*> _lightTree;
+
+	std::vector<float> _boundsCenter[3];
+	std::vector<float> _boundsExtent[3];
+
+	std::uint32_t _staticVersion;
+	std::vector<AABB> _staticChanges;
+
 	static RenderScenes _sceneList;
 };
 
@@ -69,6 +69,8 @@ struct EXPORT RenderSetting
 	bool enableLightShaft;
 	bool enableColorGrading;
 	bool enableGlobalIllumination;
+	bool enableClusteredLighting;
+	bool enableInstancing;
 
 	float2 earthRadius;
 	float2 earthScaleHeight;
@@ -91,6 +93,34 @@ private:
 	void computeScatteringCoefficients() noexcept;
 };
 
+struct EXPORT RenderStatistics
+{
+	double visiableTime;
+	double shadowTime;
+	double lightProbeTime;
+	double deferredTime;
+	double forwardTime;
+	double presentTime;
+	double occlusionTime;
+	double shadowCascadeCullTime[LightShadowCascade::LightShadowCascadeMax];
+	double shadowCascadeDrawTime[LightShadowCascade::LightShadowCascadeMax];
+
+	std::uint32_t numCameras;
+	std::uint32_t drawCalls;
+	std::uint32_t drawInstances;
+	std::uint32_t uniformUploadBytes;
+	std::uint32_t uniformUploadSkips;
+	std::uint32_t numOccluders;
+	std::uint32_t numOccluderTriangles;
+	std::uint32_t numOccludees;
+	std::uint32_t numOccluded;
+	std::uint32_t shadowDrawCalls;
+	std::uint32_t numShadowUpdates;
+	std::uint32_t numShadowCached;
+
+	RenderStatistics() noexcept;
+};
+
 _NAME_END
 
 #endif
\ No newline at end of file
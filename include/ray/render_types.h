@@ -71,6 +71,7 @@ typedef std::shared_ptr<class RenderPipelineDevice> RenderPipelineDevicePtr;
 typedef std::shared_ptr<class RenderPipelineController> RenderPipelineControllerPtr;
 typedef std::shared_ptr<class RenderPipelineManager> RenderPipelineManagerPtr;
 typedef std::shared_ptr<class RenderPipelineFramebuffer> RenderPipelineFramebufferPtr;
+typedef std::shared_ptr<class OcclusionHull> OcclusionHullPtr;
 
 typedef std::weak_ptr<class Material> MaterialWeakPtr;
 typedef std::weak_ptr<class MaterialPass> MaterialPassWeakPtr;
@@ -114,6 +115,7 @@ typedef std::map<std::string, MaterialParamPtr> MaterialParams;
 
 typedef std::vector<Camera*> CameraRaws;
 typedef std::vector<RenderObject*> RenderObjectRaws;
+typedef std::vector<std::uint32_t> RenderObjectMasks;
 
 enum class CameraType : std::uint8_t
 {
@@ -206,6 +208,12 @@ enum LightShadowSize
 	LightShadowSizeEnumCount = 4
 };
 
+enum LightShadowCascade
+{
+	LightShadowCascadeMin = 1,
+	LightShadowCascadeMax = 4
+};
+
 enum class RenderPipelineType : std::uint8_t
 {
 	RenderPipelineTypeForward,
@@ -220,6 +228,7 @@ enum RenderQueue
 {
 	RenderQueueCustom,
 	RenderQueueShadow,
+	RenderQueueStaticShadow,
 	RenderQueueReflectiveShadow,
 	RenderQueueOpaque,
 	RenderQueueOpaqueBatch,
@@ -261,6 +270,7 @@ enum GlobalSemanticType
 	GlobalSemanticTypeModelView,
 	GlobalSemanticTypeModelViewProject,
 	GlobalSemanticTypeModelViewInverse,
+	GlobalSemanticTypeModelBuffer,
 	GlobalSemanticTypeCameraAperture,
 	GlobalSemanticTypeCameraNear,
 	GlobalSemanticTypeCameraFar,
@@ -41,9 +41,15 @@
 #include <ray/render_types.h>
 #include <ray/game_types.h>
 #include <ray/modhelp.h>
+#include <ray/thread.h>
 
 _NAME_BEGIN
 
+namespace image
+{
+	class Image;
+}
+
 enum ModelMakerFlagBits
 {
 	ModelMakerFlagBitVertex = 0x00000001,
@@ -59,6 +65,55 @@ enum ModelMakerFlagBits
 
 typedef std::uint32_t ModelMakerFlags;
 
+enum ResStreamState
+{
+	ResStreamStatePending = 0,
+	ResStreamStateLoaded = 1,
+	ResStreamStateResident = 2,
+	ResStreamStateFailed = 3,
+};
+
+typedef std::shared_ptr<class ResStreamRequest> ResStreamRequestPtr;
+typedef std::function<void(const ResStreamRequest&)> ResStreamCallback;
+
+class EXPORT ResStreamRequest final
+{
+public:
+	ResStreamRequest() noexcept;
+	~ResStreamRequest() noexcept;
+
+	const util::string& getName() const noexcept;
+	ResStreamState getState() const noexcept;
+
+	bool isDone() const noexcept;
+	bool isResident() const noexcept;
+
+	const GraphicsTexturePtr& getTexture() const noexcept;
+	const ModelPtr& getModel() const noexcept;
+
+private:
+	friend class ResManager;
+
+	ResStreamRequest(const ResStreamRequest&) = delete;
+	ResStreamRequest& operator=(const ResStreamRequest&) = delete;
+
+private:
+	util::string _name;
+	std::atomic<ResStreamState> _state;
+
+	bool _cache;
+	GraphicsTextureDim _dim;
+	GraphicsSamplerFilter _filter;
+	GraphicsSamplerWrap _wrap;
+
+	std::unique_ptr<image::Image> _image;
+
+	GraphicsTexturePtr _texture;
+	ModelPtr _model;
+
+	std::vector<ResStreamCallback> _callbacks;
+};
+
 class EXPORT ResManager final
 {
 	__DeclareSingleton(ResManager)
@@ -71,15 +126,19 @@ public:
 	bool createTexture(const util::string& path, GraphicsTexturePtr& texture, GraphicsTextureDim dim = GraphicsTextureDim::GraphicsTextureDim2D, GraphicsSamplerFilter filter = GraphicsSamplerFilter::GraphicsSamplerFilterLinear, GraphicsSamplerWrap warp = GraphicsSamplerWrap::GraphicsSamplerWrapRepeat, bool cache = true) noexcept;
 	bool createAnimation(const util::string& path, const GameObjects& bones, GameComponentPtr& animation) noexcept;
 
+	ResStreamRequestPtr createModelAsync(const util::string& path, ResStreamCallback callback = nullptr) noexcept;
+	ResStreamRequestPtr createTextureAsync(const util::string& path, GraphicsTextureDim dim = GraphicsTextureDim::GraphicsTextureDim2D, GraphicsSamplerFilter filter = GraphicsSamplerFilter::GraphicsSamplerFilterLinear, GraphicsSamplerWrap warp = GraphicsSamplerWrap::GraphicsSamplerWrapRepeat, bool cache = true, ResStreamCallback callback = nullptr) noexcept;
+
 	bool createGameObject(const Model& model, GameObjectPtr& gameObject) noexcept;
 	bool createMeshes(const Model& model, GameObjectPtr& meshes) noexcept;
 	bool createBones(const Model& model, GameObjects& bones) noexcept;
 	bool createMaterials(const Model& model, Materials& materials, bool skinned = true) noexcept;
+	bool createMaterialsAsync(const Model& model, Materials& materials, bool skinned = true) noexcept;
 	bool createRigidbodys(const Model& model, GameObjects& rigidbodys) noexcept;
 	bool createRigidbodyToBone(const Model& model, const GameObjects& bones, GameObjects& rigidbodys);
 	bool createJoints(const Model& model, const GameObjects& rigidbodys, GameObjects& joints) noexcept;
 
-	GraphicsDataPtr createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags) noexcept;
+	GraphicsDataPtr createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags, bool compressed = false) noexcept;
 	GraphicsDataPtr createIndexBuffer(const MeshProperty& mesh) noexcept;
 
 	GraphicsTexturePtr getTexture(const util::string& name) const noexcept;
@@ -90,8 +149,31 @@ public:
 	void destroyTexture(GraphicsTexturePtr texture) noexcept;
 	void destroyTexture(const util::string& name) noexcept;
 
+	void setVertexCompression(bool enable) noexcept;
+	bool getVertexCompression() const noexcept;
+
+	void setStreamUploadBudget(std::size_t bytes) noexcept;
+	std::size_t getStreamUploadBudget() const noexcept;
+
+	std::size_t getStreamPendingCount() const noexcept;
+	std::size_t getStreamUploadBytes() const noexcept;
+
+	void updateStream() noexcept;
+	void closeStream() noexcept;
+
 private:
-	MaterialPtr _buildDefaultMaterials(const MaterialProperty& material, const util::string& file, const util::string& directory) noexcept;
+	bool _loadImage(const util::string& name, image::Image& image) noexcept;
+	bool _loadModel(const util::string& name, Model& model) noexcept;
+
+	GraphicsTexturePtr _buildTexture(const image::Image& image, GraphicsTextureDim dim, GraphicsSamplerFilter filter, GraphicsSamplerWrap warp) noexcept;
+	GraphicsTexturePtr _buildPlaceholderTexture() noexcept;
+
+	bool _isVertexCompressible(const Model& model) const noexcept;
+
+	bool _buildMaterials(const Model& model, Materials& materials, bool skinned, bool async) noexcept;
+	MaterialPtr _buildDefaultMaterials(const MaterialProperty& material, const util::string& file, const util::string& directory, bool async) noexcept;
+
+	void _streamRequest(const ResStreamRequestPtr& request, std::function<void(void)>&& func) noexcept;
 
 private:
 	ResManager(const ResManager&) = delete;
@@ -100,6 +182,21 @@ private:
 private:
 	GraphicsTextures _textures;
 	std::map<util::string, GraphicsTexturePtr> _textureCaches;
+
+	GraphicsTexturePtr _placeholderTexture;
+
+	bool _vertexCompression;
+
+	std::size_t _streamUploadBudget;
+	std::size_t _streamUploadBytes;
+	std::size_t _streamPending;
+
+	std::mutex _streamMutex;
+	std::vector<ResStreamRequestPtr> _streamReady;
+	std::map<util::string, ResStreamRequestPtr> _streamRequests;
+
+	ThreadTaskGroup _streamGroup;
+	std::unique_ptr<ThreadPool> _streamThreads;
 };
 
 _NAME_END
@@ -0,0 +1,121 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_SHADOW_ATLAS_H_
+#define _H_SHADOW_ATLAS_H_
+
+#include <ray/render_types.h>
+
+_NAME_BEGIN
+
+struct EXPORT ShadowAtlasTile
+{
+	std::uint64_t owner;
+
+	std::uint32_t lastUsed;
+	std::uint32_t lastUpdate;
+	std::uint32_t staticVersion;
+
+	bool valid;
+	bool staticValid;
+	bool dynamicCasters;
+
+	float4x4 viewProject;
+
+	ShadowAtlasTile() noexcept;
+};
+
+class EXPORT ShadowAtlas final
+{
+public:
+	ShadowAtlas() noexcept;
+	~ShadowAtlas() noexcept;
+
+	void setup(std::uint32_t atlasSize, std::uint32_t tileSize, std::uint32_t minTileSize) noexcept;
+	void close() noexcept;
+
+	std::uint32_t getAtlasSize() const noexcept;
+	std::uint32_t getTileSize() const noexcept;
+	std::uint32_t getMinTileSize() const noexcept;
+	std::uint32_t getNumTiles() const noexcept;
+
+	std::int32_t acquire(std::uint64_t owner, std::int32_t hint, std::uint32_t frame, std::uint32_t size, bool& allocated) noexcept;
+	void release(std::int32_t index) noexcept;
+
+	ShadowAtlasTile& getTile(std::int32_t index) noexcept;
+	const ShadowAtlasTile& getTile(std::int32_t index) const noexcept;
+
+	std::uint32_t getTileSize(std::int32_t index) const noexcept;
+	uint4 getTileViewport(std::int32_t index) const noexcept;
+	float4 getTileCoord(std::int32_t index) const noexcept;
+
+private:
+	std::int32_t allocate(std::uint32_t size, std::uint32_t before) noexcept;
+	std::int32_t split(std::int32_t index, std::uint32_t size) noexcept;
+	void merge(std::int32_t index) noexcept;
+
+	bool isActive(std::int32_t index) const noexcept;
+	bool isFree(std::int32_t index) const noexcept;
+
+private:
+	ShadowAtlas(const ShadowAtlas&) = delete;
+	ShadowAtlas& operator=(const ShadowAtlas&) = delete;
+
+private:
+	// the atlas is a quadtree, every tile can be split into four tiles of half the size down to the smallest tile size
+	struct ShadowAtlasNode
+	{
+		std::uint32_t x;
+		std::uint32_t y;
+		std::uint32_t size;
+
+		std::int32_t parent;
+		std::int32_t child;
+
+		bool split;
+	};
+
+	std::uint32_t _atlasSize;
+	std::uint32_t _tileSize;
+	std::uint32_t _minTileSize;
+
+	std::vector<ShadowAtlasNode> _nodes;
+	std::vector<ShadowAtlasTile> _tiles;
+};
+
+_NAME_END
+
+#endif
\ No newline at end of file
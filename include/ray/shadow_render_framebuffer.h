@@ -50,6 +50,17 @@ public:
 
 	bool setup();
 
+	std::uint64_t getAtlasOwner() const noexcept;
+
+	void setAtlasTile(std::int32_t tile, const uint4& viewport, const float4& coord) noexcept;
+	std::int32_t getAtlasTile() const noexcept;
+
+	const uint4& getAtlasViewport() const noexcept;
+	const float4& getAtlasCoord() const noexcept;
+
+	void setShadowUpdate(bool update) noexcept;
+	bool getShadowUpdate() const noexcept;
+
 protected:
 	virtual void onResolutionChange() noexcept;
 	virtual void onResolutionChangeDPI() noexcept;
@@ -63,9 +74,13 @@ private:
 	ShadowRenderFramebuffer& operator=(const ShadowRenderFramebuffer&) noexcept = delete;
 
 private:
-	GraphicsTexturePtr _shadowDepthLinearMap;
-	GraphicsFramebufferPtr _shadowDepthLinearView;
-	GraphicsFramebufferLayoutPtr _shadowDepthLinearViewLayout;
+	std::uint64_t _atlasOwner;
+	std::int32_t _atlasTile;
+
+	uint4 _atlasViewport;
+	float4 _atlasCoord;
+
+	bool _shadowUpdate;
 };
 
 _NAME_END
@@ -56,6 +56,9 @@ public:
 	void setTransforms(GameObjects&& transforms) noexcept;
 	const GameObjects& getTransforms() const noexcept;
 
+private:
+	AnimationPosePtr _getPose() noexcept;
+
 private:
 	virtual void onActivate() except;
 	virtual void onDeactivate() noexcept;
@@ -66,6 +69,8 @@ private:
 	virtual void onMeshChange() noexcept;
 	virtual void onMeshWillRender(const class Camera&) noexcept;
 
+	virtual void onPoseUpdate(const AnimationPose& pose) noexcept;
+
 	virtual void onFrameEnd() noexcept;
 
 private:
@@ -76,8 +81,13 @@ private:
 	BoundingBox _boundingBox;
 	MeshPropertyPtr _mesh;
 
+	std::size_t _paletteVersion;
+	std::vector<float4x4> _palette;
+	BoundingBox _paletteBoundingBox;
+
 	std::function<void()> _onMeshChange;
 	std::function<void(const Camera&)> _onMeshWillRender;
+	std::function<void(const AnimationPose&)> _onPoseUpdate;
 };
 
 _NAME_END
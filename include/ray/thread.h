@@ -38,60 +38,91 @@
 #define _H_THREAD_H_
 
 #include <ray/platform.h>
+#include <ray/singleton.h>
 
 #include <thread>
 #include <mutex>
 #include <atomic>
 #include <queue>
+#include <deque>
 #include <condition_variable>
 
 _NAME_BEGIN
 
-class EXPORT ThreadLambda final
+class EXPORT ThreadTaskGroup final
 {
 public:
-	ThreadLambda() noexcept;
-	~ThreadLambda() noexcept;
+	ThreadTaskGroup() noexcept;
+	~ThreadTaskGroup() noexcept;
 
-	void start() noexcept;
-	void stop() noexcept;
+	bool done() const noexcept;
+
+	std::exception_ptr exception() const noexcept;
 
-	void exce(std::function<void(void)>& func) noexcept;
-	void exce(std::function<void(void)>&& func) noexcept;
+private:
+	friend class ThreadPool;
 
-	void join() noexcept;
+	ThreadTaskGroup(const ThreadTaskGroup&) = delete;
+	ThreadTaskGroup& operator=(const ThreadTaskGroup&) = delete;
 
-	void flush() noexcept;
-	void finish() noexcept;
+private:
+	std::atomic<std::size_t> _pending;
 
-	std::exception_ptr exception() const noexcept;
+	mutable std::mutex _mutex;
+	std::exception_ptr _exception;
+};
+
+class EXPORT ThreadPool final
+{
+	__DeclareSingleton(ThreadPool)
+public:
+	ThreadPool() noexcept;
+	~ThreadPool() noexcept;
+
+	void start(std::size_t threads = 0) noexcept;
+	void stop() noexcept;
+
+	std::size_t getThreadCount() const noexcept;
+
+	void exce(ThreadTaskGroup& group, std::function<void(void)>&& func) noexcept;
+	void exce(ThreadTaskGroup& group, std::size_t count, const std::function<void(std::size_t)>& func) noexcept;
+
+	void wait(ThreadTaskGroup& group) noexcept;
 
 private:
+	struct ThreadTask
+	{
+		std::function<void(void)> func;
+		ThreadTaskGroup* group;
+	};
 
-	void signalQuitCond() noexcept;
-	void signalFlushCond() noexcept;
-	void signalFlushFinishCond() noexcept;
+	struct ThreadQueue
+	{
+		std::mutex mutex;
+		std::deque<ThreadTask> tasks;
+	};
 
-	void waitFlushCond() noexcept;
-	void waitFlushFinishedCond() noexcept;
+	void push(ThreadTask&& task) noexcept;
+	bool pop(ThreadTask& task) noexcept;
 
-	void dispose() noexcept;
+	void execute(ThreadTask& task) noexcept;
+
+	void dispose(std::size_t index) noexcept;
 
 private:
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
 
+private:
 	std::mutex _mutex;
-	std::condition_variable _flushRequest;
-	std::condition_variable _finishRequest;
+	std::condition_variable _taskRequest;
 
 	std::atomic<bool> _isQuitRequest;
-	std::atomic<bool> _isFlushRequest;
-
-	std::exception_ptr _exception;
-
-	std::unique_ptr<std::thread> _thread;
+	std::atomic<std::size_t> _taskCount;
+	std::atomic<std::size_t> _taskNext;
 
-	std::vector<std::function<void(void)>> _taskUpdate;
-	std::vector<std::function<void(void)>> _taskDispose;
+	std::vector<std::unique_ptr<ThreadQueue>> _queues;
+	std::vector<std::unique_ptr<std::thread>> _threads;
 };
 
 _NAME_END
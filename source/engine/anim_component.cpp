@@ -43,6 +43,7 @@
 #include <ray/game_server.h>
 #include <ray/render_component.h>
 #include <ray/ik_solver_component.h>
+#include <ray/anim_manager.h>
 
 _NAME_BEGIN
 
@@ -53,6 +54,10 @@ AnimationComponent::AnimationComponent() noexcept
 	, _enableAnimOnVisableOnly(false)
 	, _enablePhysics(false)
 	, _needUpdate(false)
+	, _enableTransformSync(false)
+	, _needTransformSync(false)
+	, _syncVersion(0)
+	, _hierarchyVersion(0)
 	, _onMeshChange(std::bind(&AnimationComponent::onMeshChange, this))
 	, _onMeshWillRender(std::bind(&AnimationComponent::onMeshWillRender, this, std::placeholders::_1))
 {
@@ -128,6 +133,55 @@ AnimationComponent::getTransforms() const noexcept
 	return _transforms;
 }
 
+void
+AnimationComponent::enableTransformSync(bool sync) noexcept
+{
+	_enableTransformSync = sync;
+}
+
+bool
+AnimationComponent::enableTransformSync() const noexcept
+{
+	return _enableTransformSync;
+}
+
+AnimationPosePtr
+AnimationComponent::getPose() const noexcept
+{
+	return _animtion ? _animtion->getPose() : nullptr;
+}
+
+void
+AnimationComponent::syncTransforms() noexcept
+{
+	if (!_animtion)
+		return;
+
+	auto& pose = _animtion->getPose();
+	if (pose->getVersion() == _syncVersion)
+		return;
+
+	std::size_t size = std::min(pose->getNumBones(), _transforms.size());
+	for (std::size_t i = 0; i < size; i++)
+		_transforms[i]->setWorldTransformOnlyRotate(pose->getWorldTransform(i));
+
+	_syncVersion = pose->getVersion();
+}
+
+void
+AnimationComponent::addPoseUpdateListener(std::function<void(const AnimationPose&)>* func) noexcept
+{
+	assert(!_onPoseUpdate.find(func));
+	_onPoseUpdate.attach(func);
+}
+
+void
+AnimationComponent::removePoseUpdateListener(std::function<void(const AnimationPose&)>* func) noexcept
+{
+	assert(_onPoseUpdate.find(func));
+	_onPoseUpdate.remove(func);
+}
+
 GameComponentPtr
 AnimationComponent::clone() const noexcept
 {
@@ -142,7 +196,7 @@ AnimationComponent::onActivate() except
 	if (!_enableAnimation)
 		_playAnimation(this->getName());
 
-	this->addComponentDispatch(GameDispatchType::GameDispatchTypeFrameEnd, this);
+	AnimationManager::instance()->_addAnimation(this);
 }
 
 void
@@ -150,7 +204,7 @@ AnimationComponent::onDeactivate() noexcept
 {
 	_destroyAnimation();
 
-	this->removeComponentDispatch(GameDispatchType::GameDispatchTypeFrameEnd, this);
+	AnimationManager::instance()->_removeAnimation(this);
 }
 
 void
@@ -167,15 +221,6 @@ AnimationComponent::onDetachComponent(const GameComponentPtr& component) noexcep
 		component->downcast<RenderComponent>()->removePreRenderListener(&_onMeshWillRender);
 }
 
-void
-AnimationComponent::onFrameEnd() noexcept
-{
-	if (_enableAnimation && !_enableAnimOnVisableOnly)
-		_updateAnimation();
-	else
-		_needUpdate = true;
-}
-
 void
 AnimationComponent::onMeshChange() noexcept
 {
@@ -223,6 +268,8 @@ AnimationComponent::_playAnimation(const util::string& filename) noexcept
 		boneMap[it->getName()] = i++;
 	}
 
+	this->_updateTransformSync(true);
+
 	std::size_t index = 0;
 
 	std::vector<Bone> bones;
@@ -272,21 +319,75 @@ AnimationComponent::_playAnimation(const util::string& filename) noexcept
 	_animtion->setIKArray(iks);
 	_animtion->updateMotion();
 
+	_onPoseUpdate.run(*_animtion->getPose());
+
+	_syncVersion = 0;
+	this->syncTransforms();
+
 	_enableAnimation = true;
 	return true;
 }
 
 void
 AnimationComponent::_updateAnimation() noexcept
+{
+	this->_updatePose(GameServer::instance()->getTimer()->delta());
+	this->_updateTransforms();
+}
+
+void
+AnimationComponent::_updatePose(float delta) noexcept
 {
 	if (_animtion)
 	{
-		_animtion->updateFrame(GameServer::instance()->getTimer()->delta());
+		_animtion->updateFrame(delta);
 		_animtion->updateMotion();
 
-		std::size_t i = 0;
-		for (auto& it : _animtion->getBoneArray())
-			_transforms[i++]->setWorldTransformOnlyRotate(it.getTransform());
+		_onPoseUpdate.run(*_animtion->getPose());
+	}
+}
+
+void
+AnimationComponent::_updateTransforms() noexcept
+{
+	if (!_enableTransformSync)
+		this->_updateTransformSync(false);
+
+	if (_enableTransformSync || _needTransformSync)
+		this->syncTransforms();
+}
+
+void
+AnimationComponent::_updateTransformSync(bool force) noexcept
+{
+	// a bone only has to be synced when something other than the skeleton hangs off it, re-check whenever a bone gains or loses a child or component
+	std::size_t version = 0;
+	for (auto& it : _transforms)
+		version += it->getHierarchyVersion();
+
+	if (!force && version == _hierarchyVersion)
+		return;
+
+	_hierarchyVersion = version;
+	_needTransformSync = false;
+
+	std::map<util::string, std::intptr_t> boneMap;
+	for (auto& it : _transforms)
+		boneMap[it->getName()] = 0;
+
+	for (auto& it : _transforms)
+	{
+		for (auto& child : it->getChildren())
+		{
+			if (boneMap.find(child->getName()) == boneMap.end())
+				_needTransformSync = true;
+		}
+
+		for (auto& component : it->getComponents())
+		{
+			if (!component->isA<IKSolverComponent>())
+				_needTransformSync = true;
+		}
 	}
 }
 
@@ -0,0 +1,120 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/anim_manager.h>
+#include <ray/anim_component.h>
+#include <ray/game_server.h>
+
+_NAME_BEGIN
+
+__ImplementSingleton(AnimationManager)
+
+AnimationManager::AnimationManager() noexcept
+	: _parallelThreshold(2)
+{
+}
+
+AnimationManager::~AnimationManager() noexcept
+{
+}
+
+void
+AnimationManager::setParallelThreshold(std::size_t count) noexcept
+{
+	_parallelThreshold = count;
+}
+
+std::size_t
+AnimationManager::getParallelThreshold() const noexcept
+{
+	return _parallelThreshold;
+}
+
+std::size_t
+AnimationManager::getNumAnimations() const noexcept
+{
+	return _animations.size();
+}
+
+void
+AnimationManager::onFrameEnd() noexcept
+{
+	_updates.clear();
+
+	for (auto& it : _animations)
+	{
+		if (it->_enableAnimation && !it->_enableAnimOnVisableOnly)
+			_updates.push_back(it);
+		else
+			it->_needUpdate = true;
+	}
+
+	if (_updates.empty())
+		return;
+
+	float delta = GameServer::instance()->getTimer()->delta();
+
+	if (_updates.size() >= _parallelThreshold)
+	{
+		ThreadPool::instance()->exce(_group, _updates.size(), [&](std::size_t i) { _updates[i]->_updatePose(delta); });
+		ThreadPool::instance()->wait(_group);
+	}
+	else
+	{
+		for (auto& it : _updates)
+			it->_updatePose(delta);
+	}
+
+	for (auto& it : _updates)
+		it->_updateTransforms();
+}
+
+void
+AnimationManager::_addAnimation(AnimationComponent* component) noexcept
+{
+	assert(std::find(_animations.begin(), _animations.end(), component) == _animations.end());
+	_animations.push_back(component);
+}
+
+void
+AnimationManager::_removeAnimation(AnimationComponent* component) noexcept
+{
+	auto it = std::find(_animations.begin(), _animations.end(), component);
+	if (it != _animations.end())
+		_animations.erase(it);
+}
+
+_NAME_END
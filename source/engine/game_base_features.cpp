@@ -37,6 +37,7 @@
 #include <ray/game_base_features.h>
 #include <ray/game_object_manager.h>
 #include <ray/game_scene_manager.h>
+#include <ray/anim_manager.h>
 
 _NAME_BEGIN
 
@@ -81,6 +82,7 @@ void
 GameBaseFeatures::onFrameEnd() noexcept
 {
 	GameSceneManager::instance()->onFrameEnd();
+	AnimationManager::instance()->onFrameEnd();
 	GameObjectManager::instance()->onFrameEnd();
 }
 
@@ -35,6 +35,7 @@
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
 #include <ray/game_component.h>
+#include <ray/game_object_manager.h>
 #include <ray/utf8.h>
 
 _NAME_BEGIN
@@ -44,10 +45,12 @@ __ImplementSubInterface(GameComponent, MessageListener, "Component")
 GameComponent::GameComponent() noexcept
 	: _active(true)
 	, _gameObject(nullptr)
+	, _componentIndex(0)
 {
 }
 
 GameComponent::GameComponent(const archivebuf& reader) noexcept
+	: GameComponent()
 {
 	this->load(reader);
 }
@@ -107,7 +110,13 @@ GameComponent::removeComponentDispatch(GameDispatchType type, GameComponent* com
 void
 GameComponent::_setGameObject(GameObject* gameobj) noexcept
 {
+	if (_gameObject)
+		GameObjectManager::instance()->_removeComponent(this);
+
 	_gameObject = gameobj;
+
+	if (_gameObject)
+		GameObjectManager::instance()->_addComponent(this);
 }
 
 GameObjectPtr
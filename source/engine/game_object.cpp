@@ -45,6 +45,7 @@ __ImplementSubClass(GameObject, rtti::Interface, "Object")
 GameObject::GameObject() noexcept
 	: _active(false)
 	, _layer(0)
+	, _hierarchyVersion(0)
 	, _localScaling(float3::One)
 	, _localTranslate(float3::Zero)
 	, _localRotation(Quaternion::Zero)
@@ -53,6 +54,9 @@ GameObject::GameObject() noexcept
 	, _worldRotation(Quaternion::Zero)
 	, _localNeedUpdates(true)
 	, _worldNeedUpdates(true)
+	, _localInverseNeedUpdates(true)
+	, _worldInverseNeedUpdates(true)
+	, _moveNeedUpdates(false)
 {
 	GameObjectManager::instance()->_instanceObject(this, _instanceID);
 }
@@ -74,13 +78,25 @@ GameObject::~GameObject() noexcept
 void
 GameObject::setName(const util::string& name) noexcept
 {
-	_name = name;
+	if (_name != name)
+	{
+		auto oldName = std::move(_name);
+		_name = name;
+
+		GameObjectManager::instance()->_renameObject(this, oldName);
+	}
 }
 
 void
 GameObject::setName(util::string&& name) noexcept
 {
-	_name = std::move(name);
+	if (_name != name)
+	{
+		auto oldName = std::move(_name);
+		_name = std::move(name);
+
+		GameObjectManager::instance()->_renameObject(this, oldName);
+	}
 }
 
 const util::string&
@@ -169,6 +185,12 @@ GameObject::getInstanceID() const noexcept
 	return _instanceID;
 }
 
+std::size_t
+GameObject::getHierarchyVersion() const noexcept
+{
+	return _hierarchyVersion;
+}
+
 void
 GameObject::setParent(const GameObjectPtr& parent) noexcept
 {
@@ -192,14 +214,18 @@ GameObject::setParent(const GameObjectPtr& parent) noexcept
 					break;
 				}
 			}
+
+			_weak->_hierarchyVersion++;
 		}
 
 		_parent = parent;
 		if (parent)
+		{
 			parent->_children.push_back(this->downcast_pointer<GameObject>());
+			parent->_hierarchyVersion++;
+		}
 
 		this->_updateWorldChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -253,6 +279,7 @@ GameObject::removeChild(GameObjectPtr& entity) noexcept
 	if (it != end)
 	{
 		_children.erase(it);
+		_hierarchyVersion++;
 	}
 }
 
@@ -263,6 +290,7 @@ GameObject::cleanupChildren() noexcept
 		it.reset();
 
 	_children.clear();
+	_hierarchyVersion++;
 }
 
 GameObjectPtr
@@ -278,14 +306,33 @@ GameObject::findChild(const util::string& name, bool recuse) noexcept
 
 	if (recuse)
 	{
-		for (auto& it : _children)
+		auto objects = GameObjectManager::instance()->_findNameList(name);
+		if (!objects)
+			return nullptr;
+
+		GameObject* result = nullptr;
+		std::size_t resultDepth = std::numeric_limits<std::size_t>::max();
+
+		for (auto& it : *objects)
 		{
-			auto result = it->findChild(name, recuse);
-			if (result)
+			std::size_t depth = 0;
+
+			auto parent = it->getParent();
+			while (parent && parent != this && depth < resultDepth)
 			{
-				return result;
+				parent = parent->getParent();
+				depth++;
 			}
+
+			if (parent != this || depth >= resultDepth)
+				continue;
+
+			result = it;
+			resultDepth = depth;
 		}
+
+		if (result)
+			return result->downcast_pointer<GameObject>();
 	}
 
 	return nullptr;
@@ -320,7 +367,6 @@ GameObject::setTranslate(const float3& pos) noexcept
 		_localNeedUpdates = true;
 
 		this->_updateLocalChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -348,7 +394,6 @@ GameObject::setScale(const float3& scale) noexcept
 		_localNeedUpdates = true;
 
 		this->_updateLocalChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -382,7 +427,6 @@ GameObject::setQuaternion(const Quaternion& quat) noexcept
 		_localNeedUpdates = true;
 
 		this->_updateLocalChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -427,9 +471,9 @@ GameObject::setTransform(const float4x4& transform) noexcept
 
 	_localTransform = transform.getTransform(_localTranslate, _localRotation, _localScaling);
 	_localNeedUpdates = false;
+	_localInverseNeedUpdates = true;
 
 	this->_updateLocalChildren();
-	this->_onMoveAfter();
 }
 
 void
@@ -440,9 +484,9 @@ GameObject::setTransformOnlyRotate(const float4x4& transform) noexcept
 	_localTransform = transform.getTransformOnlyRotation(_localTranslate, _localRotation);
 	_localTransform.scale(_localScaling);
 	_localNeedUpdates = false;
+	_localInverseNeedUpdates = true;
 
 	this->_updateLocalChildren();
-	this->_onMoveAfter();
 }
 
 const float4x4&
@@ -456,6 +500,13 @@ const float4x4&
 GameObject::getTransformInverse() const noexcept
 {
 	this->_updateLocalTransform();
+
+	if (_localInverseNeedUpdates)
+	{
+		_localTransformInverse = math::transformInverse(_localTransform);
+		_localInverseNeedUpdates = false;
+	}
+
 	return _localTransformInverse;
 }
 
@@ -470,7 +521,6 @@ GameObject::setWorldTranslate(const float3& pos) noexcept
 		_worldNeedUpdates = true;
 
 		this->_updateWorldChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -498,7 +548,6 @@ GameObject::setWorldScale(const float3& pos) noexcept
 		_worldNeedUpdates = true;
 
 		this->_updateWorldChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -526,7 +575,6 @@ GameObject::setWorldQuaternion(const Quaternion& quat) noexcept
 		_worldNeedUpdates = true;
 
 		this->_updateWorldChildren();
-		this->_onMoveAfter();
 	}
 }
 
@@ -549,11 +597,10 @@ GameObject::setWorldTransform(const float4x4& transform) noexcept
 	this->_onMoveBefore();
 
 	_worldTransform = transform.getTransform(_worldTranslate, _worldRotation, _worldScaling);
-	_worldTransformInverse = math::transformInverse(_worldTransform);
+	_worldInverseNeedUpdates = true;
 	_worldNeedUpdates = false;
 
 	this->_updateWorldChildren();
-	this->_onMoveAfter();
 }
 
 void
@@ -563,12 +610,11 @@ GameObject::setWorldTransformOnlyRotate(const float4x4& transform) noexcept
 
 	_worldTransform = transform.getTransformOnlyRotation(_worldTranslate, _worldRotation);
 	_worldTransform.scale(_worldScaling);
-	_worldTransformInverse = math::transformInverse(_worldTransform);
+	_worldInverseNeedUpdates = true;
 
 	_worldNeedUpdates = false;
 
 	this->_updateWorldChildren();
-	this->_onMoveAfter();
 }
 
 const float4x4&
@@ -582,6 +628,13 @@ const float4x4&
 GameObject::getWorldTransformInverse() const noexcept
 {
 	this->_updateWorldTransform();
+
+	if (_worldInverseNeedUpdates)
+	{
+		_worldTransformInverse = math::transformInverse(_worldTransform);
+		_worldInverseNeedUpdates = false;
+	}
+
 	return _worldTransformInverse;
 }
 
@@ -607,6 +660,7 @@ GameObject::addComponent(const GameComponentPtr& gameComponent) except
 			component->onAttachComponent(gameComponent);
 
 		_components.push_back(gameComponent);
+		_hierarchyVersion++;
 	}
 }
 
@@ -640,6 +694,8 @@ GameObject::removeComponent(const GameComponentPtr& gameComponent) noexcept
 		gameComponent->_setGameObject(nullptr);
 
 		this->removeComponentDispatchs(gameComponent);
+
+		_hierarchyVersion++;
 	}
 }
 
@@ -667,6 +723,8 @@ GameObject::cleanupComponents() noexcept
 
 		it = nextComponent;
 	}
+
+	_hierarchyVersion++;
 }
 
 GameComponentPtr
@@ -729,7 +787,7 @@ GameObject::getComponentsInChildren(const rtti::Rtti* type, GameComponents& comp
 				components.push_back(component);
 		}
 
-		it->getComponentInChildren(type);
+		it->getComponentsInChildren(type, components);
 	}
 }
 
@@ -1118,6 +1176,18 @@ GameObject::_onDeactivate() noexcept
 
 void
 GameObject::_onMoveBefore() except
+{
+	if (_moveNeedUpdates)
+		return;
+
+	_moveNeedUpdates = true;
+	GameObjectManager::instance()->_moveObject(this);
+
+	this->_dispatchMoveBefore();
+}
+
+void
+GameObject::_dispatchMoveBefore() except
 {
 	if (!this->getActive())
 		return;
@@ -1135,7 +1205,7 @@ GameObject::_onMoveBefore() except
 	for (auto& it : _children)
 	{
 		if (it->getActive())
-			it->_onMoveBefore();
+			it->_dispatchMoveBefore();
 	}
 }
 
@@ -1154,12 +1224,6 @@ GameObject::_onMoveAfter() except
 				it->onMoveAfter();
 		}
 	}
-
-	for (auto& it : _children)
-	{
-		if (it->getActive())
-			it->_onMoveAfter();
-	}
 }
 
 void
@@ -1194,7 +1258,10 @@ GameObject::_updateLocalChildren() const noexcept
 	_worldNeedUpdates = true;
 
 	for (auto& it : _children)
-		it->_updateLocalChildren();
+	{
+		if (!it->_worldNeedUpdates)
+			it->_updateLocalChildren();
+	}
 }
 
 void
@@ -1210,7 +1277,7 @@ GameObject::_updateLocalTransform() const noexcept
 	if (_localNeedUpdates)
 	{
 		_localTransform.makeTransform(_localTranslate, _localRotation, _localScaling);
-		_localTransformInverse = math::transformInverse(_localTransform);
+		_localInverseNeedUpdates = true;
 
 		_localNeedUpdates = false;
 	}
@@ -1226,7 +1293,7 @@ GameObject::_updateWorldTransform() const noexcept
 			auto& baseTransform = _parent.lock()->getWorldTransform();
 			_worldTransform = math::transformMultiply(baseTransform, this->getTransform());
 			_worldTransform.getTransform(_worldTranslate, _worldRotation, _worldScaling);
-			_worldTransformInverse = math::transformInverse(_worldTransform);
+			_worldInverseNeedUpdates = true;
 		}
 		else
 		{
@@ -1234,7 +1301,7 @@ GameObject::_updateWorldTransform() const noexcept
 			_worldScaling = _localScaling;
 			_worldRotation = _localRotation;
 			_worldTransform.makeTransform(_worldTranslate, _worldRotation, _worldScaling);
-			_worldTransformInverse = math::transformInverse(_worldTransform);
+			_worldInverseNeedUpdates = true;
 		}
 
 		_worldNeedUpdates = false;
@@ -1248,6 +1315,7 @@ GameObject::_updateParentTransform() const noexcept
 	{
 		_worldTransform.makeTransform(_worldTranslate, _worldRotation, _worldScaling);
 		_worldNeedUpdates = false;
+		_worldInverseNeedUpdates = true;
 	}
 
 	if (_parent.lock())
@@ -1255,12 +1323,14 @@ GameObject::_updateParentTransform() const noexcept
 		auto& baseTransformInverse = _parent.lock()->getWorldTransformInverse();
 		_localTransform = math::transformMultiply(baseTransformInverse, _worldTransform);
 		_localTransform.getTransform(_localTranslate, _localRotation, _localScaling);
+		_localInverseNeedUpdates = true;
 	}
 	else
 	{
 		_localScaling = _worldScaling;
 		_localRotation = _worldRotation;
 		_localTranslate = _worldTranslate;
+		_localNeedUpdates = true;
 	}
 }
 
@@ -36,11 +36,13 @@
 // +----------------------------------------------------------------------
 #include <ray/game_object_manager.h>
 #include <ray/game_object.h>
+#include <ray/game_component.h>
 
 #include <ray/res_loader.h>
 #include <ray/ioserver.h>
 #include <ray/mstream.h>
 #include <ray/mesh_component.h>
+#include <ray/mesh_bvh.h>
 
 _NAME_BEGIN
 
@@ -49,7 +51,10 @@ __ImplementSingleton(GameObjectManager)
 RaycastHit::RaycastHit() noexcept
 	: object(0)
 	, mesh(0)
+	, triangle(0)
 	, distance(FLT_MAX)
+	, barycentric(float2::Zero)
+	, point(float3::Zero)
 {
 }
 
@@ -78,6 +83,9 @@ GameObjectManager::_instanceObject(GameObject* entity, std::size_t& instanceID)
 		_instanceLists[_instanceID - 1] = entity;
 		instanceID = _instanceID;
 	}
+
+	if (!entity->getName().empty())
+		_nameLists[entity->getName()].push_back(entity);
 }
 
 void
@@ -89,6 +97,145 @@ GameObjectManager::_unsetObject(GameObject* entity) noexcept
 	_instanceLists[instanceID - 1] = nullptr;
 	_emptyLists.push(instanceID);
 	this->_activeObject(entity, false);
+	this->_removeName(entity, entity->getName());
+
+	if (entity->_moveNeedUpdates)
+	{
+		auto it = std::find(_moveActors.begin(), _moveActors.end(), entity);
+		if (it != _moveActors.end())
+			_moveActors.erase(it);
+
+		entity->_moveNeedUpdates = false;
+	}
+}
+
+void
+GameObjectManager::_renameObject(GameObject* entity, const util::string& oldName) noexcept
+{
+	assert(entity);
+
+	this->_removeName(entity, oldName);
+
+	if (!entity->getName().empty())
+		_nameLists[entity->getName()].push_back(entity);
+}
+
+void
+GameObjectManager::_removeName(GameObject* entity, const util::string& name) noexcept
+{
+	if (name.empty())
+		return;
+
+	auto it = _nameLists.find(name);
+	if (it == _nameLists.end())
+		return;
+
+	auto& objects = it->second;
+
+	auto object = std::find(objects.begin(), objects.end(), entity);
+	if (object != objects.end())
+	{
+		*object = objects.back();
+		objects.pop_back();
+	}
+
+	if (objects.empty())
+		_nameLists.erase(it);
+}
+
+void
+GameObjectManager::_moveObject(GameObject* entity) noexcept
+{
+	assert(entity);
+	_moveActors.push_back(entity);
+}
+
+void
+GameObjectManager::_addComponent(GameComponent* component) noexcept
+{
+	assert(component);
+
+	auto& components = _componentLists[component->rtti()];
+	component->_componentIndex = components.size();
+	components.push_back(component);
+}
+
+void
+GameObjectManager::_removeComponent(GameComponent* component) noexcept
+{
+	assert(component);
+
+	auto it = _componentLists.find(component->rtti());
+	if (it == _componentLists.end())
+		return;
+
+	auto& components = it->second;
+
+	auto index = component->_componentIndex;
+	assert(index < components.size() && components[index] == component);
+
+	components[index] = components.back();
+	components[index]->_componentIndex = index;
+	components.pop_back();
+}
+
+void
+GameObjectManager::_updateRaycastMesh(MeshComponent* component) noexcept
+{
+	assert(component);
+
+	auto mesh = component->getMesh();
+	if (!component->_gameObject || !mesh || mesh->getBoundingBox().empty())
+	{
+		this->_removeRaycastMesh(component);
+		return;
+	}
+
+	auto boundingBox = mesh->getBoundingBox();
+	boundingBox.transform(component->_gameObject->getWorldTransform());
+
+	if (component->_raycastProxy == AABBTree<MeshComponent*>::nullnode)
+		component->_raycastProxy = _raycastTree.createProxy(boundingBox.aabb(), component);
+	else
+		_raycastTree.moveProxy(component->_raycastProxy, boundingBox.aabb());
+}
+
+void
+GameObjectManager::_removeRaycastMesh(MeshComponent* component) noexcept
+{
+	assert(component);
+
+	if (component->_raycastProxy != AABBTree<MeshComponent*>::nullnode)
+	{
+		_raycastTree.destroyProxy(component->_raycastProxy);
+		component->_raycastProxy = AABBTree<MeshComponent*>::nullnode;
+	}
+}
+
+const std::vector<GameObject*>*
+GameObjectManager::_findNameList(const util::string& name) const noexcept
+{
+	auto it = _nameLists.find(name);
+	if (it != _nameLists.end())
+		return &it->second;
+	return nullptr;
+}
+
+GameObject*
+GameObjectManager::_findObject(const util::string& name) const noexcept
+{
+	auto objects = this->_findNameList(name);
+	if (!objects)
+		return nullptr;
+
+	GameObject* result = nullptr;
+	for (auto& it : *objects)
+	{
+		if (!result || it->getInstanceID() < result->getInstanceID())
+			result = it;
+	}
+
+	return result;
 }
 
 void
@@ -115,33 +262,45 @@ GameObjectManager::_activeObject(GameObject* entity, bool active) noexcept
 GameObjectPtr
 GameObjectManager::findObject(const util::string& name) noexcept
 {
-	for (auto& it : _instanceLists)
-	{
-		if (!it)
-			continue;
-
-		if (it->getName() == name)
-			return it->downcast_pointer<GameObject>();
-	}
-
+	auto object = this->_findObject(name);
+	if (object)
+		return object->downcast_pointer<GameObject>();
 	return nullptr;
 }
 
 GameObjectPtr
 GameObjectManager::findActiveObject(const util::string& name) noexcept
 {
-	for (auto& it : _activeActors)
+	auto objects = this->_findNameList(name);
+	if (!objects)
+		return nullptr;
+
+	GameObject* result = nullptr;
+	for (auto& it : *objects)
 	{
-		if (!it)
+		if (!it->getActive())
 			continue;
 
-		if (it->getName() == name && it->getActive())
-			return it->downcast_pointer<GameObject>();
+		if (!result || it->getInstanceID() < result->getInstanceID())
+			result = it;
 	}
 
+	if (result)
+		return result->downcast_pointer<GameObject>();
 	return nullptr;
 }
 
+void
+GameObjectManager::findObjects(const util::string& name, GameObjects& objects) noexcept
+{
+	auto lists = this->_findNameList(name);
+	if (!lists)
+		return;
+
+	for (auto& it : *lists)
+		objects.push_back(it->downcast_pointer<GameObject>());
+}
+
 GameObjectPtr
 GameObjectManager::instantiate(const util::string& name) noexcept
 {
@@ -154,74 +313,102 @@ GameObjectManager::instantiate(const util::string& name) noexcept
 bool
 GameObjectManager::activeObject(const util::string& name) noexcept
 {
-	for (auto& it : _instanceLists)
+	auto object = this->_findObject(name);
+	if (object)
 	{
-		if (it)
-		{
-			if (it->getName() == name)
-			{
-				it->setActive(true);
-				return true;
-			}
-		}
+		object->setActive(true);
+		return true;
 	}
 
 	return false;
 }
 
+void
+GameObjectManager::getComponents(const rtti::Rtti* type, std::vector<GameComponent*>& components) const noexcept
+{
+	assert(type);
+
+	for (auto& it : _componentLists)
+	{
+		if (!it.first->isDerivedFrom(type))
+			continue;
+
+		components.insert(components.end(), it.second.begin(), it.second.end());
+	}
+}
+
+void
+GameObjectManager::getComponents(const rtti::Rtti& type, std::vector<GameComponent*>& components) const noexcept
+{
+	this->getComponents(&type, components);
+}
+
+const std::vector<GameComponent*>&
+GameObjectManager::getComponentsExact(const rtti::Rtti* type) const noexcept
+{
+	assert(type);
+
+	static const std::vector<GameComponent*> empty;
+
+	auto it = _componentLists.find(type);
+	if (it != _componentLists.end())
+		return it->second;
+	return empty;
+}
+
+const std::vector<GameComponent*>&
+GameObjectManager::getComponentsExact(const rtti::Rtti& type) const noexcept
+{
+	return this->getComponentsExact(&type);
+}
+
 std::size_t
 GameObjectManager::raycastHit(const Raycast3& ray, RaycastHit& hit, std::function<bool(GameObject*)> comp) noexcept
 {
 	std::size_t result = 0;
 
-	for (auto& object : _instanceLists)
+	_raycastTree.raycast(ray, hit.distance, [&](MeshComponent* component, float maxDistance) -> float
 	{
-		if (!object)
-			continue;
-
+		auto object = component->_gameObject;
 		if (!object->getActive())
-			continue;
-
-		auto component = object->getComponent<ray::MeshComponent>();
-		if (!component)
-			continue;
+			return maxDistance;
 
 		auto mesh = component->getMesh();
 		if (!mesh)
-			continue;
+			return maxDistance;
 
 		if (comp)
 		{
 			if (!comp(object))
-				continue;
+				return maxDistance;
 		}
 
-		auto boundingBox = mesh->getBoundingBox();
-		boundingBox.transform(object->getTransform());
+		if (!mesh->getBVH())
+			mesh->computeBVH();
 
-		if (!boundingBox.intersects(ray))
-			continue;
+		auto& bvh = mesh->getBVH();
+		if (!bvh)
+			return maxDistance;
 
-		auto& subsets = mesh->getMeshSubsets();
-		for (std::size_t i = 0; i < subsets.size(); i++)
-		{
-			auto boundingBox = subsets[i].boundingBox;
-			boundingBox.transform(object->getTransform());
+		auto& transformInverse = object->getWorldTransformInverse();
+		auto origin = transformInverse * ray.origin;
+		auto direction = transformInverse * (ray.origin + ray.normal) - origin;
 
-			if (!boundingBox.intersects(ray))
-				continue;
+		MeshBVHHit meshHit;
+		if (!bvh->raycast(origin, direction, maxDistance, meshHit))
+			return maxDistance;
 
-			float distance = ray::math::sqrDistance(boundingBox.center(), ray.origin);
-			if (distance < hit.distance)
-			{
-				hit.object = object;
-				hit.mesh = i;
-				hit.distance = distance;
+		hit.object = object;
+		hit.mesh = meshHit.subset;
+		hit.triangle = meshHit.triangle;
+		hit.distance = meshHit.distance;
+		hit.barycentric = float2(meshHit.u, meshHit.v);
+		hit.point = ray.getPoint(meshHit.distance);
 
-				result++;
-			}
-		}
-	}
+		result++;
+
+		return meshHit.distance;
+	});
 
 	return result;
 }
@@ -229,9 +416,74 @@ GameObjectManager::raycastHit(const Raycast3& ray, RaycastHit& hit, std::functio
 std::size_t
 GameObjectManager::raycastHit(const Vector3& orgin, const Vector3& end, RaycastHit& hit, std::function<bool(GameObject*)> comp) noexcept
 {
+	hit.distance = std::min(hit.distance, math::distance(orgin, end));
 	return this->raycastHit(Raycast3(orgin, end), hit, comp);
 }
 
+std::size_t
+GameObjectManager::raycastHit(const Raycast3 rays[], RaycastHit hits[], std::size_t count, std::function<bool(GameObject*)> comp) noexcept
+{
+	std::size_t result = 0;
+
+	for (std::size_t i = 0; i < count; i++)
+	{
+		if (this->raycastHit(rays[i], hits[i], comp))
+			result++;
+	}
+
+	return result;
+}
+
+void
+GameObjectManager::updateTransforms() noexcept
+{
+	if (_moveActors.empty())
+		return;
+
+	_moveUpdates.swap(_moveActors);
+	_moveQueue.clear();
+
+	for (auto& it : _moveUpdates)
+	{
+		bool nested = false;
+		for (auto parent = it->getParent(); parent; parent = parent->getParent())
+		{
+			if (parent->_moveNeedUpdates)
+			{
+				nested = true;
+				break;
+			}
+		}
+
+		if (!nested)
+			_moveQueue.push_back(std::make_pair(it, it->getInstanceID()));
+	}
+
+	for (auto& it : _moveUpdates)
+		it->_moveNeedUpdates = false;
+
+	_moveUpdates.clear();
+
+	for (std::size_t i = 0; i < _moveQueue.size(); i++)
+	{
+		// a listener may destroy objects that are still queued, their instance slot is cleared or reused then
+		auto object = _moveQueue[i].first;
+		if (_instanceLists[_moveQueue[i].second - 1] != object)
+			continue;
+
+		if (!object->getActive())
+			continue;
+
+		object->getWorldTransform();
+		object->_onMoveAfter();
+
+		for (auto& child : object->_children)
+			_moveQueue.push_back(std::make_pair(child.get(), child->getInstanceID()));
+	}
+
+	_moveQueue.clear();
+}
+
 void
 GameObjectManager::onFrameBegin() noexcept
 {
@@ -42,6 +42,7 @@
 #include <ray/rtti_factory.h>
 
 #include <ray/jsonreader.h>
+#include <ray/cookedreader.h>
 
 _NAME_BEGIN
 
@@ -182,8 +183,22 @@ GameScene::load(const util::string& sceneURL) noexcept
 			return false;
 		}
 
-		JsonReader reader(*stream);
-		if (!reader.is_object())
+		if (CookedReader::can_read(*stream))
+		{
+			CookedReader reader(*stream);
+			if (reader.type(reader.root()) != CookedReader::type_t::object)
+			{
+				if (_gameListener)
+					_gameListener->onMessage("Non readable Scene file : " + sceneURL);
+
+				return false;
+			}
+
+			return this->load(reader);
+		}
+
+		auto reader = std::make_unique<JsonReader>(*stream);
+		if (!reader->is_object())
 		{
 			if (_gameListener)
 				_gameListener->onMessage("Non readable Scene file : " + sceneURL);
@@ -191,7 +206,7 @@ GameScene::load(const util::string& sceneURL) noexcept
 			return false;
 		}
 
-		return this->load(reader);
+		return this->load(*reader);
 	}
 	catch (const exception& e)
 	{
@@ -235,54 +250,64 @@ GameScene::load(const iarchive& reader) noexcept
 			if (!object.is_object())
 				continue;
 
-			auto actor = std::make_shared<GameObject>();
-			actor->setParent(_root);
-			actor->load(object);
+			if (!this->loadObject(object))
+				return false;
+		}
 
-			auto& components = object["components"];
-			if (!components.is_array())
-			{
-				if (_gameListener)
-					_gameListener->onMessage("components is not a array type");
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		if (_gameListener)
+			_gameListener->onMessage(e.what());
+
+		return false;
+	}
+}
+
+bool
+GameScene::load(const CookedReader& reader) noexcept
+{
+	try
+	{
+		auto scene = reader.find(reader.root(), "scene");
+		if (reader.type(scene) != CookedReader::type_t::object)
+		{
+			if (_gameListener)
+				_gameListener->onMessage("scene is not a object type");
+
+			return false;
+		}
+
+		auto sceneName = reader.find(scene, "name");
+		if (reader.type(sceneName) == CookedReader::type_t::string)
+		{
+			archivebuf name;
+			reader.read(sceneName, name);
+			this->setName(name.get<archive::string_t>());
+		}
+
+		auto objects = reader.find(scene, "objects");
+		if (reader.type(objects) != CookedReader::type_t::array)
+		{
+			if (_gameListener)
+				_gameListener->onMessage("objects is not a array type");
+
+			return false;
+		}
 
+		// decode one object at a time, the scene as a whole never exists as an archivebuf
+		for (std::size_t i = 0; i < reader.size(objects); i++)
+		{
+			auto node = reader.at(objects, i);
+			if (reader.type(node) != CookedReader::type_t::object)
 				continue;
-			}
 
-			const auto& componentValues = components.get<archive::array_t>();
-			for (auto& component : componentValues)
-			{
-				auto& className = component["class"].get<archive::string_t>();
-				if (className.empty())
-				{
-					if (_gameListener)
-						_gameListener->onMessage("Component class entry cannot be empty.");
-
-					continue;
-				}
-
-				try
-				{
-					auto actorComponent = rtti::make_shared<GameComponent>(className);
-					if (!actorComponent)
-					{
-						if (_gameListener)
-							_gameListener->onMessage("Failed to create component : " + className);
-
-						continue;
-					}
-
-					actorComponent->load(component);
-
-					actor->addComponent(actorComponent);
-				}
-				catch (const std::exception& e)
-				{
-					if (_gameListener)
-						_gameListener->onMessage("Failed to create component " + className + " with game object  " + actor->getName() + " : \n" + e.what());
-
-					return false;
-				}
-			}
+			archivebuf object;
+			reader.read(node, object);
+
+			if (!this->loadObject(object))
+				return false;
 		}
 
 		return true;
@@ -296,6 +321,61 @@ GameScene::load(const iarchive& reader) noexcept
 	}
 }
 
+bool
+GameScene::loadObject(const archivebuf& object) except
+{
+	auto actor = std::make_shared<GameObject>();
+	actor->setParent(_root);
+	actor->load(object);
+
+	auto& components = object["components"];
+	if (!components.is_array())
+	{
+		if (_gameListener)
+			_gameListener->onMessage("components is not a array type");
+
+		return true;
+	}
+
+	const auto& componentValues = components.get<archive::array_t>();
+	for (auto& component : componentValues)
+	{
+		auto& className = component["class"].get<archive::string_t>();
+		if (className.empty())
+		{
+			if (_gameListener)
+				_gameListener->onMessage("Component class entry cannot be empty.");
+
+			continue;
+		}
+
+		try
+		{
+			auto actorComponent = rtti::make_shared<GameComponent>(className);
+			if (!actorComponent)
+			{
+				if (_gameListener)
+					_gameListener->onMessage("Failed to create component : " + className);
+
+				continue;
+			}
+
+			actorComponent->load(component);
+
+			actor->addComponent(actorComponent);
+		}
+		catch (const std::exception& e)
+		{
+			if (_gameListener)
+				_gameListener->onMessage("Failed to create component " + className + " with game object  " + actor->getName() + " : \n" + e.what());
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool
 GameScene::save(oarchive& reader) noexcept
 {
@@ -38,6 +38,7 @@
 #include <ray/game_scene.h>
 #include <ray/game_features.h>
 #include <ray/game_listener.h>
+#include <ray/game_object_manager.h>
 
 _NAME_BEGIN
 
@@ -558,14 +559,25 @@ GameServer::update() noexcept
 
 		if (!_isQuitRequest)
 		{
+			auto objectManager = GameObjectManager::instance();
+
 			for (auto& it : _features)
+			{
 				it->onFrameBegin();
+				objectManager->updateTransforms();
+			}
 
 			for (auto& it : _features)
+			{
 				it->onFrame();
+				objectManager->updateTransforms();
+			}
 
 			for (auto& it : _features)
+			{
 				it->onFrameEnd();
+				objectManager->updateTransforms();
+			}
 		}
 	}
 	catch (const exception& e)
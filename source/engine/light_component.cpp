@@ -162,6 +162,30 @@ LightComponent::getShadowBias() const noexcept
 	return _light->getShadowBias();
 }
 
+void
+LightComponent::setShadowCascades(std::uint8_t cascades) noexcept
+{
+	_light->setShadowCascades(cascades);
+}
+
+std::uint8_t
+LightComponent::getShadowCascades() const noexcept
+{
+	return _light->getShadowCascades();
+}
+
+void
+LightComponent::setShadowCascadeLambda(float lambda) noexcept
+{
+	_light->setShadowCascadeLambda(lambda);
+}
+
+float
+LightComponent::getShadowCascadeLambda() const noexcept
+{
+	return _light->getShadowCascadeLambda();
+}
+
 void
 LightComponent::setGlobalIllumination(bool enable) noexcept
 {
@@ -213,6 +237,8 @@ LightComponent::load(const archivebuf& reader) noexcept
 	const auto& enableGI = reader["GI"];
 	const auto& shadowBias = reader["bias"];
 	const auto& shadowMode = reader["shadow"];
+	const auto& shadowCascades = reader["cascades"];
+	const auto& shadowCascadeLambda = reader["cascade_lambda"];
 
 	if (lightRange.is_numeric())
 		this->setLightRange(lightRange.get<archive::number_float_t>());
@@ -229,6 +255,12 @@ LightComponent::load(const archivebuf& reader) noexcept
 	if (shadowBias.is_numeric())
 		this->setShadowBias(shadowBias.get<archive::number_float_t>());
 
+	if (shadowCascades.is_numeric())
+		this->setShadowCascades(shadowCascades.get<archive::number_integer_t>());
+
+	if (shadowCascadeLambda.is_numeric())
+		this->setShadowCascadeLambda(shadowCascadeLambda.get<archive::number_float_t>());
+
 	if (enableGI.is_boolean())
 		this->setGlobalIllumination(enableGI.get<archive::boolean_t>());
 
@@ -35,6 +35,7 @@
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
 #include <ray/mesh_component.h>
+#include <ray/game_object_manager.h>
 #include <ray/res_loader.h>
 #include <ray/ioserver.h>
 #include <ray/mstream.h>
@@ -46,6 +47,7 @@ __ImplementSubClass(MeshComponent, GameComponent, "Mesh")
 
 MeshComponent::MeshComponent() noexcept
 	: _needUpdate(true)
+	, _raycastProxy(AABBTree<MeshComponent*>::nullnode)
 {
 }
 
@@ -195,6 +197,9 @@ MeshComponent::needUpdate() noexcept
 
 		_onMeshChange.run();
 		_needUpdate = false;
+
+		if (_raycastProxy != AABBTree<MeshComponent*>::nullnode)
+			GameObjectManager::instance()->_updateRaycastMesh(this);
 	}
 	else
 	{
@@ -230,17 +235,29 @@ void
 MeshComponent::onActivate() noexcept
 {
 	if (_needUpdate) this->needUpdate();
+
+	this->addComponentDispatch(GameDispatchType::GameDispatchTypeMoveAfter, this);
+	GameObjectManager::instance()->_updateRaycastMesh(this);
 }
 
 void
 MeshComponent::onDeactivate() noexcept
 {
+	this->removeComponentDispatch(GameDispatchType::GameDispatchTypeMoveAfter, this);
+	GameObjectManager::instance()->_removeRaycastMesh(this);
+
 	_mesh.reset();
 	_sharedMesh.reset();
 	_needUpdate = true;
 	this->needUpdate();
 }
 
+void
+MeshComponent::onMoveAfter() noexcept
+{
+	GameObjectManager::instance()->_updateRaycastMesh(this);
+}
+
 void
 MeshComponent::onMeshChangeBefore() noexcept
 {
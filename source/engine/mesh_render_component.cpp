@@ -41,24 +41,67 @@
 #include <ray/render_system.h>
 #include <ray/geometry.h>
 #include <ray/material.h>
+#include <ray/occlusion_buffer.h>
 
 #include <ray/game_server.h>
 #include <ray/graphics_context.h>
 
 #include <ray/res_manager.h>
 
+#include <unordered_map>
+
 _NAME_BEGIN
 
 __ImplementSubClass(MeshRenderComponent, RenderComponent, "MeshRender")
 
+static OcclusionHullPtr
+makeOcclusionHull(const MeshProperty& mesh, const MeshSubset& subset) noexcept
+{
+	const auto& vertices = mesh.getVertexArray();
+	const auto& indices = mesh.getIndicesArray();
+
+	std::vector<float3> hullVertices;
+	std::vector<std::uint32_t> hullIndices;
+	std::unordered_map<std::uint32_t, std::uint32_t> remap;
+
+	std::size_t end = std::min<std::size_t>(indices.size(), subset.startIndices + subset.indicesCount);
+	for (std::size_t i = subset.startIndices; i < end; i++)
+	{
+		std::uint32_t index = subset.startVertices + indices[i];
+		if (index >= vertices.size())
+			return nullptr;
+
+		auto it = remap.find(index);
+		if (it == remap.end())
+		{
+			it = remap.insert(std::make_pair(index, static_cast<std::uint32_t>(hullVertices.size()))).first;
+			hullVertices.push_back(vertices[index]);
+		}
+
+		hullIndices.push_back(it->second);
+	}
+
+	if (hullIndices.size() < 3)
+		return nullptr;
+
+	auto hull = std::make_shared<OcclusionHull>();
+	hull->setVertices(std::move(hullVertices));
+	hull->setIndices(std::move(hullIndices));
+	return hull;
+}
+
 MeshRenderComponent::MeshRenderComponent() noexcept
 	: _isCastShadow(true)
 	, _isReceiveShadow(true)
+	, _isVertexCompression(false)
+	, _isOccluder(false)
+	, _isStatic(false)
 	, _onMeshChange(std::bind(&MeshRenderComponent::onMeshChange, this))
 {
 }
 
 MeshRenderComponent::MeshRenderComponent(const MaterialPtr& material, bool shared) noexcept
+	: MeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterial(material);
@@ -67,6 +110,7 @@ MeshRenderComponent::MeshRenderComponent(const MaterialPtr& material, bool share
 }
 
 MeshRenderComponent::MeshRenderComponent(const MaterialPtr&& material, bool shared) noexcept
+	: MeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterial(material);
@@ -75,6 +119,7 @@ MeshRenderComponent::MeshRenderComponent(const MaterialPtr&& material, bool shar
 }
 
 MeshRenderComponent::MeshRenderComponent(const Materials& materials, bool shared) noexcept
+	: MeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterials(materials);
@@ -83,6 +128,7 @@ MeshRenderComponent::MeshRenderComponent(const Materials& materials, bool shared
 }
 
 MeshRenderComponent::MeshRenderComponent(Materials&& materials, bool shared) noexcept
+	: MeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterials(materials);
@@ -126,6 +172,48 @@ MeshRenderComponent::getReceiveShadow() const noexcept
 	return _isReceiveShadow;
 }
 
+void
+MeshRenderComponent::setVertexCompression(bool value) noexcept
+{
+	_isVertexCompression = value;
+}
+
+bool
+MeshRenderComponent::getVertexCompression() const noexcept
+{
+	return _isVertexCompression;
+}
+
+void
+MeshRenderComponent::setOccluder(bool value) noexcept
+{
+	_isOccluder = value;
+}
+
+bool
+MeshRenderComponent::getOccluder() const noexcept
+{
+	return _isOccluder;
+}
+
+void
+MeshRenderComponent::setStatic(bool value) noexcept
+{
+	if (_isStatic != value)
+	{
+		for (auto& it : _renderObjects)
+			it->setStatic(value);
+
+		_isStatic = value;
+	}
+}
+
+bool
+MeshRenderComponent::getStatic() const noexcept
+{
+	return _isStatic;
+}
+
 void
 MeshRenderComponent::setMaterial(const MaterialPtr& material) noexcept
 {
@@ -293,6 +381,9 @@ MeshRenderComponent::load(const archivebuf& reader) noexcept
 	reader["material"] >> _material;
 	reader["castshadow"] >> _isCastShadow;
 	reader["receiveshadow"] >> _isReceiveShadow;
+	reader["vertexcompression"] >> _isVertexCompression;
+	reader["occluder"] >> _isOccluder;
+	reader["static"] >> _isStatic;
 }
 
 void
@@ -303,6 +394,9 @@ MeshRenderComponent::save(archivebuf& write) noexcept
 	write["material"] << _material;
 	write["castshadow"] << _isCastShadow;
 	write["receiveshadow"] << _isReceiveShadow;
+	write["vertexcompression"] << _isVertexCompression;
+	write["occluder"] << _isOccluder;
+	write["static"] << _isStatic;
 }
 
 GameComponentPtr
@@ -313,6 +407,9 @@ MeshRenderComponent::clone() const noexcept
 	result->setActive(this->getActive());
 	result->setCastShadow(this->getCastShadow());
 	result->setReceiveShadow(this->getReceiveShadow());
+	result->setVertexCompression(this->getVertexCompression());
+	result->setOccluder(this->getOccluder());
+	result->setStatic(this->getStatic());
 	result->setSharedMaterials(this->getMaterials());
 	result->_material = this->_material;
 	result->_renderMeshVbo = this->_renderMeshVbo;
@@ -471,7 +568,7 @@ MeshRenderComponent::_buildRenderObjects(const MeshProperty& mesh, ModelMakerFla
 	if (mesh.getNumVertices())
 	{
 		if (!_renderMeshVbo)
-			_renderMeshVbo = ResManager::instance()->createVertexBuffer(mesh, flags);
+			_renderMeshVbo = ResManager::instance()->createVertexBuffer(mesh, flags, _isVertexCompression);
 
 		if (!_renderMeshVbo)
 			return false;
@@ -496,10 +593,14 @@ MeshRenderComponent::_buildRenderObjects(const MeshProperty& mesh, ModelMakerFla
 		renderObject->setOwnerListener(this);
 		renderObject->setCastShadow(this->getCastShadow());
 		renderObject->setReceiveShadow(this->getReceiveShadow());
+		renderObject->setStatic(this->getStatic());
 		renderObject->setLayer(this->getGameObject()->getLayer());
 		renderObject->setTransform(this->getGameObject()->getWorldTransform(), this->getGameObject()->getWorldTransformInverse());
 		renderObject->setGraphicsIndirect(std::make_shared<GraphicsIndirect>(it.indicesCount * 3, it.indicesCount, 1, it.startVertices, it.startIndices));
 
+		if (_isOccluder)
+			renderObject->setOcclusionHull(makeOcclusionHull(mesh, it));
+
 		_renderObjects.push_back(renderObject);
 	};
 
@@ -36,7 +36,6 @@
 // +----------------------------------------------------------------------
 #include <ray/physics_body_component.h>
 #include <ray/physics_shape_component.h>
-#include <ray/physics_system.h>
 
 _NAME_BEGIN
 
@@ -49,6 +48,8 @@ PhysicsBodyComponent::PhysicsBodyComponent() noexcept
 	, _constantVelocity(Vector3::Zero)
 	, _constantAngularVelocity(Vector3::Zero)
 	, _onCollisionChange(std::bind(&PhysicsBodyComponent::onCollisionChange, this))
+	, _isFetchResult(false)
+	, _fetchTransform(float4x4::One)
 {
 	_body = std::make_unique<PhysicsBody>();
 	_body->setRigidbodyListener(this);
@@ -263,6 +264,48 @@ PhysicsBodyComponent::addImpulse(const Vector3& force, const Vector3& axis) noex
 	_body->addImpulse(force, axis);
 }
 
+void
+PhysicsBodyComponent::addCollisionEnterListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept
+{
+	assert(!_onCollisionEnter.find(func));
+	_onCollisionEnter.attach(func);
+}
+
+void
+PhysicsBodyComponent::addCollisionStayListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept
+{
+	assert(!_onCollisionStay.find(func));
+	_onCollisionStay.attach(func);
+}
+
+void
+PhysicsBodyComponent::addCollisionExitListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept
+{
+	assert(!_onCollisionExit.find(func));
+	_onCollisionExit.attach(func);
+}
+
+void
+PhysicsBodyComponent::removeCollisionEnterListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept
+{
+	assert(_onCollisionEnter.find(func));
+	_onCollisionEnter.remove(func);
+}
+
+void
+PhysicsBodyComponent::removeCollisionStayListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept
+{
+	assert(_onCollisionStay.find(func));
+	_onCollisionStay.remove(func);
+}
+
+void
+PhysicsBodyComponent::removeCollisionExitListener(std::function<void(const PhysicsContact[], std::size_t)>* func) noexcept
+{
+	assert(_onCollisionExit.find(func));
+	_onCollisionExit.remove(func);
+}
+
 PhysicsBody*
 PhysicsBodyComponent::getPhysicsBody() const noexcept
 {
@@ -328,11 +371,17 @@ PhysicsBodyComponent::onDetachComponent(const GameComponentPtr& component) noexc
 void
 PhysicsBodyComponent::onMoveAfter() noexcept
 {
-	if (PhysicsSystem::instance()->isFetchResult())
+	bool isFetchResult = _isFetchResult;
+	_isFetchResult = false;
+
+	if (!_body || !this->isKinematic())
 		return;
 
-	if (_body && this->isKinematic())
-		_body->setWorldTransform(this->getGameObject()->getWorldTransform());
+	auto& transform = this->getGameObject()->getWorldTransform();
+	if (isFetchResult && transform == _fetchTransform)
+		return;
+
+	_body->setWorldTransform(transform);
 }
 
 void
@@ -342,18 +391,21 @@ PhysicsBodyComponent::onCollisionChange() noexcept
 }
 
 void
-PhysicsBodyComponent::onCollisionEnter() noexcept
+PhysicsBodyComponent::onCollisionEnter(const PhysicsContact contacts[], std::size_t count) noexcept
 {
+	_onCollisionEnter.run(contacts, count);
 }
 
 void
-PhysicsBodyComponent::onCollisionExit() noexcept
+PhysicsBodyComponent::onCollisionStay(const PhysicsContact contacts[], std::size_t count) noexcept
 {
+	_onCollisionStay.run(contacts, count);
 }
 
 void
-PhysicsBodyComponent::onCollisionStay() noexcept
+PhysicsBodyComponent::onCollisionExit(const PhysicsContact contacts[], std::size_t count) noexcept
 {
+	_onCollisionExit.run(contacts, count);
 }
 
 void
@@ -362,6 +414,9 @@ PhysicsBodyComponent::onFetchResult() noexcept
 	float4x4 transform;
 	_body->getWorldTransform(transform);
 	this->getGameObject()->getParent()->setWorldTransformOnlyRotate(math::transformMultiply(transform, this->getGameObject()->getTransformInverse()));
+
+	_isFetchResult = true;
+	_fetchTransform = this->getGameObject()->getWorldTransform();
 }
 
 _NAME_END
\ No newline at end of file
@@ -62,6 +62,12 @@ PhysicFeatures::onDeactivate() noexcept
 	PhysicsSystem::instance()->close();
 }
 
+void
+PhysicFeatures::onFrameBegin() noexcept
+{
+	PhysicsSystem::instance()->fetchResult();
+}
+
 void
 PhysicFeatures::onFrameEnd() noexcept
 {
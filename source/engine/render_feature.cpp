@@ -37,6 +37,7 @@
 #include <ray/render_feature.h>
 #include <ray/render_scene.h>
 #include <ray/render_system.h>
+#include <ray/res_manager.h>
 
 #include <ray/game_scene.h>
 #include <ray/game_server.h>
@@ -107,6 +108,8 @@ RenderFeature::onActivate() except
 void
 RenderFeature::onDeactivate() noexcept
 {
+	ResManager::instance()->closeStream();
+
 	_renderScene.reset();
 	RenderSystem::instance()->close();
 }
@@ -136,6 +139,7 @@ void
 RenderFeature::onFrameBegin() noexcept
 {
 	RenderSystem::instance()->renderBegin();
+	ResManager::instance()->updateStream();
 }
 
 void
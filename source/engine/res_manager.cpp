@@ -62,12 +62,69 @@ _NAME_BEGIN
 
 __ImplementSingleton(ResManager)
 
+ResStreamRequest::ResStreamRequest() noexcept
+	: _state(ResStreamState::ResStreamStatePending)
+	, _cache(false)
+	, _dim(GraphicsTextureDim::GraphicsTextureDim2D)
+	, _filter(GraphicsSamplerFilter::GraphicsSamplerFilterLinear)
+	, _wrap(GraphicsSamplerWrap::GraphicsSamplerWrapRepeat)
+{
+}
+
+ResStreamRequest::~ResStreamRequest() noexcept
+{
+}
+
+const util::string&
+ResStreamRequest::getName() const noexcept
+{
+	return _name;
+}
+
+ResStreamState
+ResStreamRequest::getState() const noexcept
+{
+	return _state;
+}
+
+bool
+ResStreamRequest::isDone() const noexcept
+{
+	ResStreamState state = _state;
+	return state == ResStreamState::ResStreamStateResident || state == ResStreamState::ResStreamStateFailed;
+}
+
+bool
+ResStreamRequest::isResident() const noexcept
+{
+	return _state == ResStreamState::ResStreamStateResident;
+}
+
+const GraphicsTexturePtr&
+ResStreamRequest::getTexture() const noexcept
+{
+	return _texture;
+}
+
+const ModelPtr&
+ResStreamRequest::getModel() const noexcept
+{
+	return _model;
+}
+
 ResManager::ResManager() noexcept
+	: _vertexCompression(false)
+	, _streamUploadBudget(1024 * 1024 * 16)
+	, _streamUploadBytes(0)
+	, _streamPending(0)
+	, _streamThreads(std::make_unique<ThreadPool>())
 {
 }
 
 ResManager::~ResManager() noexcept
 {
+	this->closeStream();
+
 	_textures.clear();
 }
 
@@ -92,14 +149,105 @@ ResManager::createTexture(const util::string& name, GraphicsTexturePtr& _texture
 		return true;
 	}
 
+	image::Image image;
+	if (!this->_loadImage(name, image))
+		return false;
+
+	auto texture = this->_buildTexture(image, dim, filter, warp);
+	if (!texture)
+		return false;
+
+	_texture = texture;
+	if (cache)
+	{
+		_textureCaches[name] = texture;
+		_textures.push_back(texture);
+	}
+
+	return true;
+}
+
+ResStreamRequestPtr
+ResManager::createTextureAsync(const util::string& name, GraphicsTextureDim dim, GraphicsSamplerFilter filter, GraphicsSamplerWrap warp, bool cache, ResStreamCallback callback) noexcept
+{
+	assert(!name.empty());
+
+	auto it = _textureCaches.find(name);
+	if (it != _textureCaches.end())
+	{
+		auto request = std::make_shared<ResStreamRequest>();
+		request->_name = name;
+		request->_texture = (*it).second;
+		request->_state = ResStreamState::ResStreamStateResident;
+
+		if (callback)
+			callback(*request);
+
+		return request;
+	}
+
+	if (cache)
+	{
+		auto pending = _streamRequests.find(name);
+		if (pending != _streamRequests.end())
+		{
+			if (callback)
+				(*pending).second->_callbacks.push_back(std::move(callback));
+			return (*pending).second;
+		}
+	}
+
+	auto request = std::make_shared<ResStreamRequest>();
+	request->_name = name;
+	request->_cache = cache;
+	request->_dim = dim;
+	request->_filter = filter;
+	request->_wrap = warp;
+
+	if (dim == GraphicsTextureDim::GraphicsTextureDim2D)
+		request->_texture = this->_buildPlaceholderTexture();
+
+	if (callback)
+		request->_callbacks.push_back(std::move(callback));
+
+	if (cache)
+		_streamRequests[name] = request;
+
+	// IoServer is not thread safe, the file is opened here and only decoded on the stream threads
 	StreamReaderPtr stream;
 	if (!IoServer::instance()->openFileURL(stream, name))
-		return false;
+		stream = nullptr;
 
-	image::Image image;
-	if (!image.load(*stream))
+	this->_streamRequest(request, [request, stream]()
+	{
+		auto data = std::make_unique<image::Image>();
+		if (stream && data->load(*stream))
+		{
+			request->_image = std::move(data);
+			request->_state = ResStreamState::ResStreamStateLoaded;
+		}
+		else
+		{
+			request->_state = ResStreamState::ResStreamStateFailed;
+		}
+	});
+
+	return request;
+}
+
+bool
+ResManager::_loadImage(const util::string& name, image::Image& image) noexcept
+{
+	StreamReaderPtr stream;
+	if (!IoServer::instance()->openFileURL(stream, name))
 		return false;
 
+	return image.load(*stream);
+}
+
+GraphicsTexturePtr
+ResManager::_buildTexture(const image::Image& image, GraphicsTextureDim dim, GraphicsSamplerFilter filter, GraphicsSamplerWrap warp) noexcept
+{
 	GraphicsFormat format = GraphicsFormat::GraphicsFormatUndefined;
 	switch (image.format())
 	{
@@ -154,18 +302,28 @@ ResManager::createTexture(const util::string& name, GraphicsTexturePtr& _texture
 	textureDesc.setSamplerFilter(filter, filter);
 	textureDesc.setSamplerWrap(warp);
 
-	auto texture = RenderSystem::instance()->createTexture(textureDesc);
-	if (!texture)
-		return false;
+	return RenderSystem::instance()->createTexture(textureDesc);
+}
 
-	_texture = texture;
-	if (cache)
-	{
-		_textureCaches[name] = texture;
-		_textures.push_back(texture);
-	}
+GraphicsTexturePtr
+ResManager::_buildPlaceholderTexture() noexcept
+{
+	if (_placeholderTexture)
+		return _placeholderTexture;
 
-	return true;
+	std::uint8_t pixel[] = { 255, 255, 255, 255 };
+
+	GraphicsTextureDesc textureDesc;
+	textureDesc.setSize(1, 1, 1);
+	textureDesc.setTexDim(GraphicsTextureDim::GraphicsTextureDim2D);
+	textureDesc.setTexFormat(GraphicsFormat::GraphicsFormatR8G8B8A8UNorm);
+	textureDesc.setStream(pixel);
+	textureDesc.setStreamSize(sizeof(pixel));
+	textureDesc.setSamplerFilter(GraphicsSamplerFilter::GraphicsSamplerFilterNearest, GraphicsSamplerFilter::GraphicsSamplerFilterNearest);
+	textureDesc.setSamplerWrap(GraphicsSamplerWrap::GraphicsSamplerWrapRepeat);
+
+	_placeholderTexture = RenderSystem::instance()->createTexture(textureDesc);
+	return _placeholderTexture;
 }
 
 void
@@ -227,19 +385,195 @@ ResManager::addTextureCache(const char* name, const GraphicsTexturePtr& texture)
 	return true;
 }
 
+void
+ResManager::setVertexCompression(bool enable) noexcept
+{
+	_vertexCompression = enable;
+}
+
+bool
+ResManager::getVertexCompression() const noexcept
+{
+	return _vertexCompression;
+}
+
+void
+ResManager::setStreamUploadBudget(std::size_t bytes) noexcept
+{
+	_streamUploadBudget = bytes;
+}
+
+std::size_t
+ResManager::getStreamUploadBudget() const noexcept
+{
+	return _streamUploadBudget;
+}
+
+std::size_t
+ResManager::getStreamPendingCount() const noexcept
+{
+	return _streamPending;
+}
+
+std::size_t
+ResManager::getStreamUploadBytes() const noexcept
+{
+	return _streamUploadBytes;
+}
+
+void
+ResManager::updateStream() noexcept
+{
+	_streamUploadBytes = 0;
+
+	std::vector<ResStreamRequestPtr> requests;
+
+	_streamMutex.lock();
+
+	std::size_t count = 0;
+	for (auto& it : _streamReady)
+	{
+		std::size_t size = it->_image ? it->_image->size() : 0;
+		if (_streamUploadBytes > 0 && _streamUploadBytes + size > _streamUploadBudget)
+			break;
+
+		_streamUploadBytes += size;
+		count++;
+	}
+
+	requests.assign(_streamReady.begin(), _streamReady.begin() + count);
+	_streamReady.erase(_streamReady.begin(), _streamReady.begin() + count);
+
+	_streamMutex.unlock();
+
+	for (auto& request : requests)
+	{
+		if (request->_image)
+		{
+			auto texture = this->_buildTexture(*request->_image, request->_dim, request->_filter, request->_wrap);
+			if (texture)
+			{
+				request->_texture = texture;
+				request->_state = ResStreamState::ResStreamStateResident;
+
+				if (request->_cache)
+				{
+					_textureCaches[request->_name] = texture;
+					_textures.push_back(texture);
+				}
+			}
+			else
+			{
+				request->_state = ResStreamState::ResStreamStateFailed;
+			}
+
+			request->_image.reset();
+		}
+		else if (request->_state == ResStreamState::ResStreamStateLoaded)
+		{
+			request->_state = ResStreamState::ResStreamStateResident;
+		}
+
+		auto it = _streamRequests.find(request->_name);
+		if (it != _streamRequests.end() && (*it).second == request)
+			_streamRequests.erase(it);
+
+		for (auto& callback : request->_callbacks)
+			callback(*request);
+
+		request->_callbacks.clear();
+
+		_streamPending--;
+	}
+}
+
+void
+ResManager::closeStream() noexcept
+{
+	_streamThreads->wait(_streamGroup);
+
+	_streamMutex.lock();
+	for (auto& it : _streamReady)
+	{
+		it->_image.reset();
+		it->_callbacks.clear();
+		it->_state = ResStreamState::ResStreamStateFailed;
+	}
+	_streamReady.clear();
+	_streamMutex.unlock();
+
+	_streamRequests.clear();
+	_streamPending = 0;
+
+	_placeholderTexture.reset();
+}
+
+void
+ResManager::_streamRequest(const ResStreamRequestPtr& request, std::function<void(void)>&& func) noexcept
+{
+	if (_streamThreads->getThreadCount() == 0)
+		_streamThreads->start(std::max<std::size_t>(1, std::thread::hardware_concurrency() / 4));
+
+	_streamPending++;
+
+	_streamThreads->exce(_streamGroup, [this, request, func]()
+	{
+		func();
+
+		std::lock_guard<std::mutex> lock(_streamMutex);
+		_streamReady.push_back(request);
+	});
+}
+
 bool
 ResManager::createModel(const util::string& filename, ModelPtr& model) noexcept
 {
+	if (!model)
+		model = std::make_shared<Model>();
+
+	return this->_loadModel(filename, *model);
+}
+
+ResStreamRequestPtr
+ResManager::createModelAsync(const util::string& filename, ResStreamCallback callback) noexcept
+{
+	assert(!filename.empty());
+
+	auto request = std::make_shared<ResStreamRequest>();
+	request->_name = filename;
+
+	if (callback)
+		request->_callbacks.push_back(std::move(callback));
+
 	StreamReaderPtr stream;
-	if (IoServer::instance()->openFileURL(stream, filename))
+	if (!IoServer::instance()->openFileURL(stream, filename))
+		stream = nullptr;
+
+	this->_streamRequest(request, [request, stream]()
 	{
-		if (!model)
-			model = std::make_shared<Model>();
+		auto model = std::make_shared<Model>();
+		if (stream && model->load(*stream))
+		{
+			request->_model = std::move(model);
+			request->_state = ResStreamState::ResStreamStateLoaded;
+		}
+		else
+		{
+			request->_state = ResStreamState::ResStreamStateFailed;
+		}
+	});
 
-		return model->load(*stream);
-	}
+	return request;
+}
 
-	return false;
+bool
+ResManager::_loadModel(const util::string& filename, Model& model) noexcept
+{
+	StreamReaderPtr stream;
+	if (!IoServer::instance()->openFileURL(stream, filename))
+		return false;
+
+	return model.load(*stream);
 }
 
 bool
@@ -269,13 +603,21 @@ ResManager::createGameObject(const Model& model, GameObjectPtr& gameObject) noex
 
 	if (materials.size() > 0)
 	{
+		bool compressed = _vertexCompression && this->_isVertexCompressible(model);
+
 		if (bones.empty())
-			gameObject->addComponent(std::make_shared<MeshRenderComponent>(std::move(materials)));
+		{
+			auto mr = std::make_shared<MeshRenderComponent>(std::move(materials));
+			mr->setVertexCompression(compressed);
+
+			gameObject->addComponent(mr);
+		}
 		else
 		{
 			auto smr = std::make_shared<SkinnedMeshRenderComponent>();
 			smr->setMaterials(std::move(materials));
 			smr->setTransforms(bones);
+			smr->setVertexCompression(compressed);
 
 			gameObject->addComponent(smr);
 		}
@@ -340,21 +682,25 @@ ResManager::createIndexBuffer(const MeshProperty& mesh) noexcept
 }
 
 GraphicsDataPtr
-ResManager::createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags) noexcept
+ResManager::createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags, bool compressed) noexcept
 {
 	std::size_t numVertex = mesh.getNumVertices();
 	if (numVertex == 0)
 		return nullptr;
 
+	GraphicsFormat vertexFormat = compressed ? GraphicsFormat::GraphicsFormatR16G16B16A16SFloat : GraphicsFormat::GraphicsFormatR32G32B32SFloat;
+	GraphicsFormat colorFormat = compressed ? GraphicsFormat::GraphicsFormatR8G8B8A8UNorm : GraphicsFormat::GraphicsFormatR32G32B32A32SFloat;
+	GraphicsFormat texcoordFormat = compressed ? GraphicsFormat::GraphicsFormatR16G16SFloat : GraphicsFormat::GraphicsFormatR32G32SFloat;
+
 	std::uint32_t inputSize = 0;
 	if (!mesh.getVertexArray().empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitVertex)
-		inputSize += GraphicsVertexLayout::getVertexSize(GraphicsFormat::GraphicsFormatR32G32B32SFloat);
+		inputSize += GraphicsVertexLayout::getVertexSize(vertexFormat);
 	if (!mesh.getTangentArray().empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitTangentQuat)
 		inputSize += GraphicsVertexLayout::getVertexSize(GraphicsFormat::GraphicsFormatR8G8B8A8UNorm);
 	if (!mesh.getColorArray().empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitColor)
-		inputSize += GraphicsVertexLayout::getVertexSize(GraphicsFormat::GraphicsFormatR32G32B32A32SFloat);
+		inputSize += GraphicsVertexLayout::getVertexSize(colorFormat);
 	if (!mesh.getTexcoordArray().empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitTexcoord)
-		inputSize += GraphicsVertexLayout::getVertexSize(GraphicsFormat::GraphicsFormatR32G32SFloat);
+		inputSize += GraphicsVertexLayout::getVertexSize(texcoordFormat);
 	if (!mesh.getWeightArray().empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitWeight)
 	{
 		inputSize += GraphicsVertexLayout::getVertexSize(GraphicsFormat::GraphicsFormatR8G8B8A8UNorm);
@@ -378,11 +724,23 @@ ResManager::createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags)
 			std::uint8_t* data = mapBuffer + offset1 + offsetVertices;
 			for (auto& it : vertices)
 			{
-				*(float3*)data = it;
+				if (compressed)
+				{
+					std::uint16_t* half = (std::uint16_t*)data;
+					half[0] = math::fpToHalf(it.x);
+					half[1] = math::fpToHalf(it.y);
+					half[2] = math::fpToHalf(it.z);
+					half[3] = math::fpToHalf(1.0f);
+				}
+				else
+				{
+					*(float3*)data = it;
+				}
+
 				data += inputSize;
 			}
 
-			offset1 += sizeof(float3);
+			offset1 += GraphicsVertexLayout::getVertexSize(vertexFormat);
 		}
 
 		if (!tangents.empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitTangentQuat)
@@ -412,11 +770,22 @@ ResManager::createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags)
 			std::uint8_t* data = mapBuffer + offset1 + offsetVertices;
 			for (auto& it : colors)
 			{
-				*(float4*)data = it;
+				if (compressed)
+				{
+					data[0] = math::fpToInt8UNORM(math::saturate(it.x));
+					data[1] = math::fpToInt8UNORM(math::saturate(it.y));
+					data[2] = math::fpToInt8UNORM(math::saturate(it.z));
+					data[3] = math::fpToInt8UNORM(math::saturate(it.w));
+				}
+				else
+				{
+					*(float4*)data = it;
+				}
+
 				data += inputSize;
 			}
 
-			offset1 += sizeof(float4);
+			offset1 += GraphicsVertexLayout::getVertexSize(colorFormat);
 		}
 
 		if (!texcoords.empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitTexcoord)
@@ -424,11 +793,21 @@ ResManager::createVertexBuffer(const MeshProperty& mesh, ModelMakerFlags flags)
 			std::uint8_t* data = mapBuffer + offset1 + offsetVertices;
 			for (auto& it : texcoords)
 			{
-				*(float2*)data = it;
+				if (compressed)
+				{
+					std::uint16_t* half = (std::uint16_t*)data;
+					half[0] = math::fpToHalf(it.x);
+					half[1] = math::fpToHalf(it.y);
+				}
+				else
+				{
+					*(float2*)data = it;
+				}
+
 				data += inputSize;
 			}
 
-			offset1 += sizeof(float2);
+			offset1 += GraphicsVertexLayout::getVertexSize(texcoordFormat);
 		}
 
 		if (!weight.empty() && flags & ModelMakerFlagBits::ModelMakerFlagBitWeight)
@@ -533,8 +912,59 @@ ResManager::createAnimation(const util::string& file, const GameObjects& bones,
 
 bool
 ResManager::createMaterials(const Model& model, Materials& materials, bool skinned) noexcept
+{
+	return this->_buildMaterials(model, materials, skinned, false);
+}
+
+bool
+ResManager::createMaterialsAsync(const Model& model, Materials& materials, bool skinned) noexcept
+{
+	return this->_buildMaterials(model, materials, skinned, true);
+}
+
+bool
+ResManager::_isVertexCompressible(const Model& model) const noexcept
+{
+	// Half floats keep 11 bits of precision, so positions must stay within
+	// +-64 units for the rounding error to stay below 1/64 of a unit.
+	const float maxCoord = 64.0f;
+
+	// Texcoords must stay within +-2 for the rounding error to stay below
+	// 1/2048, half a texel of a 1024 texture; tiled UVs keep full floats.
+	const float maxTexcoord = 2.0f;
+
+	for (auto& materialProp : model.getMaterialsList())
+	{
+		util::string effect;
+		materialProp->get(MATKEY_EFFECT, effect);
+		if (!effect.empty())
+			return false;
+	}
+
+	for (auto& mesh : model.getMeshsList())
+	{
+		for (auto& it : mesh->getVertexArray())
+		{
+			if (std::abs(it.x) > maxCoord || std::abs(it.y) > maxCoord || std::abs(it.z) > maxCoord)
+				return false;
+		}
+
+		for (auto& it : mesh->getTexcoordArray())
+		{
+			if (std::abs(it.x) > maxTexcoord || std::abs(it.y) > maxTexcoord)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+bool
+ResManager::_buildMaterials(const Model& model, Materials& materials, bool skinned, bool async) noexcept
 {
 	std::size_t numBones = model.getBonesList().size();
+	bool compressed = _vertexCompression && this->_isVertexCompressible(model);
+	bool instancing = RenderSystem::instance()->isInstancingSupport();
 
 	for (auto& materialProp : model.getMaterialsList())
 	{
@@ -549,7 +979,7 @@ ResManager::createMaterials(const Model& model, Materials& materials, bool skinn
 			if (opacity == 1.0)
 			{
 				if (numBones == 0 || !skinned)
-					defaultMaterial = "sys:fx/opacity_skinning0.fxml";
+					defaultMaterial = instancing ? "sys:fx/opacity_instancing.fxml" : "sys:fx/opacity_skinning0.fxml";
 				else if (numBones <= 64)
 					defaultMaterial = "sys:fx/opacity_skinning64.fxml";
 				else if (numBones <= 128)
@@ -574,8 +1004,11 @@ ResManager::createMaterials(const Model& model, Materials& materials, bool skinn
 			}
 		}
 
+		if (compressed)
+			defaultMaterial = defaultMaterial.substr(0, defaultMaterial.rfind(".fxml")) + "_compressed.fxml";
+
 		MaterialPtr material;
-		material = _buildDefaultMaterials(*materialProp, defaultMaterial, model.getDirectory());
+		material = _buildDefaultMaterials(*materialProp, defaultMaterial, model.getDirectory(), async);
 		if (!material)
 			continue;
 
@@ -724,7 +1157,7 @@ ResManager::createJoints(const Model& model, const GameObjects& rigidbodys, Game
 }
 
 MaterialPtr
-ResManager::_buildDefaultMaterials(const MaterialProperty& material, const util::string& file, const util::string& directory) noexcept
+ResManager::_buildDefaultMaterials(const MaterialProperty& material, const util::string& file, const util::string& directory, bool async) noexcept
 {
 	float3 metalness(0.5f);
 	float3 diffuseColor(1.0f);
@@ -754,7 +1187,7 @@ ResManager::_buildDefaultMaterials(const MaterialProperty& material, const util:
 		return math::dot(rgb, lumfact);
 	};
 
-	if (!diffuseTexture.empty())
+	if (!async && !diffuseTexture.empty())
 	{
 		GraphicsTexturePtr texture;
 		if (this->createTexture(directory + diffuseTexture, texture, GraphicsTextureDim::GraphicsTextureDim2D, GraphicsSamplerFilter::GraphicsSamplerFilterLinear))
@@ -764,7 +1197,7 @@ ResManager::_buildDefaultMaterials(const MaterialProperty& material, const util:
 		}
 	}
 
-	if (!normalTexture.empty())
+	if (!async && !normalTexture.empty())
 	{
 		GraphicsTexturePtr texture;
 		if (this->createTexture(directory + normalTexture, texture, GraphicsTextureDim::GraphicsTextureDim2D, GraphicsSamplerFilter::GraphicsSamplerFilterNearest))
@@ -777,6 +1210,37 @@ ResManager::_buildDefaultMaterials(const MaterialProperty& material, const util:
 	effect->getParameter("quality")->uniform4f(quality);
 	effect->getParameter("diffuse")->uniform3f(diffuseColor);
 
+	if (async)
+	{
+		std::weak_ptr<Material> weak = effect;
+
+		auto bind = [weak](const char* name, std::uint8_t component)
+		{
+			return [weak, name, component](const ResStreamRequest& request)
+			{
+				auto effect = weak.lock();
+				if (!effect || !request.isResident())
+					return;
+
+				float4 quality = effect->getParameter("quality")->value().getFloat4();
+				quality[component] = 1.0f;
+
+				effect->getParameter(name)->uniformTexture(request.getTexture());
+				effect->getParameter("quality")->uniform4f(quality);
+			};
+		};
+
+		if (!diffuseTexture.empty())
+		{
+			auto request = this->createTextureAsync(directory + diffuseTexture, GraphicsTextureDim::GraphicsTextureDim2D, GraphicsSamplerFilter::GraphicsSamplerFilterLinear, GraphicsSamplerWrap::GraphicsSamplerWrapRepeat, true, bind("texDiffuse", 0));
+			if (!request->isDone())
+				effect->getParameter("texDiffuse")->uniformTexture(request->getTexture());
+		}
+
+		if (!normalTexture.empty())
+			this->createTextureAsync(directory + normalTexture, GraphicsTextureDim::GraphicsTextureDim2D, GraphicsSamplerFilter::GraphicsSamplerFilterNearest, GraphicsSamplerWrap::GraphicsSamplerWrapRepeat, true, bind("texNormal", 1));
+	}
+
 	if (effect->getParameter("metalness"))
 		effect->getParameter("metalness")->uniform1f(metalness.x);
 	else if (effect->getParameter("specular"))
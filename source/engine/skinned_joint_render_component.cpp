@@ -41,6 +41,7 @@
 #include <ray/render_feature.h>
 #include <ray/game_server.h>
 #include <ray/graphics_data.h>
+#include <ray/anim_component.h>
 
 _NAME_BEGIN
 
@@ -105,6 +106,10 @@ SkinnedJointRenderComponent::onDeactivate() noexcept
 void
 SkinnedJointRenderComponent::onFrameEnd() noexcept
 {
+	auto animation = this->getComponent<AnimationComponent>();
+	if (animation)
+		animation->syncTransforms();
+
 	float3* data;
 	if (_renderMeshVbo->map(0, _renderMeshVbo->getGraphicsDataDesc().getStreamSize(), (void**)&data))
 	{
@@ -40,18 +40,23 @@
 #include <ray/render_system.h>
 #include <ray/mesh_component.h>
 #include <ray/material.h>
+#include <ray/anim_component.h>
 
 _NAME_BEGIN
 
 __ImplementSubClass(SkinnedMeshRenderComponent, MeshRenderComponent, "SkinnedMeshRender")
 
 SkinnedMeshRenderComponent::SkinnedMeshRenderComponent() noexcept
-	: _onMeshChange(std::bind(&SkinnedMeshRenderComponent::onMeshChange, this))
+	: _needUpdate(true)
+	, _paletteVersion(0)
+	, _onMeshChange(std::bind(&SkinnedMeshRenderComponent::onMeshChange, this))
 	, _onMeshWillRender(std::bind(&SkinnedMeshRenderComponent::onMeshWillRender, this, std::placeholders::_1))
+	, _onPoseUpdate(std::bind(&SkinnedMeshRenderComponent::onPoseUpdate, this, std::placeholders::_1))
 {
 }
 
 SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(MaterialPtr& material, bool shared) noexcept
+	: SkinnedMeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterial(material);
@@ -60,6 +65,7 @@ SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(MaterialPtr& material, bo
 }
 
 SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(MaterialPtr&& material, bool shared) noexcept
+	: SkinnedMeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterial(material);
@@ -68,6 +74,7 @@ SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(MaterialPtr&& material, b
 }
 
 SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(const Materials& materials, bool shared) noexcept
+	: SkinnedMeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterials(materials);
@@ -76,6 +83,7 @@ SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(const Materials& material
 }
 
 SkinnedMeshRenderComponent::SkinnedMeshRenderComponent(Materials&& materials, bool shared) noexcept
+	: SkinnedMeshRenderComponent()
 {
 	if (shared)
 		this->setSharedMaterials(materials);
@@ -105,6 +113,20 @@ SkinnedMeshRenderComponent::getTransforms() const noexcept
 	return _transforms;
 }
 
+AnimationPosePtr
+SkinnedMeshRenderComponent::_getPose() noexcept
+{
+	auto animation = this->getComponent<AnimationComponent>();
+	if (!animation)
+		return nullptr;
+
+	auto pose = animation->getPose();
+	if (!pose || pose->getNumBones() != _transforms.size())
+		return nullptr;
+
+	return pose;
+}
+
 void
 SkinnedMeshRenderComponent::onActivate() except
 {
@@ -164,6 +186,10 @@ SkinnedMeshRenderComponent::onAttachComponent(const GameComponentPtr& component)
 		component->downcast<MeshComponent>()->addMeshChangeListener(&_onMeshChange);
 		_mesh = component->downcast<MeshComponent>()->getMesh();
 	}
+	else if (component->isA<AnimationComponent>())
+	{
+		component->downcast<AnimationComponent>()->addPoseUpdateListener(&_onPoseUpdate);
+	}
 }
 
 void
@@ -174,6 +200,10 @@ SkinnedMeshRenderComponent::onDetachComponent(const GameComponentPtr& component)
 		component->downcast<MeshComponent>()->removeMeshChangeListener(&_onMeshChange);
 		_mesh = nullptr;
 	}
+	else if (component->isA<AnimationComponent>())
+	{
+		component->downcast<AnimationComponent>()->removePoseUpdateListener(&_onPoseUpdate);
+	}
 }
 
 void
@@ -197,12 +227,20 @@ SkinnedMeshRenderComponent::onMeshWillRender(const Camera&) noexcept
 		if (_jointData->map(0, _jointData->getGraphicsDataDesc().getStreamSize(), (void**)&data))
 		{
 			auto& bindposes = _mesh->getBindposes();
+			auto pose = this->_getPose();
 			if (bindposes.size() != _transforms.size())
 			{
 				std::size_t size = _transforms.size();
 				for (std::size_t i = 0; i < size; ++i)
 					*data++ = float4x4::One;
 			}
+			else if (pose)
+			{
+				if (_paletteVersion != pose->getVersion() || _palette.size() != _transforms.size())
+					this->onPoseUpdate(*pose);
+
+				std::memcpy(data, _palette.data(), _palette.size() * sizeof(float4x4));
+			}
 			else
 			{
 				std::size_t index = 0;
@@ -217,14 +255,51 @@ SkinnedMeshRenderComponent::onMeshWillRender(const Camera&) noexcept
 	}
 }
 
+void
+SkinnedMeshRenderComponent::onPoseUpdate(const AnimationPose& pose) noexcept
+{
+	if (!_mesh)
+		return;
+
+	auto& bindposes = _mesh->getBindposes();
+	auto& transforms = pose.getWorldTransforms();
+	if (bindposes.size() != transforms.size())
+		return;
+
+	AABB aabb;
+
+	_palette.resize(transforms.size());
+
+	for (std::size_t i = 0; i < transforms.size(); ++i)
+	{
+		_palette[i] = math::transformMultiply(transforms[i], bindposes[i]);
+		aabb.encapsulate(transforms[i].getTranslate());
+	}
+
+	_paletteBoundingBox.set(aabb);
+	_paletteVersion = pose.getVersion();
+}
+
 void
 SkinnedMeshRenderComponent::onFrameEnd() noexcept
 {
 	_needUpdate = true;
 
 	AABB aabb;
-	for (auto& transform : _transforms)
-		aabb.encapsulate(transform->getWorldTranslate());
+
+	auto pose = this->_getPose();
+	if (pose)
+	{
+		if (_paletteVersion != pose->getVersion() || _palette.size() != _transforms.size())
+			this->onPoseUpdate(*pose);
+
+		aabb = _paletteBoundingBox.aabb();
+	}
+	else
+	{
+		for (auto& transform : _transforms)
+			aabb.encapsulate(transform->getWorldTranslate());
+	}
 
 	_boundingBox.set(aabb);
 
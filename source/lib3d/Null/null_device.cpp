@@ -0,0 +1,275 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_device.h"
+#include "null_device_context.h"
+#include "null_device_property.h"
+#include "null_swapchain.h"
+#include "null_shader.h"
+#include "null_texture.h"
+#include "null_framebuffer.h"
+#include "null_input_layout.h"
+#include "null_descriptor.h"
+#include "null_graphics_data.h"
+#include "null_state.h"
+#include "null_sampler.h"
+#include "null_pipeline.h"
+
+#include <cstdarg>
+
+_NAME_BEGIN
+
+__ImplementSubClass(NullDevice, GraphicsDevice, "NullDevice")
+
+NullDevice::NullDevice() noexcept
+	: _instanceCount(0)
+{
+}
+
+NullDevice::~NullDevice() noexcept
+{
+	this->close();
+}
+
+bool
+NullDevice::setup(const GraphicsDeviceDesc& desc) noexcept
+{
+	auto deviceProperty = std::make_shared<NullDeviceProperty>();
+	deviceProperty->setDevice(this->downcast_pointer<NullDevice>());
+	if (!deviceProperty->setup())
+		return false;
+
+	_deviceProperty = deviceProperty;
+	_deviceDesc = desc;
+	return true;
+}
+
+void
+NullDevice::close() noexcept
+{
+	_deviceProperty.reset();
+}
+
+GraphicsSwapchainPtr
+NullDevice::createSwapchain(const GraphicsSwapchainDesc& desc) noexcept
+{
+	auto swapchain = std::make_shared<NullSwapchain>();
+	swapchain->setDevice(this->downcast_pointer<NullDevice>());
+	if (swapchain->setup(desc))
+		return swapchain;
+	return nullptr;
+}
+
+GraphicsContextPtr
+NullDevice::createDeviceContext(const GraphicsContextDesc& desc) noexcept
+{
+	auto context = std::make_shared<NullDeviceContext>();
+	context->setDevice(this->downcast_pointer<NullDevice>());
+	if (context->setup(desc))
+	{
+		_deviceContexts.push_back(context);
+		return context;
+	}
+
+	return nullptr;
+}
+
+GraphicsInputLayoutPtr
+NullDevice::createInputLayout(const GraphicsInputLayoutDesc& desc) noexcept
+{
+	auto inputLayout = std::make_shared<NullInputLayout>();
+	inputLayout->setDevice(this->downcast_pointer<NullDevice>());
+	if (inputLayout->setup(desc))
+		return inputLayout;
+	return nullptr;
+}
+
+GraphicsDataPtr
+NullDevice::createGraphicsData(const GraphicsDataDesc& desc) noexcept
+{
+	auto data = std::make_shared<NullGraphicsData>();
+	data->setDevice(this->downcast_pointer<NullDevice>());
+	if (data->setup(desc))
+		return data;
+	return nullptr;
+}
+
+GraphicsTexturePtr
+NullDevice::createTexture(const GraphicsTextureDesc& desc) noexcept
+{
+	auto texture = std::make_shared<NullTexture>();
+	texture->setDevice(this->downcast_pointer<NullDevice>());
+	if (texture->setup(desc))
+		return texture;
+	return nullptr;
+}
+
+GraphicsSamplerPtr
+NullDevice::createSampler(const GraphicsSamplerDesc& desc) noexcept
+{
+	auto sampler = std::make_shared<NullSampler>();
+	sampler->setDevice(this->downcast_pointer<NullDevice>());
+	if (sampler->setup(desc))
+		return sampler;
+	return nullptr;
+}
+
+GraphicsFramebufferPtr
+NullDevice::createFramebuffer(const GraphicsFramebufferDesc& desc) noexcept
+{
+	auto framebuffer = std::make_shared<NullFramebuffer>();
+	framebuffer->setDevice(this->downcast_pointer<NullDevice>());
+	if (framebuffer->setup(desc))
+		return framebuffer;
+	return nullptr;
+}
+
+GraphicsFramebufferLayoutPtr
+NullDevice::createFramebufferLayout(const GraphicsFramebufferLayoutDesc& desc) noexcept
+{
+	auto framebufferLayout = std::make_shared<NullFramebufferLayout>();
+	framebufferLayout->setDevice(this->downcast_pointer<NullDevice>());
+	if (framebufferLayout->setup(desc))
+		return framebufferLayout;
+	return nullptr;
+}
+
+GraphicsStatePtr
+NullDevice::createRenderState(const GraphicsStateDesc& desc) noexcept
+{
+	auto state = std::make_shared<NullGraphicsState>();
+	state->setDevice(this->downcast_pointer<NullDevice>());
+	if (state->setup(desc))
+		return state;
+	return nullptr;
+}
+
+GraphicsShaderPtr
+NullDevice::createShader(const GraphicsShaderDesc& desc) noexcept
+{
+	auto shader = std::make_shared<NullShader>();
+	shader->setDevice(this->downcast_pointer<NullDevice>());
+	if (shader->setup(desc))
+		return shader;
+	return nullptr;
+}
+
+GraphicsProgramPtr
+NullDevice::createProgram(const GraphicsProgramDesc& desc) noexcept
+{
+	auto program = std::make_shared<NullProgram>();
+	program->setDevice(this->downcast_pointer<NullDevice>());
+	if (program->setup(desc))
+		return program;
+	return nullptr;
+}
+
+GraphicsPipelinePtr
+NullDevice::createRenderPipeline(const GraphicsPipelineDesc& desc) noexcept
+{
+	auto pipeline = std::make_shared<NullPipeline>();
+	pipeline->setDevice(this->downcast_pointer<NullDevice>());
+	if (pipeline->setup(desc))
+		return pipeline;
+	return nullptr;
+}
+
+GraphicsDescriptorSetPtr
+NullDevice::createDescriptorSet(const GraphicsDescriptorSetDesc& desc) noexcept
+{
+	auto descriptorSet = std::make_shared<NullDescriptorSet>();
+	descriptorSet->setDevice(this->downcast_pointer<NullDevice>());
+	if (descriptorSet->setup(desc))
+		return descriptorSet;
+	return nullptr;
+}
+
+GraphicsDescriptorSetLayoutPtr
+NullDevice::createDescriptorSetLayout(const GraphicsDescriptorSetLayoutDesc& desc) noexcept
+{
+	auto descriptorSetLayout = std::make_shared<NullDescriptorSetLayout>();
+	descriptorSetLayout->setDevice(this->downcast_pointer<NullDevice>());
+	if (descriptorSetLayout->setup(desc))
+		return descriptorSetLayout;
+	return nullptr;
+}
+
+GraphicsDescriptorPoolPtr
+NullDevice::createDescriptorPool(const GraphicsDescriptorPoolDesc& desc) noexcept
+{
+	auto descriptorPool = std::make_shared<NullDescriptorPool>();
+	descriptorPool->setDevice(this->downcast_pointer<NullDevice>());
+	if (descriptorPool->setup(desc))
+		return descriptorPool;
+	return nullptr;
+}
+
+void
+NullDevice::copyDescriptorSets(GraphicsDescriptorSetPtr& source, std::uint32_t descriptorCopyCount, const GraphicsDescriptorSetPtr descriptorCopies[]) noexcept
+{
+	assert(source);
+	source->downcast<NullDescriptorSet>()->copy(descriptorCopyCount, descriptorCopies);
+}
+
+const GraphicsDeviceProperty&
+NullDevice::getGraphicsDeviceProperty() const noexcept
+{
+	return *_deviceProperty;
+}
+
+const GraphicsDeviceDesc&
+NullDevice::getGraphicsDeviceDesc() const noexcept
+{
+	return _deviceDesc;
+}
+
+std::uint32_t
+NullDevice::allocInstanceID() noexcept
+{
+	return ++_instanceCount;
+}
+
+void
+NullDevice::message(const char* message, ...) noexcept
+{
+	va_list va;
+	va_start(va, message);
+	vprintf(message, va);
+	printf("\n");
+	va_end(va);
+}
+
+_NAME_END
@@ -0,0 +1,657 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_device_context.h"
+#include "null_device.h"
+#include "null_swapchain.h"
+#include "null_graphics_data.h"
+#include "null_texture.h"
+#include "null_framebuffer.h"
+#include "null_descriptor.h"
+#include "null_pipeline.h"
+
+_NAME_BEGIN
+
+__ImplementSubClass(NullDeviceContext, GraphicsContext, "NullDeviceContext")
+
+NullDeviceContext::NullDeviceContext() noexcept
+	: _primitiveType(GraphicsVertexType::GraphicsVertexTypeTriangleList)
+	, _indexType(GraphicsIndexType::GraphicsIndexTypeUInt32)
+	, _indexOffset(0)
+	, _needUpdatePipeline(false)
+	, _needUpdateDescriptor(false)
+	, _descriptorSetApplied(nullptr)
+	, _uniformStreamData(nullptr)
+	, _uniformStreamSize(0)
+	, _uniformStreamCount(3)
+	, _uniformStreamIndex(0)
+	, _uniformStreamOffset(0)
+	, _uniformStreamAlignment(1)
+	, _uniformUploadBytes(0)
+	, _uniformUploadSkips(0)
+{
+}
+
+NullDeviceContext::~NullDeviceContext() noexcept
+{
+	this->close();
+}
+
+bool
+NullDeviceContext::setup(const GraphicsContextDesc& desc) noexcept
+{
+	assert(desc.getSwapchain());
+	assert(desc.getSwapchain()->isInstanceOf<NullSwapchain>());
+
+	_swapchain = desc.getSwapchain()->downcast_pointer<NullSwapchain>();
+
+	if (!this->initStateSystem())
+		return false;
+
+	if (desc.getUniformStreamSize() > 0)
+	{
+		if (!this->initUniformStream(desc.getUniformStreamSize()))
+			return false;
+	}
+
+	return true;
+}
+
+void
+NullDeviceContext::close() noexcept
+{
+	_uniformStream.reset();
+	_uniformStreamData = nullptr;
+
+	_framebuffer.reset();
+	_pipeline.reset();
+	_descriptorSet.reset();
+	_descriptorSetApplied = nullptr;
+	_indexBuffer.reset();
+	_swapchain.reset();
+	_vertexBuffers.clear();
+}
+
+void
+NullDeviceContext::renderBegin() noexcept
+{
+	_uniformUploadBytes = 0;
+	_uniformUploadSkips = 0;
+
+	if (_uniformStream)
+		_uniformStreamOffset = _uniformStreamIndex * _uniformStreamSize;
+}
+
+void
+NullDeviceContext::renderEnd() noexcept
+{
+	if (_uniformStream)
+		_uniformStreamIndex = (_uniformStreamIndex + 1) % _uniformStreamCount;
+}
+
+void
+NullDeviceContext::setViewport(std::uint32_t i, const Viewport& view) noexcept
+{
+	if (_viewports[i] != view)
+	{
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetViewport, i, (std::uint32_t)view.width, (std::uint32_t)view.height);
+		_viewports[i] = view;
+	}
+}
+
+const Viewport&
+NullDeviceContext::getViewport(std::uint32_t i) const noexcept
+{
+	return _viewports[i];
+}
+
+void
+NullDeviceContext::setScissor(std::uint32_t i, const Scissor& scissor) noexcept
+{
+	if (_scissors[i] != scissor)
+	{
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetScissor, i, scissor.width, scissor.height);
+		_scissors[i] = scissor;
+	}
+}
+
+const Scissor&
+NullDeviceContext::getScissor(std::uint32_t i) const noexcept
+{
+	return _scissors[i];
+}
+
+void
+NullDeviceContext::setStencilCompareMask(GraphicsStencilFaceFlags face, std::uint32_t mask) noexcept
+{
+	bool changed = false;
+
+	if (face & GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit)
+	{
+		if (_stateCaptured.getStencilFrontReadMask() != mask)
+		{
+			_stateCaptured.setStencilFrontReadMask(mask);
+			changed = true;
+		}
+	}
+	if (face & GraphicsStencilFaceFlagBits::GraphicsStencilFaceBackBit)
+	{
+		if (_stateCaptured.getStencilBackReadMask() != mask)
+		{
+			_stateCaptured.setStencilBackReadMask(mask);
+			changed = true;
+		}
+	}
+
+	if (changed)
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilCompareMask, face, mask);
+}
+
+std::uint32_t
+NullDeviceContext::getStencilCompareMask(GraphicsStencilFaceFlagBits face) noexcept
+{
+	assert(face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit || face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceBackBit);
+
+	if (face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit)
+		return _stateCaptured.getStencilFrontReadMask();
+	else
+		return _stateCaptured.getStencilBackReadMask();
+}
+
+void
+NullDeviceContext::setStencilReference(GraphicsStencilFaceFlags face, std::uint32_t reference) noexcept
+{
+	bool changed = false;
+
+	if (face & GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit)
+	{
+		if (_stateCaptured.getStencilFrontRef() != reference)
+		{
+			_stateCaptured.setStencilFrontRef(reference);
+			changed = true;
+		}
+	}
+	if (face & GraphicsStencilFaceFlagBits::GraphicsStencilFaceBackBit)
+	{
+		if (_stateCaptured.getStencilBackRef() != reference)
+		{
+			_stateCaptured.setStencilBackRef(reference);
+			changed = true;
+		}
+	}
+
+	if (changed)
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilReference, face, reference);
+}
+
+std::uint32_t
+NullDeviceContext::getStencilReference(GraphicsStencilFaceFlagBits face) noexcept
+{
+	assert(face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit || face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceBackBit);
+
+	if (face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit)
+		return _stateCaptured.getStencilFrontRef();
+	else
+		return _stateCaptured.getStencilBackRef();
+}
+
+void
+NullDeviceContext::setStencilWriteMask(GraphicsStencilFaceFlags face, std::uint32_t mask) noexcept
+{
+	bool changed = false;
+
+	if (face & GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit)
+	{
+		if (_stateCaptured.getStencilFrontWriteMask() != mask)
+		{
+			_stateCaptured.setStencilFrontWriteMask(mask);
+			changed = true;
+		}
+	}
+	if (face & GraphicsStencilFaceFlagBits::GraphicsStencilFaceBackBit)
+	{
+		if (_stateCaptured.getStencilBackWriteMask() != mask)
+		{
+			_stateCaptured.setStencilBackWriteMask(mask);
+			changed = true;
+		}
+	}
+
+	if (changed)
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilWriteMask, face, mask);
+}
+
+std::uint32_t
+NullDeviceContext::getStencilWriteMask(GraphicsStencilFaceFlagBits face) noexcept
+{
+	assert(face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit || face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceBackBit);
+
+	if (face == GraphicsStencilFaceFlagBits::GraphicsStencilFaceFrontBit)
+		return _stateCaptured.getStencilFrontWriteMask();
+	else
+		return _stateCaptured.getStencilBackWriteMask();
+}
+
+void
+NullDeviceContext::setRenderPipeline(const GraphicsPipelinePtr& pipeline) noexcept
+{
+	assert(pipeline);
+	assert(pipeline->isInstanceOf<NullPipeline>());
+
+	auto nullPipeline = pipeline->downcast_pointer<NullPipeline>();
+	if (_pipeline != nullPipeline)
+	{
+		auto& pipelineDesc = pipeline->getGraphicsPipelineDesc();
+
+		_stateCaptured = pipelineDesc.getGraphicsState()->getGraphicsStateDesc();
+		_primitiveType = _stateCaptured.getPrimitiveType();
+
+		_pipeline = nullPipeline;
+		_needUpdatePipeline = true;
+
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetPipeline, _pipeline->getInstanceID());
+	}
+}
+
+GraphicsPipelinePtr
+NullDeviceContext::getRenderPipeline() const noexcept
+{
+	return _pipeline;
+}
+
+void
+NullDeviceContext::setDescriptorSet(const GraphicsDescriptorSetPtr& descriptorSet) noexcept
+{
+	assert(descriptorSet);
+	assert(descriptorSet->isInstanceOf<NullDescriptorSet>());
+
+	auto nullDescriptorSet = descriptorSet->downcast_pointer<NullDescriptorSet>();
+	if (_descriptorSet != nullDescriptorSet)
+	{
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetDescriptorSet, (std::uint32_t)nullDescriptorSet->getGraphicsUniformSets().size());
+		_descriptorSet = nullDescriptorSet;
+	}
+
+	_needUpdateDescriptor = true;
+}
+
+GraphicsDescriptorSetPtr
+NullDeviceContext::getDescriptorSet() const noexcept
+{
+	return _descriptorSet;
+}
+
+void
+NullDeviceContext::setVertexBufferData(std::uint32_t i, const GraphicsDataPtr& data, std::intptr_t offset) noexcept
+{
+	assert(data);
+	assert(data->isInstanceOf<NullGraphicsData>());
+	assert(data->getGraphicsDataDesc().getType() == GraphicsDataType::GraphicsDataTypeStorageVertexBuffer);
+	assert(_vertexBuffers.size() > i);
+
+	auto vbo = data->downcast_pointer<NullGraphicsData>();
+	if (_vertexBuffers[i].vbo != vbo || _vertexBuffers[i].offset != offset)
+	{
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetVertexBuffer, i, vbo->getInstanceID(), (std::uint32_t)offset);
+
+		_vertexBuffers[i].vbo = vbo;
+		_vertexBuffers[i].offset = offset;
+	}
+}
+
+GraphicsDataPtr
+NullDeviceContext::getVertexBufferData(std::uint32_t i) const noexcept
+{
+	assert(_vertexBuffers.size() > i);
+	return _vertexBuffers[i].vbo;
+}
+
+void
+NullDeviceContext::setIndexBufferData(const GraphicsDataPtr& data, std::intptr_t offset, GraphicsIndexType indexType) noexcept
+{
+	assert(data);
+	assert(data->isInstanceOf<NullGraphicsData>());
+	assert(data->getGraphicsDataDesc().getType() == GraphicsDataType::GraphicsDataTypeStorageIndexBuffer);
+	assert(indexType == GraphicsIndexType::GraphicsIndexTypeUInt16 || indexType == GraphicsIndexType::GraphicsIndexTypeUInt32);
+
+	auto ibo = data->downcast_pointer<NullGraphicsData>();
+	if (_indexBuffer != ibo || _indexOffset != offset || _indexType != indexType)
+	{
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetIndexBuffer, ibo->getInstanceID(), (std::uint32_t)offset, (std::uint32_t)indexType);
+
+		_indexBuffer = ibo;
+		_indexOffset = offset;
+		_indexType = indexType;
+	}
+}
+
+GraphicsDataPtr
+NullDeviceContext::getIndexBufferData() const noexcept
+{
+	return _indexBuffer;
+}
+
+bool
+NullDeviceContext::uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept
+{
+	assert(data && size > 0);
+
+	if (!_uniformStream)
+		return false;
+
+	std::uint32_t first = (_uniformStreamOffset + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+	if (first + size > (_uniformStreamIndex + 1) * _uniformStreamSize)
+		return false;
+
+	std::memcpy(_uniformStreamData + first, data, size);
+
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeUploadUniform, size, first);
+
+	offset = first;
+	_uniformStreamOffset = first + size;
+	return true;
+}
+
+GraphicsDataPtr
+NullDeviceContext::getUniformStreamData() const noexcept
+{
+	return _uniformStream;
+}
+
+std::uint32_t
+NullDeviceContext::getUniformUploadBytes() const noexcept
+{
+	return _uniformUploadBytes;
+}
+
+std::uint32_t
+NullDeviceContext::getUniformUploadSkips() const noexcept
+{
+	return _uniformUploadSkips;
+}
+
+void
+NullDeviceContext::generateMipmap(const GraphicsTexturePtr& texture) noexcept
+{
+	assert(texture);
+	assert(texture->isInstanceOf<NullTexture>());
+
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeGenerateMipmap, texture->downcast<NullTexture>()->getInstanceID());
+}
+
+void
+NullDeviceContext::setFramebuffer(const GraphicsFramebufferPtr& target) noexcept
+{
+	if (target)
+	{
+		auto framebuffer = target->downcast_pointer<NullFramebuffer>();
+		if (_framebuffer != framebuffer)
+		{
+			_framebuffer = framebuffer;
+
+			GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetFramebuffer, _framebuffer->getInstanceID());
+
+			auto& framebufferDesc = _framebuffer->getGraphicsFramebufferDesc();
+			auto& colorAttachment = framebufferDesc.getColorAttachments();
+
+			std::uint32_t viewportCount = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(colorAttachment.size()));
+			for (std::uint32_t i = 0; i < viewportCount; i++)
+				this->setViewport(i, Viewport(0.0f, 0.0f, (float)framebufferDesc.getWidth(), (float)framebufferDesc.getHeight()));
+		}
+	}
+	else
+	{
+		if (_framebuffer)
+			GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeSetFramebuffer, 0);
+
+		_framebuffer = nullptr;
+	}
+}
+
+void
+NullDeviceContext::setFramebufferClear(std::uint32_t, GraphicsClearFlags, const float4&, float, std::int32_t) noexcept
+{
+}
+
+void
+NullDeviceContext::clearFramebuffer(std::uint32_t i, GraphicsClearFlags flags, const float4&, float, std::int32_t) noexcept
+{
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeClearFramebuffer, i, flags);
+}
+
+void
+NullDeviceContext::discardFramebuffer(std::uint32_t i) noexcept
+{
+	assert(_framebuffer);
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeDiscardFramebuffer, _framebuffer->getInstanceID(), i);
+}
+
+void
+NullDeviceContext::blitFramebuffer(const GraphicsFramebufferPtr& src, const Viewport&, const GraphicsFramebufferPtr& dest, const Viewport& v2) noexcept
+{
+	assert(src);
+	assert(src->isInstanceOf<NullFramebuffer>());
+	assert(!dest || (dest && dest->isInstanceOf<NullFramebuffer>()));
+
+	auto srcID = src->downcast<NullFramebuffer>()->getInstanceID();
+	auto destID = dest ? dest->downcast<NullFramebuffer>()->getInstanceID() : 0;
+
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeBlitFramebuffer, srcID, destID, (std::uint32_t)v2.width, (std::uint32_t)v2.height);
+}
+
+void
+NullDeviceContext::readFramebuffer(std::uint32_t i, const GraphicsTexturePtr& texture, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t width, std::uint32_t height) noexcept
+{
+	assert(texture && texture->isInstanceOf<NullTexture>());
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeReadFramebuffer, i, texture->downcast<NullTexture>()->getInstanceID(), width, height);
+}
+
+void
+NullDeviceContext::readFramebufferToCube(std::uint32_t i, std::uint32_t, const GraphicsTexturePtr& texture, std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t width, std::uint32_t height) noexcept
+{
+	assert(texture && texture->isInstanceOf<NullTexture>());
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeReadFramebuffer, i, texture->downcast<NullTexture>()->getInstanceID(), width, height);
+}
+
+GraphicsFramebufferPtr
+NullDeviceContext::getFramebuffer() const noexcept
+{
+	return _framebuffer;
+}
+
+void
+NullDeviceContext::draw(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t startVertice, std::uint32_t) noexcept
+{
+	assert(_pipeline);
+	assert(startInstances == 0);
+
+	this->applyDescriptorSet();
+
+	if (numVertices > 0)
+	{
+		auto primitives = NullTypes::getPrimitiveCount(_primitiveType, numVertices);
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeDraw, numVertices, numInstances, primitives, startVertice);
+	}
+}
+
+void
+NullDeviceContext::drawIndexed(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t startIndice, std::uint32_t, std::uint32_t) noexcept
+{
+	assert(_pipeline);
+	assert(_indexBuffer);
+	assert(startInstances == 0);
+
+	this->applyDescriptorSet();
+
+	if (numIndices > 0)
+	{
+		auto primitives = NullTypes::getPrimitiveCount(_primitiveType, numIndices);
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndexed, numIndices, numInstances, primitives, startIndice);
+	}
+}
+
+void
+NullDeviceContext::drawIndirect(const GraphicsDataPtr& data, std::size_t offset, std::uint32_t drawCount, std::uint32_t stride) noexcept
+{
+	assert(_pipeline);
+	assert(data && data->getGraphicsDataDesc().getType() == GraphicsDataType::GraphicsDataTypeIndirectBiffer);
+
+	this->applyDescriptorSet();
+
+	if (drawCount > 0)
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndirect, data->downcast<NullGraphicsData>()->getInstanceID(), (std::uint32_t)offset, drawCount, stride);
+}
+
+void
+NullDeviceContext::drawIndexedIndirect(const GraphicsDataPtr& data, std::size_t offset, std::uint32_t drawCount, std::uint32_t stride) noexcept
+{
+	assert(_pipeline);
+	assert(data && data->getGraphicsDataDesc().getType() == GraphicsDataType::GraphicsDataTypeIndirectBiffer);
+
+	this->applyDescriptorSet();
+
+	if (drawCount > 0)
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndexedIndirect, data->downcast<NullGraphicsData>()->getInstanceID(), (std::uint32_t)offset, drawCount, stride);
+}
+
+void
+NullDeviceContext::enableDebugControl(bool) noexcept
+{
+}
+
+void
+NullDeviceContext::startDebugControl() noexcept
+{
+}
+
+void
+NullDeviceContext::stopDebugControl() noexcept
+{
+}
+
+void
+NullDeviceContext::present() noexcept
+{
+	assert(_swapchain);
+	_swapchain->present();
+}
+
+void
+NullDeviceContext::applyDescriptorSet() noexcept
+{
+	if (!_needUpdateDescriptor && !_needUpdatePipeline)
+		return;
+
+	if (_descriptorSet)
+	{
+		bool forceUpdate = _needUpdatePipeline || _descriptorSetApplied != _descriptorSet.get();
+
+		std::uint32_t uploadBytes = 0;
+		_descriptorSet->apply(forceUpdate, uploadBytes, _uniformUploadSkips);
+		_descriptorSetApplied = _descriptorSet.get();
+
+		if (uploadBytes > 0)
+		{
+			GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeUploadUniform, uploadBytes);
+			_uniformUploadBytes += uploadBytes;
+		}
+	}
+
+	_needUpdatePipeline = false;
+	_needUpdateDescriptor = false;
+}
+
+bool
+NullDeviceContext::initUniformStream(std::uint32_t size) noexcept
+{
+	auto& deviceProperties = this->getDevice()->getGraphicsDeviceProperty().getGraphicsDeviceProperties();
+
+	_uniformStreamAlignment = std::max<std::uint32_t>(deviceProperties.minUniformBufferOffsetAlignment, 1);
+	_uniformStreamSize = (size + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+
+	GraphicsDataDesc uniformStreamDesc;
+	uniformStreamDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+	uniformStreamDesc.setStreamSize(_uniformStreamSize * _uniformStreamCount);
+	uniformStreamDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit | GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit | GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit);
+
+	auto uniformStream = this->getDevice()->createGraphicsData(uniformStreamDesc);
+	if (!uniformStream)
+	{
+		this->getDevice()->downcast<NullDevice>()->message("Can't create uniform stream buffer.");
+		return false;
+	}
+
+	void* data = nullptr;
+	if (!uniformStream->map(0, uniformStreamDesc.getStreamSize(), &data))
+	{
+		this->getDevice()->downcast<NullDevice>()->message("Can't map uniform stream buffer.");
+		return false;
+	}
+
+	_uniformStream = uniformStream->downcast_pointer<NullGraphicsData>();
+	_uniformStreamData = (std::uint8_t*)data;
+	_uniformStreamIndex = 0;
+	_uniformStreamOffset = 0;
+	return true;
+}
+
+bool
+NullDeviceContext::initStateSystem() noexcept
+{
+	auto& deviceProperties = this->getDevice()->getGraphicsDeviceProperty().getGraphicsDeviceProperties();
+	_vertexBuffers.resize(deviceProperties.maxVertexInputBindings);
+	_viewports.resize(deviceProperties.maxViewports, Viewport(0, 0, 0, 0));
+	_scissors.resize(deviceProperties.maxViewports, Scissor(0, 0, 0, 0));
+
+	GraphicsColorBlends blends(deviceProperties.maxFramebufferColorAttachments);
+	_stateCaptured.setColorBlends(blends);
+
+	return true;
+}
+
+void
+NullDeviceContext::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullDeviceContext::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+_NAME_END
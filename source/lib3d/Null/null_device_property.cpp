@@ -0,0 +1,113 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_device_property.h"
+
+_NAME_BEGIN
+
+NullDeviceProperty::NullDeviceProperty() noexcept
+{
+}
+
+NullDeviceProperty::~NullDeviceProperty() noexcept
+{
+	this->close();
+}
+
+bool
+NullDeviceProperty::setup() noexcept
+{
+	for (std::uint32_t i = (std::uint32_t)GraphicsFormat::GraphicsFormatBeginRange + 1; i <= (std::uint32_t)GraphicsFormat::GraphicsFormatEndRange; i++)
+	{
+		_deviceProperties.supportTextures.push_back((GraphicsFormat)i);
+		_deviceProperties.supportAttribute.push_back((GraphicsFormat)i);
+	}
+
+	for (std::uint32_t i = (std::uint32_t)GraphicsTextureDim::GraphicsTextureDimBeginRange; i <= (std::uint32_t)GraphicsTextureDim::GraphicsTextureDimEndRange; i++)
+		_deviceProperties.supportTextureDims.push_back((GraphicsTextureDim)i);
+
+	_deviceProperties.supportShaders.push_back(GraphicsShaderStageFlagBits::GraphicsShaderStageVertexBit);
+	_deviceProperties.supportShaders.push_back(GraphicsShaderStageFlagBits::GraphicsShaderStageFragmentBit);
+	_deviceProperties.supportShaders.push_back(GraphicsShaderStageFlagBits::GraphicsShaderStageGeometryBit);
+	_deviceProperties.supportShaders.push_back(GraphicsShaderStageFlagBits::GraphicsShaderStageComputeBit);
+
+	_deviceProperties.maxImageDimension1D = 16384;
+	_deviceProperties.maxImageDimension2D = 16384;
+	_deviceProperties.maxImageDimension3D = 2048;
+	_deviceProperties.maxImageDimensionCube = 16384;
+	_deviceProperties.maxImageArrayLayers = 2048;
+	_deviceProperties.maxUniformBufferRange = 65536;
+	_deviceProperties.maxBoundDescriptorSets = 8;
+	_deviceProperties.maxVertexInputAttributes = 16;
+	_deviceProperties.maxVertexInputBindings = 16;
+	_deviceProperties.maxFragmentOutputAttachments = 8;
+	_deviceProperties.maxViewports = 16;
+	_deviceProperties.maxViewportDimensionsW = 16384;
+	_deviceProperties.maxViewportDimensionsH = 16384;
+	_deviceProperties.maxFramebufferWidth = 16384;
+	_deviceProperties.maxFramebufferHeight = 16384;
+	_deviceProperties.maxFramebufferLayers = 2048;
+	_deviceProperties.maxFramebufferColorAttachments = 8;
+	_deviceProperties.maxSamplerAnisotropy = 16;
+	_deviceProperties.minUniformBufferOffsetAlignment = 256;
+
+	return true;
+}
+
+void
+NullDeviceProperty::close() noexcept
+{
+}
+
+void
+NullDeviceProperty::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullDeviceProperty::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+const GraphicsDeviceProperties&
+NullDeviceProperty::getGraphicsDeviceProperties() const noexcept
+{
+	return _deviceProperties;
+}
+
+_NAME_END
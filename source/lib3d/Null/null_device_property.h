@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,18 +34,36 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#ifndef _H_RENDER_TYPES_H_
-#define _H_RENDER_TYPES_H_
+#ifndef _H_NULL_DEVICE_PROPERTY_H_
+#define _H_NULL_DEVICE_PROPERTY_H_
 
-#include <ray/math.h>
+#include "null_types.h"
 
 _NAME_BEGIN
 
-typedef class OcclusionObject* OcclusionObjectPtr;
+class NullDeviceProperty final : public GraphicsDeviceProperty
+{
+public:
+	NullDeviceProperty() noexcept;
+	~NullDeviceProperty() noexcept;
 
-typedef std::vector<OcclusionObjectPtr> OcclusionObjectContainer;
-typedef std::vector<class OcclusionQuery*> OcclusionQueryContainer;
+	bool setup() noexcept;
+	void close() noexcept;
+
+	void setDevice(const GraphicsDevicePtr& device) noexcept;
+	GraphicsDevicePtr getDevice() noexcept;
+
+	const GraphicsDeviceProperties& getGraphicsDeviceProperties() const noexcept;
+
+private:
+	NullDeviceProperty(const NullDeviceProperty&) = delete;
+	NullDeviceProperty& operator=(const NullDeviceProperty&) = delete;
+
+private:
+	GraphicsDeviceWeakPtr _device;
+	GraphicsDeviceProperties _deviceProperties;
+};
 
 _NAME_END
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,137 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_framebuffer.h"
+#include "null_device.h"
+
+_NAME_BEGIN
+
+__ImplementSubClass(NullFramebufferLayout, GraphicsFramebufferLayout, "NullFramebufferLayout")
+
+NullFramebufferLayout::NullFramebufferLayout() noexcept
+{
+}
+
+NullFramebufferLayout::~NullFramebufferLayout() noexcept
+{
+	this->close();
+}
+
+bool
+NullFramebufferLayout::setup(const GraphicsFramebufferLayoutDesc& desc) noexcept
+{
+	_desc = desc;
+	return true;
+}
+
+void
+NullFramebufferLayout::close() noexcept
+{
+}
+
+const GraphicsFramebufferLayoutDesc&
+NullFramebufferLayout::getGraphicsFramebufferLayoutDesc() const noexcept
+{
+	return _desc;
+}
+
+void
+NullFramebufferLayout::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullFramebufferLayout::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+__ImplementSubClass(NullFramebuffer, GraphicsFramebuffer, "NullFramebuffer")
+
+NullFramebuffer::NullFramebuffer() noexcept
+	: _instance(0)
+{
+}
+
+NullFramebuffer::~NullFramebuffer() noexcept
+{
+	this->close();
+}
+
+bool
+NullFramebuffer::setup(const GraphicsFramebufferDesc& desc) noexcept
+{
+	assert(_instance == 0);
+
+	_instance = this->getDevice()->downcast<NullDevice>()->allocInstanceID();
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeCreateFramebuffer, _instance, desc.getWidth(), desc.getHeight(), (std::uint32_t)desc.getColorAttachments().size());
+
+	_desc = desc;
+	return true;
+}
+
+void
+NullFramebuffer::close() noexcept
+{
+	_instance = 0;
+}
+
+std::uint32_t
+NullFramebuffer::getInstanceID() const noexcept
+{
+	return _instance;
+}
+
+const GraphicsFramebufferDesc&
+NullFramebuffer::getGraphicsFramebufferDesc() const noexcept
+{
+	return _desc;
+}
+
+void
+NullFramebuffer::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullFramebuffer::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+_NAME_END
@@ -0,0 +1,134 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_graphics_data.h"
+#include "null_device.h"
+
+_NAME_BEGIN
+
+__ImplementSubClass(NullGraphicsData, GraphicsData, "NullGraphicsData")
+
+NullGraphicsData::NullGraphicsData() noexcept
+	: _instance(0)
+	, _mapOffset(0)
+	, _mapCount(0)
+{
+}
+
+NullGraphicsData::~NullGraphicsData() noexcept
+{
+	this->close();
+}
+
+bool
+NullGraphicsData::setup(const GraphicsDataDesc& desc) noexcept
+{
+	assert(_instance == 0);
+
+	_instance = this->getDevice()->downcast<NullDevice>()->allocInstanceID();
+	_data.resize(desc.getStreamSize());
+
+	auto log = GraphicsCommandLog::instance();
+	log->record(GraphicsCommandLogType::GraphicsCommandLogTypeCreateBuffer, _instance, (std::uint32_t)desc.getType(), (std::uint32_t)desc.getStreamSize(), desc.getUsage());
+
+	if (desc.getStream() && desc.getStreamSize() > 0)
+	{
+		std::memcpy(_data.data(), desc.getStream(), desc.getStreamSize());
+		log->record(GraphicsCommandLogType::GraphicsCommandLogTypeUploadBuffer, _instance, 0, (std::uint32_t)desc.getStreamSize());
+	}
+
+	_desc = desc;
+	return true;
+}
+
+void
+NullGraphicsData::close() noexcept
+{
+	_data.clear();
+	_data.shrink_to_fit();
+}
+
+bool
+NullGraphicsData::map(std::ptrdiff_t offset, std::ptrdiff_t count, void** data) noexcept
+{
+	assert(data);
+
+	if (offset < 0 || count < 0 || (std::size_t)(offset + count) > _data.size())
+		return false;
+
+	_mapOffset = offset;
+	_mapCount = count;
+
+	*data = _data.data() + offset;
+	return true;
+}
+
+void
+NullGraphicsData::unmap() noexcept
+{
+	auto usage = _desc.getUsage();
+	if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit)
+		GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeUploadBuffer, _instance, (std::uint32_t)_mapOffset, (std::uint32_t)_mapCount);
+
+	_mapOffset = 0;
+	_mapCount = 0;
+}
+
+std::uint32_t
+NullGraphicsData::getInstanceID() const noexcept
+{
+	return _instance;
+}
+
+const GraphicsDataDesc&
+NullGraphicsData::getGraphicsDataDesc() const noexcept
+{
+	return _desc;
+}
+
+void
+NullGraphicsData::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullGraphicsData::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+_NAME_END
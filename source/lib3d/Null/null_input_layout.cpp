@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,31 +34,49 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#include <ray/frustum_cull.h>
+#include "null_input_layout.h"
 
 _NAME_BEGIN
 
-FrustumCull::FrustumCull() noexcept
+__ImplementSubClass(NullInputLayout, GraphicsInputLayout, "NullInputLayout")
+
+NullInputLayout::NullInputLayout() noexcept
+{
+}
+
+NullInputLayout::~NullInputLayout() noexcept
+{
+	this->close();
+}
+
+bool
+NullInputLayout::setup(const GraphicsInputLayoutDesc& desc) noexcept
+{
+	_desc = desc;
+	return true;
+}
+
+void
+NullInputLayout::close() noexcept
+{
+}
+
+const GraphicsInputLayoutDesc&
+NullInputLayout::getGraphicsInputLayoutDesc() const noexcept
 {
+	return _desc;
 }
 
 void
-FrustumCull::traverse() noexcept
+NullInputLayout::setDevice(const GraphicsDevicePtr& device) noexcept
 {
-    while (!_distanceQueue.empty())
-    {
-        OcclusionObjectPtr object = _distanceQueue.front();
-        _distanceQueue.pop();
+	_device = device;
+}
 
-        if (_tree->isVisiable(object))
-        {
-            this->traverseObject(object);
-        }
-        else
-        {
-            _frustumCulledCount++;
-        }
-    }
+GraphicsDevicePtr
+NullInputLayout::getDevice() noexcept
+{
+	return _device.lock();
 }
 
-_NAME_END
\ No newline at end of file
+_NAME_END
@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,35 +34,49 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#include <ray/occlusion_traverser.h>
+#include "null_sampler.h"
 
 _NAME_BEGIN
 
-void 
-OcclusionTraverser::traverse() noexcept
-{
+__ImplementSubClass(NullSampler, GraphicsSampler, "NullSampler")
 
+NullSampler::NullSampler() noexcept
+{
 }
 
-void 
-OcclusionTraverser::traverseObject(OcclusionObjectPtr object) noexcept
+NullSampler::~NullSampler() noexcept
 {
-    if (object->isVirtualLeaf())
-    {
+	this->close();
+}
 
-    }
-    else
-    {
+bool
+NullSampler::setup(const GraphicsSamplerDesc& desc) noexcept
+{
+	_desc = desc;
+	return true;
+}
 
-    }
+void
+NullSampler::close() noexcept
+{
 }
 
-void 
-OcclusionTraverser::update() noexcept
+const GraphicsSamplerDesc&
+NullSampler::getGraphicsSamplerDesc() const noexcept
 {
+	return _desc;
+}
 
+void
+NullSampler::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
 
-    this->traverse();
+GraphicsDevicePtr
+NullSampler::getDevice() noexcept
+{
+	return _device.lock();
 }
 
-_NAME_END
\ No newline at end of file
+_NAME_END
@@ -0,0 +1,687 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_shader.h"
+#include "null_device.h"
+
+#include <hlslcc.hpp>
+
+#if defined(_BUILD_PLATFORM_WINDOWS)
+#	include <d3dcompiler.h>
+#endif
+
+_NAME_BEGIN
+
+__ImplementSubClass(NullShader, GraphicsShader, "NullShader")
+__ImplementSubClass(NullProgram, GraphicsProgram, "NullProgram")
+__ImplementSubClass(NullGraphicsAttribute, GraphicsAttribute, "NullGraphicsAttribute")
+__ImplementSubClass(NullGraphicsUniform, GraphicsUniform, "NullGraphicsUniform")
+__ImplementSubClass(NullGraphicsUniformBlock, GraphicsUniformBlock, "NullGraphicsUniformBlock")
+
+NullGraphicsAttribute::NullGraphicsAttribute() noexcept
+	: _semanticIndex(0)
+	, _bindingPoint(std::numeric_limits<std::uint32_t>::max())
+	, _type(GraphicsFormat::GraphicsFormatUndefined)
+{
+}
+
+NullGraphicsAttribute::~NullGraphicsAttribute() noexcept
+{
+}
+
+void
+NullGraphicsAttribute::setSemantic(const std::string& semantic) noexcept
+{
+	_semantic = semantic;
+}
+
+const std::string&
+NullGraphicsAttribute::getSemantic() const noexcept
+{
+	return _semantic;
+}
+
+void
+NullGraphicsAttribute::setSemanticIndex(std::uint32_t index) noexcept
+{
+	_semanticIndex = index;
+}
+
+std::uint32_t
+NullGraphicsAttribute::getSemanticIndex() const noexcept
+{
+	return _semanticIndex;
+}
+
+void
+NullGraphicsAttribute::setType(GraphicsFormat type) noexcept
+{
+	_type = type;
+}
+
+GraphicsFormat
+NullGraphicsAttribute::getType() const noexcept
+{
+	return _type;
+}
+
+void
+NullGraphicsAttribute::setBindingPoint(std::uint32_t bindingPoint) noexcept
+{
+	_bindingPoint = bindingPoint;
+}
+
+std::uint32_t
+NullGraphicsAttribute::getBindingPoint() const noexcept
+{
+	return _bindingPoint;
+}
+
+NullGraphicsUniform::NullGraphicsUniform() noexcept
+	: _offset(0)
+	, _bindingPoint(std::numeric_limits<std::uint32_t>::max())
+	, _type(GraphicsUniformType::GraphicsUniformTypeNone)
+	, _stageFlags(0)
+{
+}
+
+NullGraphicsUniform::~NullGraphicsUniform() noexcept
+{
+}
+
+void
+NullGraphicsUniform::setName(const std::string& name) noexcept
+{
+	_name = name;
+}
+
+const std::string&
+NullGraphicsUniform::getName() const noexcept
+{
+	return _name;
+}
+
+void
+NullGraphicsUniform::setSamplerName(const std::string& name) noexcept
+{
+	_samplerName = name;
+}
+
+const std::string&
+NullGraphicsUniform::getSamplerName() const noexcept
+{
+	return _samplerName;
+}
+
+void
+NullGraphicsUniform::setType(GraphicsUniformType type) noexcept
+{
+	_type = type;
+}
+
+GraphicsUniformType
+NullGraphicsUniform::getType() const noexcept
+{
+	return _type;
+}
+
+void
+NullGraphicsUniform::setOffset(std::uint32_t offset) noexcept
+{
+	_offset = offset;
+}
+
+std::uint32_t
+NullGraphicsUniform::getOffset() const noexcept
+{
+	return _offset;
+}
+
+void
+NullGraphicsUniform::setBindingPoint(std::uint32_t bindingPoint) noexcept
+{
+	_bindingPoint = bindingPoint;
+}
+
+std::uint32_t
+NullGraphicsUniform::getBindingPoint() const noexcept
+{
+	return _bindingPoint;
+}
+
+void
+NullGraphicsUniform::setShaderStageFlags(GraphicsShaderStageFlags flags) noexcept
+{
+	_stageFlags = flags;
+}
+
+GraphicsShaderStageFlags
+NullGraphicsUniform::getShaderStageFlags() const noexcept
+{
+	return _stageFlags;
+}
+
+NullGraphicsUniformBlock::NullGraphicsUniformBlock() noexcept
+	: _size(0)
+	, _bindingPoint(std::numeric_limits<std::uint32_t>::max())
+	, _type(GraphicsUniformType::GraphicsUniformTypeUniformBuffer)
+	, _stageFlags(0)
+{
+}
+
+NullGraphicsUniformBlock::~NullGraphicsUniformBlock() noexcept
+{
+}
+
+void
+NullGraphicsUniformBlock::setName(const std::string& name) noexcept
+{
+	_name = name;
+}
+
+const std::string&
+NullGraphicsUniformBlock::getName() const noexcept
+{
+	return _name;
+}
+
+void
+NullGraphicsUniformBlock::setType(GraphicsUniformType type) noexcept
+{
+	_type = type;
+}
+
+GraphicsUniformType
+NullGraphicsUniformBlock::getType() const noexcept
+{
+	return _type;
+}
+
+void
+NullGraphicsUniformBlock::setBlockSize(std::uint32_t size) noexcept
+{
+	_size = size;
+}
+
+std::uint32_t
+NullGraphicsUniformBlock::getBlockSize() const noexcept
+{
+	return _size;
+}
+
+void
+NullGraphicsUniformBlock::setShaderStageFlags(GraphicsShaderStageFlags flags) noexcept
+{
+	_stageFlags = flags;
+}
+
+GraphicsShaderStageFlags
+NullGraphicsUniformBlock::getShaderStageFlags() const noexcept
+{
+	return _stageFlags;
+}
+
+void
+NullGraphicsUniformBlock::addGraphicsUniform(GraphicsUniformPtr uniform) noexcept
+{
+	_uniforms.push_back(uniform);
+}
+
+void
+NullGraphicsUniformBlock::removeGraphicsUniform(GraphicsUniformPtr uniform) noexcept
+{
+	auto it = std::find(_uniforms.begin(), _uniforms.end(), uniform);
+	if (it != _uniforms.end())
+		_uniforms.erase(it);
+}
+
+const GraphicsUniforms&
+NullGraphicsUniformBlock::getGraphicsUniforms() const noexcept
+{
+	return _uniforms;
+}
+
+void
+NullGraphicsUniformBlock::setBindingPoint(std::uint32_t bindingPoint) noexcept
+{
+	_bindingPoint = bindingPoint;
+}
+
+std::uint32_t
+NullGraphicsUniformBlock::getBindingPoint() const noexcept
+{
+	return _bindingPoint;
+}
+
+static GraphicsUniformType
+toGraphicsUniformType(const ShaderVarType& type) noexcept
+{
+	static const GraphicsUniformType intTypes[] = {
+		GraphicsUniformType::GraphicsUniformTypeInt, GraphicsUniformType::GraphicsUniformTypeInt2, GraphicsUniformType::GraphicsUniformTypeInt3, GraphicsUniformType::GraphicsUniformTypeInt4,
+		GraphicsUniformType::GraphicsUniformTypeIntArray, GraphicsUniformType::GraphicsUniformTypeInt2Array, GraphicsUniformType::GraphicsUniformTypeInt3Array, GraphicsUniformType::GraphicsUniformTypeInt4Array
+	};
+
+	static const GraphicsUniformType uintTypes[] = {
+		GraphicsUniformType::GraphicsUniformTypeUInt, GraphicsUniformType::GraphicsUniformTypeUInt2, GraphicsUniformType::GraphicsUniformTypeUInt3, GraphicsUniformType::GraphicsUniformTypeUInt4,
+		GraphicsUniformType::GraphicsUniformTypeUIntArray, GraphicsUniformType::GraphicsUniformTypeUInt2Array, GraphicsUniformType::GraphicsUniformTypeUInt3Array, GraphicsUniformType::GraphicsUniformTypeUInt4Array
+	};
+
+	static const GraphicsUniformType floatTypes[] = {
+		GraphicsUniformType::GraphicsUniformTypeFloat, GraphicsUniformType::GraphicsUniformTypeFloat2, GraphicsUniformType::GraphicsUniformTypeFloat3, GraphicsUniformType::GraphicsUniformTypeFloat4,
+		GraphicsUniformType::GraphicsUniformTypeFloatArray, GraphicsUniformType::GraphicsUniformTypeFloat2Array, GraphicsUniformType::GraphicsUniformTypeFloat3Array, GraphicsUniformType::GraphicsUniformTypeFloat4Array
+	};
+
+	static const GraphicsUniformType matrixTypes[] = {
+		GraphicsUniformType::GraphicsUniformTypeFloat2x2, GraphicsUniformType::GraphicsUniformTypeFloat3x3, GraphicsUniformType::GraphicsUniformTypeFloat4x4,
+		GraphicsUniformType::GraphicsUniformTypeFloat2x2Array, GraphicsUniformType::GraphicsUniformTypeFloat3x3Array, GraphicsUniformType::GraphicsUniformTypeFloat4x4Array
+	};
+
+	bool isArray = type.Elements > 0;
+
+	if (type.Class == SVC_MATRIX_ROWS || type.Class == SVC_MATRIX_COLUMNS)
+	{
+		if (type.Type != SVT_FLOAT || type.Rows != type.Columns || type.Rows < 2 || type.Rows > 4)
+			return GraphicsUniformType::GraphicsUniformTypeNone;
+		return matrixTypes[(type.Rows - 2) + (isArray ? 3 : 0)];
+	}
+
+	if (type.Class != SVC_SCALAR && type.Class != SVC_VECTOR)
+		return GraphicsUniformType::GraphicsUniformTypeNone;
+
+	if (type.Columns < 1 || type.Columns > 4)
+		return GraphicsUniformType::GraphicsUniformTypeNone;
+
+	std::size_t index = (type.Columns - 1) + (isArray ? 4 : 0);
+
+	switch (type.Type)
+	{
+	case SVT_BOOL:
+		return isArray ? GraphicsUniformType::GraphicsUniformTypeIntArray : GraphicsUniformType::GraphicsUniformTypeBool;
+	case SVT_INT:
+		return intTypes[index];
+	case SVT_UINT:
+		return uintTypes[index];
+	case SVT_FLOAT:
+		return floatTypes[index];
+	default:
+		return GraphicsUniformType::GraphicsUniformTypeNone;
+	}
+}
+
+static GraphicsFormat
+toGraphicsFormat(const InOutSignature& signature) noexcept
+{
+	std::uint32_t count = 0;
+	for (std::uint32_t mask = signature.ui32Mask; mask; mask >>= 1)
+		count += mask & 1;
+
+	switch (signature.eComponentType)
+	{
+	case INOUT_COMPONENT_UINT32:
+	{
+		static const GraphicsFormat formats[] = { GraphicsFormat::GraphicsFormatR32UInt, GraphicsFormat::GraphicsFormatR32G32UInt, GraphicsFormat::GraphicsFormatR32G32B32UInt, GraphicsFormat::GraphicsFormatR32G32B32A32UInt };
+		return count > 0 && count <= 4 ? formats[count - 1] : GraphicsFormat::GraphicsFormatUndefined;
+	}
+	case INOUT_COMPONENT_SINT32:
+	{
+		static const GraphicsFormat formats[] = { GraphicsFormat::GraphicsFormatR32SInt, GraphicsFormat::GraphicsFormatR32G32SInt, GraphicsFormat::GraphicsFormatR32G32B32SInt, GraphicsFormat::GraphicsFormatR32G32B32A32SInt };
+		return count > 0 && count <= 4 ? formats[count - 1] : GraphicsFormat::GraphicsFormatUndefined;
+	}
+	case INOUT_COMPONENT_FLOAT32:
+	{
+		static const GraphicsFormat formats[] = { GraphicsFormat::GraphicsFormatR32SFloat, GraphicsFormat::GraphicsFormatR32G32SFloat, GraphicsFormat::GraphicsFormatR32G32B32SFloat, GraphicsFormat::GraphicsFormatR32G32B32A32SFloat };
+		return count > 0 && count <= 4 ? formats[count - 1] : GraphicsFormat::GraphicsFormatUndefined;
+	}
+	default:
+		return GraphicsFormat::GraphicsFormatUndefined;
+	}
+}
+
+NullShader::NullShader() noexcept
+	: _instance(0)
+{
+}
+
+NullShader::~NullShader() noexcept
+{
+	this->close();
+}
+
+bool
+NullShader::setup(const GraphicsShaderDesc& shaderDesc) noexcept
+{
+	assert(_instance == 0);
+	assert(!shaderDesc.getByteCodes().empty());
+
+	_instance = this->getDevice()->downcast<NullDevice>()->allocInstanceID();
+
+	if (shaderDesc.getLanguage() == GraphicsShaderLang::GraphicsShaderLangHLSL)
+	{
+		if (!HlslCodesReflect(shaderDesc.getStage(), shaderDesc.getByteCodes(), shaderDesc.getEntryPoint()))
+		{
+			this->getDevice()->downcast<NullDevice>()->message("Can't reflect hlsl.");
+			return false;
+		}
+	}
+	else if (shaderDesc.getLanguage() == GraphicsShaderLang::GraphicsShaderLangHLSLbytecodes)
+	{
+		if (!HlslByteCodesReflect(shaderDesc.getStage(), shaderDesc.getByteCodes().data()))
+		{
+			this->getDevice()->downcast<NullDevice>()->message("Can't reflect hlslbytecodes.");
+			return false;
+		}
+	}
+
+	_shaderDesc = shaderDesc;
+	return true;
+}
+
+void
+NullShader::close() noexcept
+{
+	_params.clear();
+	_attributes.clear();
+}
+
+std::uint32_t
+NullShader::getInstanceID() const noexcept
+{
+	return _instance;
+}
+
+const GraphicsParams&
+NullShader::getReflectParams() const noexcept
+{
+	return _params;
+}
+
+const GraphicsAttributes&
+NullShader::getReflectAttributes() const noexcept
+{
+	return _attributes;
+}
+
+#if defined(_BUILD_PLATFORM_WINDOWS)
+bool
+NullShader::HlslCodesReflect(GraphicsShaderStageFlags stage, const std::string& codes, const std::string& main) noexcept
+{
+	const char* profile = nullptr;
+	if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageVertexBit)
+		profile = "vs_4_0";
+	else if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageFragmentBit)
+		profile = "ps_4_0";
+	else if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageGeometryBit)
+		profile = "gs_4_0";
+	else if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageComputeBit)
+		profile = "cs_4_0";
+
+	if (!profile)
+		return false;
+
+	ID3DBlob* binary = nullptr;
+	ID3DBlob* error = nullptr;
+
+	HRESULT hr = D3DCompile(codes.data(), codes.size(), 0, 0, 0, main.c_str(), profile, D3DCOMPILE_SKIP_VALIDATION | D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &binary, &error);
+	if (hr != S_OK)
+	{
+		if (error)
+			this->getDevice()->downcast<NullDevice>()->message((const char*)error->GetBufferPointer());
+	}
+	else
+	{
+		if (!HlslByteCodesReflect(stage, (const char*)binary->GetBufferPointer()))
+			hr = S_FALSE;
+	}
+
+	if (binary)
+		binary->Release();
+
+	if (error)
+		error->Release();
+
+	return hr == S_OK ? true : false;
+}
+#else
+bool
+NullShader::HlslCodesReflect(GraphicsShaderStageFlags, const std::string&, const std::string&) noexcept
+{
+	// no HLSL compiler here, fail instead of handing out a shader with nothing reflected
+	return false;
+}
+#endif
+
+bool
+NullShader::HlslByteCodesReflect(GraphicsShaderStageFlags stage, const char* codes) noexcept
+{
+	std::uint32_t flags = HLSLCC_FLAG_COMBINE_TEXTURE_SAMPLERS | HLSLCC_FLAG_INOUT_APPEND_SEMANTIC_NAMES | HLSLCC_FLAG_DISABLE_GLOBALS_STRUCT;
+	if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageGeometryBit)
+		flags = HLSLCC_FLAG_GS_ENABLED;
+	else if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageTessControlBit)
+		flags = HLSLCC_FLAG_TESS_ENABLED;
+	else if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageTessEvaluationBit)
+		flags = HLSLCC_FLAG_TESS_ENABLED;
+
+	GLSLShader shader;
+	GLSLCrossDependencyData dependency;
+
+	try
+	{
+		if (!TranslateHLSLFromMem(codes, flags, GLLang::LANG_DEFAULT, 0, nullptr, &dependency, &shader))
+		{
+			FreeGLSLShader(&shader);
+			return false;
+		}
+
+		auto& reflection = shader.reflection;
+
+		for (std::uint32_t i = 0; i < reflection.ui32NumConstantBuffers; i++)
+		{
+			auto& cbuffer = reflection.psConstantBuffers[i];
+			bool isGlobals = std::strcmp(cbuffer.Name, "$Globals") == 0;
+
+			NullGraphicsUniformBlockPtr uniformBlock;
+			if (!isGlobals)
+			{
+				uniformBlock = std::make_shared<NullGraphicsUniformBlock>();
+				uniformBlock->setName(cbuffer.Name);
+				uniformBlock->setBindingPoint(i);
+				uniformBlock->setBlockSize(cbuffer.ui32TotalSizeInBytes);
+				uniformBlock->setType(GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
+				uniformBlock->setShaderStageFlags(stage);
+			}
+
+			for (std::uint32_t j = 0; j < cbuffer.ui32NumVars; j++)
+			{
+				auto& var = cbuffer.asVars[j];
+
+				auto uniform = std::make_shared<NullGraphicsUniform>();
+				uniform->setName(var.Name);
+				uniform->setOffset(var.ui32StartOffset);
+				uniform->setBindingPoint(j);
+				uniform->setType(toGraphicsUniformType(var.sType));
+				uniform->setShaderStageFlags(stage);
+
+				if (uniformBlock)
+					uniformBlock->addGraphicsUniform(uniform);
+				else
+					_params.push_back(uniform);
+			}
+
+			if (uniformBlock)
+				_params.push_back(uniformBlock);
+		}
+
+		for (std::uint32_t i = 0; i < reflection.ui32NumResourceBindings; i++)
+		{
+			auto& binding = reflection.psResourceBindings[i];
+			if (binding.eType != RTYPE_TEXTURE)
+				continue;
+
+			auto uniform = std::make_shared<NullGraphicsUniform>();
+			uniform->setName(binding.Name);
+			uniform->setBindingPoint(binding.ui32BindPoint);
+			uniform->setType(GraphicsUniformType::GraphicsUniformTypeSamplerImage);
+			uniform->setShaderStageFlags(stage);
+
+			_params.push_back(uniform);
+		}
+
+		if (stage == GraphicsShaderStageFlagBits::GraphicsShaderStageVertexBit)
+		{
+			for (std::uint32_t i = 0; i < reflection.ui32NumInputSignatures; i++)
+			{
+				auto& signature = reflection.psInputSignatures[i];
+
+				auto attrib = std::make_shared<NullGraphicsAttribute>();
+				attrib->setSemantic(signature.SemanticName);
+				attrib->setSemanticIndex(signature.ui32SemanticIndex);
+				attrib->setBindingPoint(signature.ui32Register);
+				attrib->setType(toGraphicsFormat(signature));
+
+				_attributes.push_back(attrib);
+			}
+		}
+
+		FreeGLSLShader(&shader);
+		return true;
+	}
+	catch (...)
+	{
+		FreeGLSLShader(&shader);
+		return false;
+	}
+}
+
+const GraphicsShaderDesc&
+NullShader::getGraphicsShaderDesc() const noexcept
+{
+	return _shaderDesc;
+}
+
+void
+NullShader::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullShader::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+NullProgram::NullProgram() noexcept
+	: _instance(0)
+{
+}
+
+NullProgram::~NullProgram() noexcept
+{
+	this->close();
+}
+
+bool
+NullProgram::setup(const GraphicsProgramDesc& programDesc) noexcept
+{
+	assert(_instance == 0);
+
+	_instance = this->getDevice()->downcast<NullDevice>()->allocInstanceID();
+
+	for (auto& shader : programDesc.getShaders())
+	{
+		auto nullShader = shader->downcast<NullShader>();
+
+		for (auto& param : nullShader->getReflectParams())
+		{
+			auto it = std::find_if(_activeParams.begin(), _activeParams.end(), [&](const GraphicsParamPtr& it) { return it->getName() == param->getName(); });
+			if (it == _activeParams.end())
+				_activeParams.push_back(param);
+		}
+
+		for (auto& attrib : nullShader->getReflectAttributes())
+			_activeAttributes.push_back(attrib);
+	}
+
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypeCreateProgram, _instance, (std::uint32_t)programDesc.getShaders().size(), (std::uint32_t)_activeParams.size());
+
+	_programDesc = programDesc;
+	return true;
+}
+
+void
+NullProgram::close() noexcept
+{
+	_activeAttributes.clear();
+	_activeParams.clear();
+}
+
+std::uint32_t
+NullProgram::getInstanceID() const noexcept
+{
+	return _instance;
+}
+
+const GraphicsParams&
+NullProgram::getActiveParams() const noexcept
+{
+	return _activeParams;
+}
+
+const GraphicsAttributes&
+NullProgram::getActiveAttributes() const noexcept
+{
+	return _activeAttributes;
+}
+
+const GraphicsProgramDesc&
+NullProgram::getGraphicsProgramDesc() const noexcept
+{
+	return _programDesc;
+}
+
+void
+NullProgram::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullProgram::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+_NAME_END
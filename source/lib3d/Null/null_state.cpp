@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,20 +34,49 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#ifndef _H_OCCLUSION_QUERY_QUEUE_H_
-#define _H_OCCLUSION_QUERY_QUEUE_H_
-
-#include <ray/occlusion_query.h>
+#include "null_state.h"
 
 _NAME_BEGIN
 
-class OcclusionQueryQueue
+__ImplementSubClass(NullGraphicsState, GraphicsState, "NullGraphicsState")
+
+NullGraphicsState::NullGraphicsState() noexcept
 {
-public:
+}
 
+NullGraphicsState::~NullGraphicsState() noexcept
+{
+	this->close();
+}
 
-};
+bool
+NullGraphicsState::setup(const GraphicsStateDesc& desc) noexcept
+{
+	_desc = desc;
+	return true;
+}
 
-_NAME_END
+void
+NullGraphicsState::close() noexcept
+{
+}
 
-#endif
\ No newline at end of file
+const GraphicsStateDesc&
+NullGraphicsState::getGraphicsStateDesc() const noexcept
+{
+	return _desc;
+}
+
+void
+NullGraphicsState::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
+
+GraphicsDevicePtr
+NullGraphicsState::getDevice() noexcept
+{
+	return _device.lock();
+}
+
+_NAME_END
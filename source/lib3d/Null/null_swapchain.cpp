@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,83 +34,82 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#ifndef _H_OCCLUSION_OBJECT_H_
-#define _H_OCCLUSION_OBJECT_H_
-
-#include <ray/occlusion_types.h>
+#include "null_swapchain.h"
 
 _NAME_BEGIN
 
-class OcclusionTree;
-class OcclusionObject
-{
-public:
-    OcclusionObject() noexcept;
-    virtual ~OcclusionObject() noexcept;
-
-    bool isLeaf() const noexcept;
-    bool isVirtualLeaf() const noexcept;
-
-    const Bound& getBoundingxBox() const noexcept;
-
-private:
-
-    friend OcclusionTree;
-
-    Bound _boundingBox;
+__ImplementSubClass(NullSwapchain, GraphicsSwapchain, "NullSwapchain")
 
-    int _depth;
-    int _leaves;
-
-    bool _isVirtualLeaf;
-
-    OcclusionObjectPtr _parent;
-};
-
-class OcclusionObjectLeaf
+NullSwapchain::NullSwapchain() noexcept
+	: _presentCount(0)
 {
-public:
+}
 
-};
-
-class OcclusionObjectIterator
+NullSwapchain::~NullSwapchain() noexcept
 {
-public:
-
-    OcclusionObjectPtr frist();
-    OcclusionObjectPtr second();
-
-private:
+	this->close();
+}
 
-    OcclusionObjectPtr _frist;
-    OcclusionObjectPtr _second;
-};
-
-class OcclusionTree
+bool
+NullSwapchain::setup(const GraphicsSwapchainDesc& swapchainDesc) noexcept
 {
-public:
-
-    void addOcclusionObject(OcclusionObjectPtr object) noexcept;
+	_swapchainDesc = swapchainDesc;
+	return true;
+}
 
-    bool isVisiable(OcclusionObjectPtr object) noexcept;
+void
+NullSwapchain::close() noexcept
+{
+}
 
-    void collectObjects(OcclusionObjectPtr root, OcclusionObjectContainer& container) noexcept;
+void
+NullSwapchain::setSwapInterval(GraphicsSwapInterval interval) noexcept
+{
+	_swapchainDesc.setSwapInterval(interval);
+}
 
-    void computeBounds(OcclusionObjectPtr root) noexcept;
-    void computeLeaves(OcclusionObjectPtr root) noexcept;
+GraphicsSwapInterval
+NullSwapchain::getSwapInterval() const noexcept
+{
+	return _swapchainDesc.getSwapInterval();
+}
 
+void
+NullSwapchain::setWindowResolution(std::uint32_t w, std::uint32_t h) noexcept
+{
+	_swapchainDesc.setWidth(w);
+	_swapchainDesc.setHeight(h);
+}
 
-private:
+void
+NullSwapchain::getWindowResolution(std::uint32_t& w, std::uint32_t& h) const noexcept
+{
+	w = _swapchainDesc.getWidth();
+	h = _swapchainDesc.getHeight();
+}
 
-    Bound _boundingBox;
+void
+NullSwapchain::present() noexcept
+{
+	GraphicsCommandLog::instance()->record(GraphicsCommandLogType::GraphicsCommandLogTypePresent, _presentCount++);
+}
 
-    Frustum _frustum;
+const GraphicsSwapchainDesc&
+NullSwapchain::getGraphicsSwapchainDesc() const noexcept
+{
+	return _swapchainDesc;
+}
 
-    OcclusionObjectPtr _root;
+void
+NullSwapchain::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
+}
 
-    std::vector<OcclusionObjectPtr> _occlusionObjects;
-};
+GraphicsDevicePtr
+NullSwapchain::getDevice() noexcept
+{
+	return _device.lock();
+}
 
 _NAME_END
-
-#endif
\ No newline at end of file
@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,63 +34,48 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#ifndef _H_OCCLUSION_QUERY_H_
-#define _H_OCCLUSION_QUERY_H_
+#ifndef _H_NULL_SWAPCHAIN_H_
+#define _H_NULL_SWAPCHAIN_H_
 
-#include <ray/occlusion_tree.h>
+#include "null_types.h"
 
 _NAME_BEGIN
 
-class OcclusionQuery
+class NullSwapchain final : public GraphicsSwapchain
 {
+	__DeclareSubClass(NullSwapchain, GraphicsSwapchain)
 public:
-    OcclusionQuery() noexcept;
-    virtual ~OcclusionQuery() noexcept;
+	NullSwapchain() noexcept;
+	~NullSwapchain() noexcept;
 
-    bool isAvailable() const noexcept;
+	bool setup(const GraphicsSwapchainDesc& swapchainDesc) noexcept;
+	void close() noexcept;
 
-    int getQueryResult() const noexcept;
-    int getQueryInstnace() const noexcept;
+	void setSwapInterval(GraphicsSwapInterval interval) noexcept;
+	GraphicsSwapInterval getSwapInterval() const noexcept;
 
-    void queryBegin() const noexcept;
-    void queryEnd() const noexcept;
+	void setWindowResolution(std::uint32_t w, std::uint32_t h) noexcept;
+	void getWindowResolution(std::uint32_t& w, std::uint32_t& h) const noexcept;
 
-    void addObject(OcclusionObjectPtr object) noexcept;
+	void present() noexcept;
 
-    OcclusionObjectPtr getObject(std::size_t i = 0) const noexcept;
-    
-    OcclusionObjectContainer& getObjects() noexcept;
-    const OcclusionObjectContainer& getObjects() const noexcept;
-
-    std::size_t getObjectCount() const noexcept;
-
-    void reset() noexcept;
+	const GraphicsSwapchainDesc& getGraphicsSwapchainDesc() const noexcept;
 
 private:
-
-    int _queryID;
-
-    OcclusionObjectContainer _objects;
-};
-
-class OcclusionQueryPool
-{
-public:
-    OcclusionQueryPool() noexcept;
-    virtual ~OcclusionQueryPool() noexcept;
-
-    OcclusionQuery* requestQuery() noexcept;
-
-    void resetQueries() noexcept;
-    void destroyQueries() noexcept;
+	friend class NullDevice;
+	void setDevice(const GraphicsDevicePtr& device) noexcept;
+	GraphicsDevicePtr getDevice() noexcept;
 
 private:
+	NullSwapchain(const NullSwapchain&) noexcept = delete;
+	NullSwapchain& operator=(const NullSwapchain&) noexcept = delete;
 
-    std::size_t _current;
-
-    OcclusionQueryContainer _occlusionQueries;
+private:
+	std::uint32_t _presentCount;
+	GraphicsSwapchainDesc _swapchainDesc;
+	GraphicsDeviceWeakPtr _device;
 };
 
 _NAME_END
 
-#endif
\ No newline at end of file
+#endif
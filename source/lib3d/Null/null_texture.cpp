@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,94 +34,91 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#include <ray/occlusion_tree.h>
-#include <stack>
+#include "null_texture.h"
+#include "null_device.h"
 
 _NAME_BEGIN
 
-OcclusionObject::OcclusionObject() noexcept
-    : _isVirtualLeaf(false)
-{
-}
+__ImplementSubClass(NullTexture, GraphicsTexture, "NullTexture")
 
-bool
-OcclusionObject::isVirtualLeaf() const noexcept
+NullTexture::NullTexture() noexcept
+	: _instance(0)
 {
-    return _isVirtualLeaf;
 }
 
-const Bound&
-OcclusionObject::getBoundingxBox() const noexcept
+NullTexture::~NullTexture() noexcept
 {
-    return _boundingBox;
+	this->close();
 }
 
-void 
-OcclusionTree::addOcclusionObject(OcclusionObjectPtr object) noexcept
+bool
+NullTexture::setup(const GraphicsTextureDesc& desc) noexcept
 {
-    _occlusionObjects.push_back(object);
-    _boundingBox.encapsulate(object->getBoundingxBox());
+	assert(_instance == 0);
+
+	_instance = this->getDevice()->downcast<NullDevice>()->allocInstanceID();
+
+	auto log = GraphicsCommandLog::instance();
+	log->record(GraphicsCommandLogType::GraphicsCommandLogTypeCreateTexture, _instance, desc.getWidth(), desc.getHeight(), (std::uint32_t)desc.getTexFormat());
+
+	if (desc.getStream() && desc.getStreamSize() > 0)
+		log->record(GraphicsCommandLogType::GraphicsCommandLogTypeUploadTexture, _instance, 0, (std::uint32_t)desc.getStreamSize());
+
+	_desc = desc;
+	return true;
 }
 
-bool
-OcclusionTree::isVisiable(OcclusionObjectPtr object) noexcept
+void
+NullTexture::close() noexcept
 {
-    return _frustum.contains(object->getBoundingxBox().sphere());
+	_readback.clear();
+	_readback.shrink_to_fit();
 }
 
-void 
-OcclusionTree::collectObjects(OcclusionObjectPtr root, OcclusionObjectContainer& container) noexcept
+bool
+NullTexture::map(std::uint32_t x, std::uint32_t y, std::uint32_t w, std::uint32_t h, std::uint32_t, void** data) noexcept
 {
-    std::stack<OcclusionObject*> stack;
-
-    stack.push(root);
+	assert(data);
 
-    while (!stack.empty())
-    {
-        auto object = stack.top();
-        stack.pop();
+	if (x + w > _desc.getWidth() || y + h > _desc.getHeight())
+		return false;
 
-        container.push_back(object);
+	// Enough room for the widest format (four 32-bit channels) so callers can read back any layout.
+	std::size_t mapSize = (std::size_t)w * h * 16;
+	if (_readback.size() < mapSize)
+		_readback.resize(mapSize);
 
-        if (!object->isVirtualLeaf())
-        {
-            OcclusionObjectIterator* iterator = dynamic_cast<OcclusionObjectIterator*>(object);
+	*data = _readback.data();
+	return true;
+}
 
-            stack.push(iterator->frist());
-            stack.push(iterator->second());
-        }
-    }
+void
+NullTexture::unmap() noexcept
+{
 }
 
-void 
-OcclusionTree::computeBounds(OcclusionObjectPtr root) noexcept
+std::uint32_t
+NullTexture::getInstanceID() const noexcept
 {
-    OcclusionObjectContainer container;
-    this->collectObjects(_root, container);
+	return _instance;
+}
 
-    for (auto& it : container)
-    {
+const GraphicsTextureDesc&
+NullTexture::getGraphicsTextureDesc() const noexcept
+{
+	return _desc;
+}
 
-    }
+void
+NullTexture::setDevice(const GraphicsDevicePtr& device) noexcept
+{
+	_device = device;
 }
 
-void 
-OcclusionTree::computeLeaves(OcclusionObjectPtr node) noexcept
+GraphicsDevicePtr
+NullTexture::getDevice() noexcept
 {
-    if (node->isLeaf())
-    {
-        node->_leaves = 1;
-    }
-    else
-    {
-        OcclusionObjectPtr f = dynamic_cast<OcclusionObjectIterator*>(node)->frist();
-        OcclusionObjectPtr s = dynamic_cast<OcclusionObjectIterator*>(node)->second();
-
-        computeLeaves(f);
-        computeLeaves(s);
-
-        node->_leaves = f->_leaves + s->_leaves;
-    }
+	return _device.lock();
 }
 
-_NAME_END
\ No newline at end of file
+_NAME_END
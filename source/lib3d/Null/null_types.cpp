@@ -0,0 +1,102 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "null_types.h"
+
+_NAME_BEGIN
+
+std::uint32_t
+NullTypes::getUniformSize(const GraphicsUniformSet& uniformSet) noexcept
+{
+	switch (uniformSet.getGraphicsParam()->getType())
+	{
+	case GraphicsUniformType::GraphicsUniformTypeBool:              return sizeof(std::int32_t);
+	case GraphicsUniformType::GraphicsUniformTypeInt:               return sizeof(int1);
+	case GraphicsUniformType::GraphicsUniformTypeInt2:              return sizeof(int2);
+	case GraphicsUniformType::GraphicsUniformTypeInt3:              return sizeof(int3);
+	case GraphicsUniformType::GraphicsUniformTypeInt4:              return sizeof(int4);
+	case GraphicsUniformType::GraphicsUniformTypeUInt:              return sizeof(uint1);
+	case GraphicsUniformType::GraphicsUniformTypeUInt2:             return sizeof(uint2);
+	case GraphicsUniformType::GraphicsUniformTypeUInt3:             return sizeof(uint3);
+	case GraphicsUniformType::GraphicsUniformTypeUInt4:             return sizeof(uint4);
+	case GraphicsUniformType::GraphicsUniformTypeFloat:             return sizeof(float1);
+	case GraphicsUniformType::GraphicsUniformTypeFloat2:            return sizeof(float2);
+	case GraphicsUniformType::GraphicsUniformTypeFloat3:            return sizeof(float3);
+	case GraphicsUniformType::GraphicsUniformTypeFloat4:            return sizeof(float4);
+	case GraphicsUniformType::GraphicsUniformTypeFloat2x2:          return sizeof(float2x2);
+	case GraphicsUniformType::GraphicsUniformTypeFloat3x3:          return sizeof(float3x3);
+	case GraphicsUniformType::GraphicsUniformTypeFloat4x4:          return sizeof(float4x4);
+	case GraphicsUniformType::GraphicsUniformTypeIntArray:          return static_cast<std::uint32_t>(uniformSet.getIntArray().size() * sizeof(int1));
+	case GraphicsUniformType::GraphicsUniformTypeInt2Array:         return static_cast<std::uint32_t>(uniformSet.getInt2Array().size() * sizeof(int2));
+	case GraphicsUniformType::GraphicsUniformTypeInt3Array:         return static_cast<std::uint32_t>(uniformSet.getInt3Array().size() * sizeof(int3));
+	case GraphicsUniformType::GraphicsUniformTypeInt4Array:         return static_cast<std::uint32_t>(uniformSet.getInt4Array().size() * sizeof(int4));
+	case GraphicsUniformType::GraphicsUniformTypeUIntArray:         return static_cast<std::uint32_t>(uniformSet.getUIntArray().size() * sizeof(uint1));
+	case GraphicsUniformType::GraphicsUniformTypeUInt2Array:        return static_cast<std::uint32_t>(uniformSet.getUInt2Array().size() * sizeof(uint2));
+	case GraphicsUniformType::GraphicsUniformTypeUInt3Array:        return static_cast<std::uint32_t>(uniformSet.getUInt3Array().size() * sizeof(uint3));
+	case GraphicsUniformType::GraphicsUniformTypeUInt4Array:        return static_cast<std::uint32_t>(uniformSet.getUInt4Array().size() * sizeof(uint4));
+	case GraphicsUniformType::GraphicsUniformTypeFloatArray:        return static_cast<std::uint32_t>(uniformSet.getFloatArray().size() * sizeof(float1));
+	case GraphicsUniformType::GraphicsUniformTypeFloat2Array:       return static_cast<std::uint32_t>(uniformSet.getFloat2Array().size() * sizeof(float2));
+	case GraphicsUniformType::GraphicsUniformTypeFloat3Array:       return static_cast<std::uint32_t>(uniformSet.getFloat3Array().size() * sizeof(float3));
+	case GraphicsUniformType::GraphicsUniformTypeFloat4Array:       return static_cast<std::uint32_t>(uniformSet.getFloat4Array().size() * sizeof(float4));
+	case GraphicsUniformType::GraphicsUniformTypeFloat2x2Array:     return static_cast<std::uint32_t>(uniformSet.getFloat2x2Array().size() * sizeof(float2x2));
+	case GraphicsUniformType::GraphicsUniformTypeFloat3x3Array:     return static_cast<std::uint32_t>(uniformSet.getFloat3x3Array().size() * sizeof(float3x3));
+	case GraphicsUniformType::GraphicsUniformTypeFloat4x4Array:     return static_cast<std::uint32_t>(uniformSet.getFloat4x4Array().size() * sizeof(float4x4));
+	default:
+		return 0;
+	}
+}
+
+std::uint32_t
+NullTypes::getPrimitiveCount(GraphicsVertexType type, std::uint32_t count) noexcept
+{
+	switch (type)
+	{
+	case GraphicsVertexType::GraphicsVertexTypePointList:                  return count;
+	case GraphicsVertexType::GraphicsVertexTypeLineList:                   return count / 2;
+	case GraphicsVertexType::GraphicsVertexTypeLineStrip:                  return count > 1 ? count - 1 : 0;
+	case GraphicsVertexType::GraphicsVertexTypeTriangleList:               return count / 3;
+	case GraphicsVertexType::GraphicsVertexTypeTriangleStrip:              return count > 2 ? count - 2 : 0;
+	case GraphicsVertexType::GraphicsVertexTypeTriangleFan:                return count > 2 ? count - 2 : 0;
+	case GraphicsVertexType::GraphicsVertexTypeLineListWithAdjacency:      return count / 4;
+	case GraphicsVertexType::GraphicsVertexTypeLineStripWithAdjacency:     return count > 3 ? count - 3 : 0;
+	case GraphicsVertexType::GraphicsVertexTypeTriangleListWithAdjacency:  return count / 6;
+	case GraphicsVertexType::GraphicsVertexTypeTriangleStripWithAdjacency: return count > 4 ? (count - 4) / 2 : 0;
+	default:
+		return 0;
+	}
+}
+
+_NAME_END
@@ -0,0 +1,101 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#ifndef _H_NULL_TYPES_H_
+#define _H_NULL_TYPES_H_
+
+#include <ray/graphics_system.h>
+#include <ray/graphics_device.h>
+#include <ray/graphics_device_property.h>
+#include <ray/graphics_swapchain.h>
+#include <ray/graphics_context.h>
+#include <ray/graphics_data.h>
+#include <ray/graphics_state.h>
+#include <ray/graphics_sampler.h>
+#include <ray/graphics_texture.h>
+#include <ray/graphics_framebuffer.h>
+#include <ray/graphics_shader.h>
+#include <ray/graphics_pipeline.h>
+#include <ray/graphics_descriptor.h>
+#include <ray/graphics_input_layout.h>
+#include <ray/graphics_variant.h>
+#include <ray/graphics_command_log.h>
+
+_NAME_BEGIN
+
+typedef std::shared_ptr<class NullDevice> NullDevicePtr;
+typedef std::shared_ptr<class NullDeviceProperty> NullDevicePropertyPtr;
+typedef std::shared_ptr<class NullSwapchain> NullSwapchainPtr;
+typedef std::shared_ptr<class NullDeviceContext> NullDeviceContextPtr;
+typedef std::shared_ptr<class NullFramebufferLayout> NullFramebufferLayoutPtr;
+typedef std::shared_ptr<class NullFramebuffer> NullFramebufferPtr;
+typedef std::shared_ptr<class NullShader> NullShaderPtr;
+typedef std::shared_ptr<class NullProgram> NullProgramPtr;
+typedef std::shared_ptr<class NullGraphicsData> NullGraphicsDataPtr;
+typedef std::shared_ptr<class NullInputLayout> NullInputLayoutPtr;
+typedef std::shared_ptr<class NullGraphicsState> NullGraphicsStatePtr;
+typedef std::shared_ptr<class NullTexture> NullTexturePtr;
+typedef std::shared_ptr<class NullSampler> NullSamplerPtr;
+typedef std::shared_ptr<class NullPipeline> NullPipelinePtr;
+typedef std::shared_ptr<class NullDescriptorPool> NullDescriptorPoolPtr;
+typedef std::shared_ptr<class NullDescriptorSet> NullDescriptorSetPtr;
+typedef std::shared_ptr<class NullDescriptorSetLayout> NullDescriptorSetLayoutPtr;
+typedef std::shared_ptr<class NullGraphicsAttribute> NullGraphicsAttributePtr;
+typedef std::shared_ptr<class NullGraphicsUniform> NullGraphicsUniformPtr;
+typedef std::shared_ptr<class NullGraphicsUniformBlock> NullGraphicsUniformBlockPtr;
+
+typedef std::weak_ptr<class NullDevice> NullDeviceWeakPtr;
+
+typedef std::vector<NullShaderPtr> NullShaders;
+
+struct NullVertexBuffer
+{
+	std::intptr_t offset;
+	NullGraphicsDataPtr vbo;
+};
+
+typedef std::vector<NullVertexBuffer> NullVertexBuffers;
+
+class NullTypes
+{
+public:
+	static std::uint32_t getUniformSize(const GraphicsUniformSet& uniformSet) noexcept;
+	static std::uint32_t getPrimitiveCount(GraphicsVertexType type, std::uint32_t count) noexcept;
+};
+
+_NAME_END
+
+#endif
@@ -46,6 +46,7 @@ _NAME_BEGIN
 __ImplementSubClass(OGLCoreDescriptorSet, GraphicsDescriptorSet, "OGLCoreDescriptorSet")
 
 OGLCoreDescriptorSet::OGLCoreDescriptorSet() noexcept
+	: _uniformProgram(GL_NONE)
 {
 }
 
@@ -69,6 +70,8 @@ OGLCoreDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc)
 		_activeUniformSets.push_back(uniformSet);
 	}
 
+	_uniformVersions.resize(_activeUniformSets.size(), std::numeric_limits<std::uint32_t>::max());
+
 	_descriptorSetDesc = descriptorSetDesc;
 	return true;
 }
@@ -76,17 +79,40 @@ OGLCoreDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc)
 void
 OGLCoreDescriptorSet::close() noexcept
 {
+	_uniformVersions.clear();
 	_activeUniformSets.clear();
 }
 
 void
-OGLCoreDescriptorSet::apply(const OGLProgram& shaderObject) noexcept
+OGLCoreDescriptorSet::apply(OGLProgram& shaderObject, std::uint32_t& uploadBytes, std::uint32_t& uploadSkips) noexcept
 {
 	auto program = shaderObject.getInstanceID();
-	for (auto& it : _activeUniformSets)
+	if (shaderObject.getActiveDescriptorSet() != this || _uniformProgram != program)
+	{
+		std::fill(_uniformVersions.begin(), _uniformVersions.end(), std::numeric_limits<std::uint32_t>::max());
+		shaderObject.setActiveDescriptorSet(this);
+		_uniformProgram = program;
+	}
+
+	for (std::size_t i = 0; i < _activeUniformSets.size(); i++)
 	{
+		auto& it = _activeUniformSets[i];
 		auto type = it->getGraphicsParam()->getType();
 		auto location = it->getGraphicsParam()->getBindingPoint();
+
+		if (type < GraphicsUniformType::GraphicsUniformTypeSampler)
+		{
+			auto version = it->getVersion();
+			if (_uniformVersions[i] == version)
+			{
+				uploadSkips++;
+				continue;
+			}
+
+			_uniformVersions[i] = version;
+			uploadBytes += OGLTypes::getUniformSize(*it);
+		}
+
 		switch (type)
 		{
 		case GraphicsUniformType::GraphicsUniformTypeBool:
@@ -204,7 +230,10 @@ OGLCoreDescriptorSet::apply(const OGLProgram& shaderObject) noexcept
 			if (buffer)
 			{
 				auto ubo = buffer->downcast<OGLCoreGraphicsData>();
-				glBindBufferBase(GL_UNIFORM_BUFFER, location, ubo->getInstanceID());
+				if (it->getBufferSize() > 0)
+					glBindBufferRange(GL_UNIFORM_BUFFER, location, ubo->getInstanceID(), it->getBufferOffset(), it->getBufferSize());
+				else
+					glBindBufferBase(GL_UNIFORM_BUFFER, location, ubo->getInstanceID());
 			}
 		}
 		break;
@@ -350,7 +379,7 @@ OGLCoreDescriptorSet::copy(std::uint32_t descriptorCopyCount, const GraphicsDesc
 			case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-				(*it)->uniformBuffer(activeUniformSet->getBuffer());
+				(*it)->uniformBuffer(activeUniformSet->getBuffer(), activeUniformSet->getBufferOffset(), activeUniformSet->getBufferSize());
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 				break;
@@ -51,7 +51,7 @@ public:
 	bool setup(const GraphicsDescriptorSetDesc& desc) noexcept;
 	void close() noexcept;
 
-	void apply(const OGLProgram& shaderObject) noexcept;
+	void apply(OGLProgram& program, std::uint32_t& uploadBytes, std::uint32_t& uploadSkips) noexcept;
 
 	void copy(std::uint32_t descriptorCopyCount, const GraphicsDescriptorSetPtr descriptorCopies[]) noexcept;
 
@@ -68,6 +68,9 @@ private:
 	OGLCoreDescriptorSet& operator=(const OGLCoreDescriptorSet&) noexcept = delete;
 
 private:
+	GLuint _uniformProgram;
+	std::vector<std::uint32_t> _uniformVersions;
+
 	GraphicsUniformSets _activeUniformSets;
 	GraphicsDeviceWeakPtr _device;
 	GraphicsDescriptorSetDesc _descriptorSetDesc;
@@ -62,6 +62,14 @@ OGLCoreDeviceContext::OGLCoreDeviceContext() noexcept
 	, _needUpdateVertexBuffers(false)
 	, _needEnableDebugControl(false)
 	, _needDisableDebugControl(false)
+	, _uniformStreamData(nullptr)
+	, _uniformStreamSize(0)
+	, _uniformStreamIndex(0)
+	, _uniformStreamOffset(0)
+	, _uniformStreamAlignment(1)
+	, _uniformStreamFences(3, nullptr)
+	, _uniformUploadBytes(0)
+	, _uniformUploadSkips(0)
 {
 }
 
@@ -91,12 +99,30 @@ OGLCoreDeviceContext::setup(const GraphicsContextDesc& desc) noexcept
 	if (!this->initStateSystem())
 		return false;
 
+	if (desc.getUniformStreamSize() > 0)
+	{
+		if (!this->initUniformStream(desc.getUniformStreamSize()))
+			return false;
+	}
+
 	return true;
 }
 
 void
 OGLCoreDeviceContext::close() noexcept
 {
+	for (auto& fence : _uniformStreamFences)
+	{
+		if (fence)
+		{
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	_uniformStream.reset();
+	_uniformStreamData = nullptr;
+
 	_framebuffer.reset();
 	_program.reset();
 	_pipeline.reset();
@@ -130,11 +156,35 @@ OGLCoreDeviceContext::renderBegin() noexcept
 		this->stopDebugControl();
 		_needDisableDebugControl = false;
 	}
+
+	_uniformUploadBytes = 0;
+	_uniformUploadSkips = 0;
+
+	if (_uniformStream)
+	{
+		auto& fence = _uniformStreamFences[_uniformStreamIndex];
+		if (fence)
+		{
+			GLenum result = glClientWaitSync(fence, 0, 0);
+			while (result == GL_TIMEOUT_EXPIRED)
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		_uniformStreamOffset = _uniformStreamIndex * _uniformStreamSize;
+	}
 }
 
 void
 OGLCoreDeviceContext::renderEnd() noexcept
 {
+	if (_uniformStream)
+	{
+		_uniformStreamFences[_uniformStreamIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		_uniformStreamIndex = (_uniformStreamIndex + 1) % _uniformStreamFences.size();
+	}
 }
 
 void
@@ -415,6 +465,43 @@ OGLCoreDeviceContext::getIndexBufferData() const noexcept
 	return _indexBuffer;
 }
 
+bool
+OGLCoreDeviceContext::uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept
+{
+	assert(data && size > 0);
+
+	if (!_uniformStream)
+		return false;
+
+	std::uint32_t first = (_uniformStreamOffset + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+	if (first + size > (_uniformStreamIndex + 1) * _uniformStreamSize)
+		return false;
+
+	std::memcpy(_uniformStreamData + first, data, size);
+
+	offset = first;
+	_uniformStreamOffset = first + size;
+	return true;
+}
+
+GraphicsDataPtr
+OGLCoreDeviceContext::getUniformStreamData() const noexcept
+{
+	return _uniformStream;
+}
+
+std::uint32_t
+OGLCoreDeviceContext::getUniformUploadBytes() const noexcept
+{
+	return _uniformUploadBytes;
+}
+
+std::uint32_t
+OGLCoreDeviceContext::getUniformUploadSkips() const noexcept
+{
+	return _uniformUploadSkips;
+}
+
 void
 OGLCoreDeviceContext::generateMipmap(const GraphicsTexturePtr& texture) noexcept
 {
@@ -686,7 +773,7 @@ OGLCoreDeviceContext::draw(std::uint32_t numVertices, std::uint32_t numInstances
 
 	if (_needUpdateDescriptor)
 	{
-		_descriptorSet->apply(*_program);
+		_descriptorSet->apply(*_program, _uniformUploadBytes, _uniformUploadSkips);
 		_needUpdateDescriptor = false;
 	}
 
@@ -718,7 +805,7 @@ OGLCoreDeviceContext::drawIndexed(std::uint32_t numIndices, std::uint32_t numIns
 
 	if (_needUpdateDescriptor)
 	{
-		_descriptorSet->apply(*_program);
+		_descriptorSet->apply(*_program, _uniformUploadBytes, _uniformUploadSkips);
 		_needUpdateDescriptor = false;
 	}
 
@@ -913,6 +1000,41 @@ OGLCoreDeviceContext::stopDebugControl() noexcept
 	}
 }
 
+bool
+OGLCoreDeviceContext::initUniformStream(std::uint32_t size) noexcept
+{
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+	_uniformStreamAlignment = std::max(alignment, 1);
+	_uniformStreamSize = (size + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+
+	GraphicsDataDesc uniformStreamDesc;
+	uniformStreamDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+	uniformStreamDesc.setStreamSize(_uniformStreamSize * _uniformStreamFences.size());
+	uniformStreamDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit | GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit | GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit);
+
+	auto uniformStream = this->getDevice()->createGraphicsData(uniformStreamDesc);
+	if (!uniformStream)
+	{
+		this->getDevice()->downcast<OGLDevice>()->message("Can't create uniform stream buffer.");
+		return false;
+	}
+
+	void* data = nullptr;
+	if (!uniformStream->map(0, uniformStreamDesc.getStreamSize(), &data))
+	{
+		this->getDevice()->downcast<OGLDevice>()->message("Can't map uniform stream buffer.");
+		return false;
+	}
+
+	_uniformStream = uniformStream->downcast_pointer<OGLCoreGraphicsData>();
+	_uniformStreamData = (std::uint8_t*)data;
+	_uniformStreamIndex = 0;
+	_uniformStreamOffset = 0;
+	return true;
+}
+
 bool
 OGLCoreDeviceContext::initStateSystem() noexcept
 {
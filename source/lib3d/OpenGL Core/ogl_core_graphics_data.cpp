@@ -164,7 +164,7 @@ OGLCoreGraphicsData::map(std::ptrdiff_t offset, std::ptrdiff_t count, void** dat
 		flags |= GL_MAP_FLUSH_EXPLICIT_BIT;
 
 	if (!_data && usage & GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit)
-		_data = glMapNamedBuffer(_buffer, flags);
+		_data = glMapNamedBufferRange(_buffer, 0, _desc.getStreamSize(), flags);
 
 	if (_data && usage & GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit)
 	{
@@ -68,11 +68,13 @@ OGLCorePipeline::setup(const GraphicsPipelineDesc& pipelineDesc) noexcept
 	assert(pipelineDesc.getGraphicsInputLayout()->isInstanceOf<OGLInputLayout>());
 	assert(pipelineDesc.getGraphicsDescriptorSetLayout()->isInstanceOf<OGLDescriptorSetLayout>());
 
-	std::uint16_t offset = 0;
+	std::map<std::uint8_t, std::uint16_t> offsets;
 
 	auto& layouts = pipelineDesc.getGraphicsInputLayout()->getGraphicsInputLayoutDesc().getVertexLayouts();
 	for (auto& it : layouts)
 	{
+		auto& offset = offsets[it.getVertexSlot()];
+
 		GLuint attribIndex = GL_INVALID_INDEX;
 
 		auto& attributes = pipelineDesc.getGraphicsProgram()->getActiveAttributes();
@@ -414,6 +414,12 @@ EGL2GraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo) noexcept
 	_variant.uniformBuffer(ubo);
 }
 
+void
+EGL2GraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept
+{
+	_variant.uniformBuffer(ubo, offset, size);
+}
+
 bool
 EGL2GraphicsUniformSet::getBool() const noexcept
 {
@@ -618,6 +624,24 @@ EGL2GraphicsUniformSet::getBuffer() const noexcept
 	return _variant.getBuffer();
 }
 
+std::uint32_t
+EGL2GraphicsUniformSet::getBufferOffset() const noexcept
+{
+	return _variant.getBufferOffset();
+}
+
+std::uint32_t
+EGL2GraphicsUniformSet::getBufferSize() const noexcept
+{
+	return _variant.getBufferSize();
+}
+
+std::uint32_t
+EGL2GraphicsUniformSet::getVersion() const noexcept
+{
+	return _variant.getVersion();
+}
+
 void
 EGL2GraphicsUniformSet::setGraphicsParam(GraphicsParamPtr param) noexcept
 {
@@ -1010,7 +1034,7 @@ EGL2DescriptorSet::copy(std::uint32_t descriptorCopyCount, const GraphicsDescrip
 			case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-				(*it)->uniformBuffer(activeUniformSet->getBuffer());
+				(*it)->uniformBuffer(activeUniformSet->getBuffer(), activeUniformSet->getBufferOffset(), activeUniformSet->getBufferSize());
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 				break;
@@ -380,6 +380,30 @@ EGL2DeviceContext::getIndexBufferData() const noexcept
 	return _indexBuffer;
 }
 
+bool
+EGL2DeviceContext::uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept
+{
+	return false;
+}
+
+GraphicsDataPtr
+EGL2DeviceContext::getUniformStreamData() const noexcept
+{
+	return nullptr;
+}
+
+std::uint32_t
+EGL2DeviceContext::getUniformUploadBytes() const noexcept
+{
+	return 0;
+}
+
+std::uint32_t
+EGL2DeviceContext::getUniformUploadSkips() const noexcept
+{
+	return 0;
+}
+
 void
 EGL2DeviceContext::generateMipmap(GraphicsTexturePtr texture) noexcept
 {
@@ -66,11 +66,13 @@ EGL2Pipeline::setup(const GraphicsPipelineDesc& pipelineDesc) noexcept
 	assert(pipelineDesc.getGraphicsInputLayout()->isInstanceOf<EGL2InputLayout>());
 	assert(pipelineDesc.getGraphicsDescriptorSetLayout()->isInstanceOf<EGL2DescriptorSetLayout>());
 
-	std::uint16_t offset = 0;
+	std::map<std::uint8_t, std::uint16_t> offsets;
 
 	auto& layouts = pipelineDesc.getGraphicsInputLayout()->getGraphicsInputLayoutDesc().getVertexLayouts();
 	for (auto& it : layouts)
 	{
+		auto& offset = offsets[it.getVertexSlot()];
+
 		GLuint attribIndex = GL_INVALID_INDEX;
 
 		auto& attributes = pipelineDesc.getGraphicsProgram()->getActiveAttributes();
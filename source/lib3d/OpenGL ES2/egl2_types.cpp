@@ -188,19 +188,15 @@ EGL2Types::asVertexFormat(GraphicsFormat format) noexcept
 	case GraphicsFormatR16SNorm:
 	case GraphicsFormatR16SScaled:
 	case GraphicsFormatR16SInt:
-	case GraphicsFormatR16SFloat:
 	case GraphicsFormatR16G16SNorm:
 	case GraphicsFormatR16G16SScaled:
 	case GraphicsFormatR16G16SInt:
-	case GraphicsFormatR16G16SFloat:
 	case GraphicsFormatR16G16B16SNorm:
 	case GraphicsFormatR16G16B16SScaled:
 	case GraphicsFormatR16G16B16SInt:
-	case GraphicsFormatR16G16B16SFloat:
 	case GraphicsFormatR16G16B16A16SNorm:
 	case GraphicsFormatR16G16B16A16SScaled:
 	case GraphicsFormatR16G16B16A16SInt:
-	case GraphicsFormatR16G16B16A16SFloat:
 		return GL_SHORT;
 	case GraphicsFormatR16UNorm:
 	case GraphicsFormatR16UScaled:
@@ -215,6 +211,11 @@ EGL2Types::asVertexFormat(GraphicsFormat format) noexcept
 	case GraphicsFormatR16G16B16A16UScaled:
 	case GraphicsFormatR16G16B16A16UInt:
 		return GL_UNSIGNED_SHORT;
+	case GraphicsFormatR16SFloat:
+	case GraphicsFormatR16G16SFloat:
+	case GraphicsFormatR16G16B16SFloat:
+	case GraphicsFormatR16G16B16A16SFloat:
+		return GL_HALF_FLOAT_OES;
 	case GraphicsFormatR32SInt:
 	case GraphicsFormatR32G32SInt:
 	case GraphicsFormatR32G32B32SInt:
@@ -414,6 +414,12 @@ EGL3GraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo) noexcept
 	_variant.uniformBuffer(ubo);
 }
 
+void
+EGL3GraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept
+{
+	_variant.uniformBuffer(ubo, offset, size);
+}
+
 bool
 EGL3GraphicsUniformSet::getBool() const noexcept
 {
@@ -618,6 +624,24 @@ EGL3GraphicsUniformSet::getBuffer() const noexcept
 	return _variant.getBuffer();
 }
 
+std::uint32_t
+EGL3GraphicsUniformSet::getBufferOffset() const noexcept
+{
+	return _variant.getBufferOffset();
+}
+
+std::uint32_t
+EGL3GraphicsUniformSet::getBufferSize() const noexcept
+{
+	return _variant.getBufferSize();
+}
+
+std::uint32_t
+EGL3GraphicsUniformSet::getVersion() const noexcept
+{
+	return _variant.getVersion();
+}
+
 void
 EGL3GraphicsUniformSet::setGraphicsParam(GraphicsParamPtr param) noexcept
 {
@@ -1035,7 +1059,7 @@ EGL3DescriptorSet::copy(std::uint32_t descriptorCopyCount, const GraphicsDescrip
 			case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-				(*it)->uniformBuffer(activeUniformSet->getBuffer());
+				(*it)->uniformBuffer(activeUniformSet->getBuffer(), activeUniformSet->getBufferOffset(), activeUniformSet->getBufferSize());
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 				break;
@@ -380,6 +380,30 @@ EGL3DeviceContext::getIndexBufferData() const noexcept
 	return _indexBuffer;
 }
 
+bool
+EGL3DeviceContext::uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept
+{
+	return false;
+}
+
+GraphicsDataPtr
+EGL3DeviceContext::getUniformStreamData() const noexcept
+{
+	return nullptr;
+}
+
+std::uint32_t
+EGL3DeviceContext::getUniformUploadBytes() const noexcept
+{
+	return 0;
+}
+
+std::uint32_t
+EGL3DeviceContext::getUniformUploadSkips() const noexcept
+{
+	return 0;
+}
+
 void
 EGL3DeviceContext::generateMipmap(GraphicsTexturePtr texture) noexcept
 {
@@ -81,6 +81,12 @@ public:
 	void setIndexBufferData(GraphicsDataPtr data, std::intptr_t offset, GraphicsIndexType indexType) noexcept;
 	GraphicsDataPtr getIndexBufferData() const noexcept;
 
+	bool uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept;
+	GraphicsDataPtr getUniformStreamData() const noexcept;
+
+	std::uint32_t getUniformUploadBytes() const noexcept;
+	std::uint32_t getUniformUploadSkips() const noexcept;
+
 	void generateMipmap(GraphicsTexturePtr texture) noexcept;
 
 	void setFramebuffer(GraphicsFramebufferPtr target) noexcept;
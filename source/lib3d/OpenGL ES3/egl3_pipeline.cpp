@@ -66,11 +66,13 @@ EGL3Pipeline::setup(const GraphicsPipelineDesc& pipelineDesc) noexcept
 	assert(pipelineDesc.getGraphicsInputLayout()->isInstanceOf<EGL3InputLayout>());
 	assert(pipelineDesc.getGraphicsDescriptorSetLayout()->isInstanceOf<EGL3DescriptorSetLayout>());
 
-	std::uint16_t offset = 0;
+	std::map<std::uint8_t, std::uint16_t> offsets;
 
 	auto& layouts = pipelineDesc.getGraphicsInputLayout()->getGraphicsInputLayoutDesc().getVertexLayouts();
 	for (auto& it : layouts)
 	{
+		auto& offset = offsets[it.getVertexSlot()];
+
 		GLuint attribIndex = GL_INVALID_INDEX;
 
 		auto& attributes = pipelineDesc.getGraphicsProgram()->getActiveAttributes();
@@ -40,6 +40,8 @@
 #include "ogl_sampler.h"
 #include "ogl_graphics_data.h"
 
+#include <limits>
+
 _NAME_BEGIN
 
 __ImplementSubClass(OGLDescriptorSet, GraphicsDescriptorSet, "OGLDescriptorSet")
@@ -415,6 +417,12 @@ OGLGraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo) noexcept
 	_variant.uniformBuffer(ubo);
 }
 
+void
+OGLGraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept
+{
+	_variant.uniformBuffer(ubo, offset, size);
+}
+
 bool
 OGLGraphicsUniformSet::getBool() const noexcept
 {
@@ -619,6 +627,24 @@ OGLGraphicsUniformSet::getBuffer() const noexcept
 	return _variant.getBuffer();
 }
 
+std::uint32_t
+OGLGraphicsUniformSet::getBufferOffset() const noexcept
+{
+	return _variant.getBufferOffset();
+}
+
+std::uint32_t
+OGLGraphicsUniformSet::getBufferSize() const noexcept
+{
+	return _variant.getBufferSize();
+}
+
+std::uint32_t
+OGLGraphicsUniformSet::getVersion() const noexcept
+{
+	return _variant.getVersion();
+}
+
 void
 OGLGraphicsUniformSet::setGraphicsParam(GraphicsParamPtr param) noexcept
 {
@@ -711,6 +737,7 @@ OGLDescriptorSetLayout::getDevice() noexcept
 }
 
 OGLDescriptorSet::OGLDescriptorSet() noexcept
+	: _uniformProgram(GL_NONE)
 {
 }
 
@@ -734,6 +761,8 @@ OGLDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc) noex
 		_activeUniformSets.push_back(uniformSet);
 	}
 
+	_uniformVersions.resize(_activeUniformSets.size(), std::numeric_limits<std::uint32_t>::max());
+
 	_descriptorSetDesc = descriptorSetDesc;
 	return true;
 }
@@ -741,17 +770,40 @@ OGLDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc) noex
 void
 OGLDescriptorSet::close() noexcept
 {
+	_uniformVersions.clear();
 	_activeUniformSets.clear();
 }
 
 void
-OGLDescriptorSet::apply(const OGLProgram& shaderObject) noexcept
+OGLDescriptorSet::apply(OGLProgram& shaderObject, std::uint32_t& uploadBytes, std::uint32_t& uploadSkips) noexcept
 {
 	auto program = shaderObject.getInstanceID();
-	for (auto& it : _activeUniformSets)
+	if (shaderObject.getActiveDescriptorSet() != this || _uniformProgram != program)
 	{
+		std::fill(_uniformVersions.begin(), _uniformVersions.end(), std::numeric_limits<std::uint32_t>::max());
+		shaderObject.setActiveDescriptorSet(this);
+		_uniformProgram = program;
+	}
+
+	for (std::size_t i = 0; i < _activeUniformSets.size(); i++)
+	{
+		auto& it = _activeUniformSets[i];
 		auto type = it->getGraphicsParam()->getType();
 		auto location = it->getGraphicsParam()->getBindingPoint();
+
+		if (type < GraphicsUniformType::GraphicsUniformTypeSampler)
+		{
+			auto version = it->getVersion();
+			if (_uniformVersions[i] == version)
+			{
+				uploadSkips++;
+				continue;
+			}
+
+			_uniformVersions[i] = version;
+			uploadBytes += OGLTypes::getUniformSize(*it);
+		}
+
 		switch (type)
 		{
 		case GraphicsUniformType::GraphicsUniformTypeBool:
@@ -897,7 +949,10 @@ OGLDescriptorSet::apply(const OGLProgram& shaderObject) noexcept
 			if (buffer)
 			{
 				auto ubo = buffer->downcast<OGLGraphicsData>();
-				glBindBufferBase(GL_UNIFORM_BUFFER, location, ubo->getInstanceID());
+				if (it->getBufferSize() > 0)
+					glBindBufferRange(GL_UNIFORM_BUFFER, location, ubo->getInstanceID(), it->getBufferOffset(), it->getBufferSize());
+				else
+					glBindBufferBase(GL_UNIFORM_BUFFER, location, ubo->getInstanceID());
 			}
 		}
 		break;
@@ -1043,7 +1098,7 @@ OGLDescriptorSet::copy(std::uint32_t descriptorCopyCount, const GraphicsDescript
 			case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-				(*it)->uniformBuffer(activeUniformSet->getBuffer());
+				(*it)->uniformBuffer(activeUniformSet->getBuffer(), activeUniformSet->getBufferOffset(), activeUniformSet->getBufferSize());
 				break;
 			case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 				break;
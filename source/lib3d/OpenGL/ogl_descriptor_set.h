@@ -108,6 +108,7 @@ public:
 	void uniform4fmatv(std::size_t num, const float* mat4) noexcept;
 	void uniformTexture(GraphicsTexturePtr texture, GraphicsSamplerPtr sampler) noexcept;
 	void uniformBuffer(GraphicsDataPtr ubo) noexcept;
+	void uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept;
 
 	bool getBool() const noexcept;
 	int getInt() const noexcept;
@@ -143,6 +144,10 @@ public:
 	const GraphicsTexturePtr& getTexture() const noexcept;
 	const GraphicsSamplerPtr& getTextureSampler() const noexcept;
 	const GraphicsDataPtr& getBuffer() const noexcept;
+	std::uint32_t getBufferOffset() const noexcept;
+	std::uint32_t getBufferSize() const noexcept;
+
+	std::uint32_t getVersion() const noexcept;
 
 	void setGraphicsParam(GraphicsParamPtr param) noexcept;
 	const GraphicsParamPtr& getGraphicsParam() const noexcept;
@@ -218,7 +223,7 @@ public:
 	bool setup(const GraphicsDescriptorSetDesc& desc) noexcept;
 	void close() noexcept;
 
-	void apply(const OGLProgram& program) noexcept;
+	void apply(OGLProgram& program, std::uint32_t& uploadBytes, std::uint32_t& uploadSkips) noexcept;
 
 	void copy(std::uint32_t descriptorCopyCount, const GraphicsDescriptorSetPtr descriptorCopies[]) noexcept;
 
@@ -235,6 +240,9 @@ private:
 	OGLDescriptorSet& operator=(const OGLDescriptorSet&) noexcept = delete;
 
 private:
+	GLuint _uniformProgram;
+	std::vector<std::uint32_t> _uniformVersions;
+
 	GraphicsUniformSets _activeUniformSets;
 	GraphicsDeviceWeakPtr _device;
 	GraphicsDescriptorSetDesc _descriptorSetDesc;
@@ -64,6 +64,14 @@ OGLDeviceContext::OGLDeviceContext() noexcept
 	, _indexOffset(0)
 	, _state(nullptr)
 	, _glcontext(nullptr)
+	, _uniformStreamData(nullptr)
+	, _uniformStreamSize(0)
+	, _uniformStreamIndex(0)
+	, _uniformStreamOffset(0)
+	, _uniformStreamAlignment(1)
+	, _uniformStreamFences(3, nullptr)
+	, _uniformUploadBytes(0)
+	, _uniformUploadSkips(0)
 	, _needUpdatePipeline(false)
 	, _needUpdateDescriptor(false)
 	, _needUpdateVertexBuffers(false)
@@ -100,12 +108,35 @@ OGLDeviceContext::setup(const GraphicsContextDesc& desc) noexcept
 	if (!this->initStateSystem())
 		return false;
 
+	if (desc.getUniformStreamSize() > 0 && GLEW_ARB_buffer_storage)
+	{
+		if (!this->initUniformStream(desc.getUniformStreamSize()))
+			return false;
+	}
+
 	return true;
 }
 
 void
 OGLDeviceContext::close() noexcept
 {
+	for (auto& fence : _uniformStreamFences)
+	{
+		if (fence)
+		{
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	if (_uniformStreamData)
+	{
+		_uniformStream->unmap();
+		_uniformStreamData = nullptr;
+	}
+
+	_uniformStream.reset();
+
 	_framebuffer = nullptr;
 	_program = nullptr;
 	_pipeline = nullptr;
@@ -139,11 +170,35 @@ OGLDeviceContext::renderBegin() noexcept
 		this->stopDebugControl();
 		_needDisableDebugControl = false;
 	}
+
+	_uniformUploadBytes = 0;
+	_uniformUploadSkips = 0;
+
+	if (_uniformStream)
+	{
+		auto& fence = _uniformStreamFences[_uniformStreamIndex];
+		if (fence)
+		{
+			GLenum result = glClientWaitSync(fence, 0, 0);
+			while (result == GL_TIMEOUT_EXPIRED)
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		_uniformStreamOffset = _uniformStreamIndex * _uniformStreamSize;
+	}
 }
 
 void
 OGLDeviceContext::renderEnd() noexcept
 {
+	if (_uniformStream)
+	{
+		_uniformStreamFences[_uniformStreamIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		_uniformStreamIndex = (_uniformStreamIndex + 1) % _uniformStreamFences.size();
+	}
 }
 
 void
@@ -445,6 +500,43 @@ OGLDeviceContext::getIndexBufferData() const noexcept
 	return _indexBuffer;
 }
 
+bool
+OGLDeviceContext::uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept
+{
+	assert(data && size > 0);
+
+	if (!_uniformStream)
+		return false;
+
+	std::uint32_t first = (_uniformStreamOffset + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+	if (first + size > (_uniformStreamIndex + 1) * _uniformStreamSize)
+		return false;
+
+	std::memcpy(_uniformStreamData + first, data, size);
+
+	offset = first;
+	_uniformStreamOffset = first + size;
+	return true;
+}
+
+GraphicsDataPtr
+OGLDeviceContext::getUniformStreamData() const noexcept
+{
+	return _uniformStream;
+}
+
+std::uint32_t
+OGLDeviceContext::getUniformUploadBytes() const noexcept
+{
+	return _uniformUploadBytes;
+}
+
+std::uint32_t
+OGLDeviceContext::getUniformUploadSkips() const noexcept
+{
+	return _uniformUploadSkips;
+}
+
 void
 OGLDeviceContext::generateMipmap(const GraphicsTexturePtr& texture) noexcept
 {
@@ -724,7 +816,7 @@ OGLDeviceContext::draw(std::uint32_t numVertices, std::uint32_t numInstances, st
 
 	if (_needUpdateDescriptor)
 	{
-		_descriptorSet->apply(*_program);
+		_descriptorSet->apply(*_program, _uniformUploadBytes, _uniformUploadSkips);
 		_needUpdateDescriptor = false;
 	}
 
@@ -756,7 +848,7 @@ OGLDeviceContext::drawIndexed(std::uint32_t numIndices, std::uint32_t numInstanc
 
 	if (_needUpdateDescriptor)
 	{
-		_descriptorSet->apply(*_program);
+		_descriptorSet->apply(*_program, _uniformUploadBytes, _uniformUploadSkips);
 		_needUpdateDescriptor = false;
 	}
 
@@ -913,6 +1005,41 @@ OGLDeviceContext::stopDebugControl() noexcept
 	}
 }
 
+bool
+OGLDeviceContext::initUniformStream(std::uint32_t size) noexcept
+{
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+	_uniformStreamAlignment = std::max(alignment, 1);
+	_uniformStreamSize = (size + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+
+	GraphicsDataDesc uniformStreamDesc;
+	uniformStreamDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+	uniformStreamDesc.setStreamSize(_uniformStreamSize * _uniformStreamFences.size());
+	uniformStreamDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit | GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit | GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit);
+
+	auto uniformStream = this->getDevice()->createGraphicsData(uniformStreamDesc);
+	if (!uniformStream)
+	{
+		this->getDevice()->downcast<OGLDevice>()->message("Can't create uniform stream buffer.");
+		return false;
+	}
+
+	void* data = nullptr;
+	if (!uniformStream->map(0, uniformStreamDesc.getStreamSize(), &data))
+	{
+		this->getDevice()->downcast<OGLDevice>()->message("Can't map uniform stream buffer.");
+		return false;
+	}
+
+	_uniformStream = uniformStream->downcast_pointer<OGLGraphicsData>();
+	_uniformStreamData = (std::uint8_t*)data;
+	_uniformStreamIndex = 0;
+	_uniformStreamOffset = 0;
+	return true;
+}
+
 bool
 OGLDeviceContext::initStateSystem() noexcept
 {
@@ -81,6 +81,12 @@ public:
 	void setIndexBufferData(const GraphicsDataPtr& data, std::intptr_t offset, GraphicsIndexType indexType) noexcept;
 	GraphicsDataPtr getIndexBufferData() const noexcept;
 
+	bool uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept;
+	GraphicsDataPtr getUniformStreamData() const noexcept;
+
+	std::uint32_t getUniformUploadBytes() const noexcept;
+	std::uint32_t getUniformUploadSkips() const noexcept;
+
 	void generateMipmap(const GraphicsTexturePtr& texture) noexcept;
 
 	void setFramebuffer(const GraphicsFramebufferPtr& target) noexcept;
@@ -106,6 +112,7 @@ public:
 private:
 	bool checkSupport() noexcept;
 	bool initStateSystem() noexcept;
+	bool initUniformStream(std::uint32_t size) noexcept;
 
 	static void GLAPIENTRY debugCallBack(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const GLvoid* userParam) noexcept;
 
@@ -142,6 +149,17 @@ private:
 
 	GraphicsStateDesc _stateCaptured;
 
+	OGLGraphicsDataPtr _uniformStream;
+	std::uint8_t* _uniformStreamData;
+	std::uint32_t _uniformStreamSize;
+	std::uint32_t _uniformStreamIndex;
+	std::uint32_t _uniformStreamOffset;
+	std::uint32_t _uniformStreamAlignment;
+	std::vector<GLsync> _uniformStreamFences;
+
+	std::uint32_t _uniformUploadBytes;
+	std::uint32_t _uniformUploadSkips;
+
 	bool _needUpdatePipeline;
 	bool _needUpdateDescriptor;
 	bool _needUpdateVertexBuffers;
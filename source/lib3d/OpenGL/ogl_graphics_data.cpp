@@ -97,7 +97,23 @@ OGLGraphicsData::setup(const GraphicsDataDesc& desc) noexcept
 
 	glGenBuffers(1, &_buffer);
 	glBindBuffer(_target, _buffer);
-	glBufferData(_target, desc.getStreamSize(), desc.getStream(), flags);
+
+	if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit && GLEW_ARB_buffer_storage)
+	{
+		GLbitfield storageFlags = GL_MAP_PERSISTENT_BIT;
+		if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagReadBit)
+			storageFlags |= GL_MAP_READ_BIT;
+		if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit)
+			storageFlags |= GL_MAP_WRITE_BIT;
+		if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit)
+			storageFlags |= GL_MAP_COHERENT_BIT;
+
+		glBufferStorage(_target, desc.getStreamSize(), desc.getStream(), storageFlags);
+	}
+	else
+	{
+		glBufferData(_target, desc.getStreamSize(), desc.getStream(), flags);
+	}
 
 	return true;
 }
@@ -138,6 +154,10 @@ OGLGraphicsData::map(std::ptrdiff_t offset, std::ptrdiff_t count, void** data) n
 		flags |= GL_MAP_READ_BIT;
 	if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit)
 		flags |= GL_MAP_WRITE_BIT;
+	if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit && GLEW_ARB_buffer_storage)
+		flags |= GL_MAP_PERSISTENT_BIT;
+	if (usage & GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit && GLEW_ARB_buffer_storage)
+		flags |= GL_MAP_COHERENT_BIT;
 
 	_data = *data = glMapBufferRange(_target, offset, count, flags);
 	return _data ? true : false;
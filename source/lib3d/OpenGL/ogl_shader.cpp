@@ -495,6 +495,7 @@ OGLShader::getDevice() noexcept
 
 OGLProgram::OGLProgram() noexcept
 	: _program(GL_NONE)
+	, _activeDescriptorSet(nullptr)
 {
 }
 
@@ -558,6 +559,7 @@ OGLProgram::close() noexcept
 		_program = GL_NONE;
 	}
 
+	_activeDescriptorSet = nullptr;
 	_activeAttributes.clear();
 	_activeParams.clear();
 }
@@ -580,6 +582,18 @@ OGLProgram::getActiveAttributes() const noexcept
 	return _activeAttributes;
 }
 
+void
+OGLProgram::setActiveDescriptorSet(const GraphicsDescriptorSet* descriptorSet) noexcept
+{
+	_activeDescriptorSet = descriptorSet;
+}
+
+const GraphicsDescriptorSet*
+OGLProgram::getActiveDescriptorSet() const noexcept
+{
+	return _activeDescriptorSet;
+}
+
 const GraphicsParams&
 OGLProgram::getActiveParams() const noexcept
 {
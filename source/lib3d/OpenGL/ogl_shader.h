@@ -196,6 +196,9 @@ public:
 
 	GLuint getInstanceID() const noexcept;
 
+	void setActiveDescriptorSet(const GraphicsDescriptorSet* descriptorSet) noexcept;
+	const GraphicsDescriptorSet* getActiveDescriptorSet() const noexcept;
+
 	const GraphicsParams& getActiveParams() const noexcept;
 	const GraphicsAttributes& getActiveAttributes() const noexcept;
 
@@ -221,6 +224,7 @@ private:
 
 private:
 	GLuint _program;
+	const GraphicsDescriptorSet* _activeDescriptorSet;
 	GraphicsParams _activeParams;
 	GraphicsAttributes  _activeAttributes;
 	GraphicsProgramDesc _programDesc;
@@ -120,19 +120,15 @@ OGLTypes::asVertexFormat(GraphicsFormat format) noexcept
 	case GraphicsFormat::GraphicsFormatR16SNorm:
 	case GraphicsFormat::GraphicsFormatR16SScaled:
 	case GraphicsFormat::GraphicsFormatR16SInt:
-	case GraphicsFormat::GraphicsFormatR16SFloat:
 	case GraphicsFormat::GraphicsFormatR16G16SNorm:
 	case GraphicsFormat::GraphicsFormatR16G16SScaled:
 	case GraphicsFormat::GraphicsFormatR16G16SInt:
-	case GraphicsFormat::GraphicsFormatR16G16SFloat:
 	case GraphicsFormat::GraphicsFormatR16G16B16SNorm:
 	case GraphicsFormat::GraphicsFormatR16G16B16SScaled:
 	case GraphicsFormat::GraphicsFormatR16G16B16SInt:
-	case GraphicsFormat::GraphicsFormatR16G16B16SFloat:
 	case GraphicsFormat::GraphicsFormatR16G16B16A16SNorm:
 	case GraphicsFormat::GraphicsFormatR16G16B16A16SScaled:
 	case GraphicsFormat::GraphicsFormatR16G16B16A16SInt:
-	case GraphicsFormat::GraphicsFormatR16G16B16A16SFloat:
 		return GL_SHORT;
 	case GraphicsFormat::GraphicsFormatR16UNorm:
 	case GraphicsFormat::GraphicsFormatR16UScaled:
@@ -147,6 +143,11 @@ OGLTypes::asVertexFormat(GraphicsFormat format) noexcept
 	case GraphicsFormat::GraphicsFormatR16G16B16A16UScaled:
 	case GraphicsFormat::GraphicsFormatR16G16B16A16UInt:
 		return GL_UNSIGNED_SHORT;
+	case GraphicsFormat::GraphicsFormatR16SFloat:
+	case GraphicsFormat::GraphicsFormatR16G16SFloat:
+	case GraphicsFormat::GraphicsFormatR16G16B16SFloat:
+	case GraphicsFormat::GraphicsFormatR16G16B16A16SFloat:
+		return GL_HALF_FLOAT;
 	case GraphicsFormat::GraphicsFormatR32SInt:
 	case GraphicsFormat::GraphicsFormatR32G32SInt:
 	case GraphicsFormat::GraphicsFormatR32G32B32SInt:
@@ -965,6 +966,47 @@ OGLTypes::getCompressedTextureSize(GLsizei width, GLsizei height, GLsizei depth,
 	}
 }
 
+GLsizei
+OGLTypes::getUniformSize(const GraphicsUniformSet& uniformSet) noexcept
+{
+	switch (uniformSet.getGraphicsParam()->getType())
+	{
+	case GraphicsUniformType::GraphicsUniformTypeBool:              return sizeof(GLint);
+	case GraphicsUniformType::GraphicsUniformTypeInt:               return sizeof(int1);
+	case GraphicsUniformType::GraphicsUniformTypeInt2:              return sizeof(int2);
+	case GraphicsUniformType::GraphicsUniformTypeInt3:              return sizeof(int3);
+	case GraphicsUniformType::GraphicsUniformTypeInt4:              return sizeof(int4);
+	case GraphicsUniformType::GraphicsUniformTypeUInt:              return sizeof(uint1);
+	case GraphicsUniformType::GraphicsUniformTypeUInt2:             return sizeof(uint2);
+	case GraphicsUniformType::GraphicsUniformTypeUInt3:             return sizeof(uint3);
+	case GraphicsUniformType::GraphicsUniformTypeUInt4:             return sizeof(uint4);
+	case GraphicsUniformType::GraphicsUniformTypeFloat:             return sizeof(float1);
+	case GraphicsUniformType::GraphicsUniformTypeFloat2:            return sizeof(float2);
+	case GraphicsUniformType::GraphicsUniformTypeFloat3:            return sizeof(float3);
+	case GraphicsUniformType::GraphicsUniformTypeFloat4:            return sizeof(float4);
+	case GraphicsUniformType::GraphicsUniformTypeFloat2x2:          return sizeof(float2x2);
+	case GraphicsUniformType::GraphicsUniformTypeFloat3x3:          return sizeof(float3x3);
+	case GraphicsUniformType::GraphicsUniformTypeFloat4x4:          return sizeof(float4x4);
+	case GraphicsUniformType::GraphicsUniformTypeIntArray:          return static_cast<GLsizei>(uniformSet.getIntArray().size() * sizeof(int1));
+	case GraphicsUniformType::GraphicsUniformTypeInt2Array:         return static_cast<GLsizei>(uniformSet.getInt2Array().size() * sizeof(int2));
+	case GraphicsUniformType::GraphicsUniformTypeInt3Array:         return static_cast<GLsizei>(uniformSet.getInt3Array().size() * sizeof(int3));
+	case GraphicsUniformType::GraphicsUniformTypeInt4Array:         return static_cast<GLsizei>(uniformSet.getInt4Array().size() * sizeof(int4));
+	case GraphicsUniformType::GraphicsUniformTypeUIntArray:         return static_cast<GLsizei>(uniformSet.getUIntArray().size() * sizeof(uint1));
+	case GraphicsUniformType::GraphicsUniformTypeUInt2Array:        return static_cast<GLsizei>(uniformSet.getUInt2Array().size() * sizeof(uint2));
+	case GraphicsUniformType::GraphicsUniformTypeUInt3Array:        return static_cast<GLsizei>(uniformSet.getUInt3Array().size() * sizeof(uint3));
+	case GraphicsUniformType::GraphicsUniformTypeUInt4Array:        return static_cast<GLsizei>(uniformSet.getUInt4Array().size() * sizeof(uint4));
+	case GraphicsUniformType::GraphicsUniformTypeFloatArray:        return static_cast<GLsizei>(uniformSet.getFloatArray().size() * sizeof(float1));
+	case GraphicsUniformType::GraphicsUniformTypeFloat2Array:       return static_cast<GLsizei>(uniformSet.getFloat2Array().size() * sizeof(float2));
+	case GraphicsUniformType::GraphicsUniformTypeFloat3Array:       return static_cast<GLsizei>(uniformSet.getFloat3Array().size() * sizeof(float3));
+	case GraphicsUniformType::GraphicsUniformTypeFloat4Array:       return static_cast<GLsizei>(uniformSet.getFloat4Array().size() * sizeof(float4));
+	case GraphicsUniformType::GraphicsUniformTypeFloat2x2Array:     return static_cast<GLsizei>(uniformSet.getFloat2x2Array().size() * sizeof(float2x2));
+	case GraphicsUniformType::GraphicsUniformTypeFloat3x3Array:     return static_cast<GLsizei>(uniformSet.getFloat3x3Array().size() * sizeof(float3x3));
+	case GraphicsUniformType::GraphicsUniformTypeFloat4x4Array:     return static_cast<GLsizei>(uniformSet.getFloat4x4Array().size() * sizeof(float4x4));
+	default:
+		return 0;
+	}
+}
+
 GLboolean
 OGLTypes::isNormFormat(GraphicsFormat format) noexcept
 {
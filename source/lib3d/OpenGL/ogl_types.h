@@ -184,6 +184,7 @@ public:
 
 	static GLsizei getFormatNum(GLenum format, GLenum type) noexcept;
 	static GLsizei getCompressedTextureSize(GLsizei width, GLsizei height, GLsizei depth, GLenum internalFormat) noexcept;
+	static GLsizei getUniformSize(const GraphicsUniformSet& uniformSet) noexcept;
 
 	static GLboolean isNormFormat(GraphicsFormat format) noexcept;
 	static GLboolean isStencilFormat(GraphicsFormat format) noexcept;
@@ -433,10 +433,11 @@ VulkanCommandList::setDescriptorSet(GraphicsDescriptorSetPtr descriptorSet) noex
 	assert(descriptorSet->isInstanceOf<VulkanDescriptorSet>());
 
 	auto vulkanDescripotrSet = descriptorSet->downcast<VulkanDescriptorSet>();
-	if (_descripotrSet != vulkanDescripotrSet)
+	auto& dynamicOffsets = vulkanDescripotrSet->getDynamicOffsets();
+	if (_descripotrSet != vulkanDescripotrSet || !dynamicOffsets.empty())
 	{
 		VkDescriptorSet descriptorSetHandle = vulkanDescripotrSet->getDescriptorSet();
-		vkCmdBindDescriptorSets(_commandBuffer, _pipeline->getPipelineBindPoint(), _pipeline->getPipelineLayout(), 0, 1, &descriptorSetHandle, 0, nullptr);
+		vkCmdBindDescriptorSets(_commandBuffer, _pipeline->getPipelineBindPoint(), _pipeline->getPipelineLayout(), 0, 1, &descriptorSetHandle, dynamicOffsets.size(), dynamicOffsets.data());
 		_descripotrSet = vulkanDescripotrSet;
 	}
 }
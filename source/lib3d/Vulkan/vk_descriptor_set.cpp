@@ -489,6 +489,13 @@ VulkanGraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo) noexcept
 	_variant.uniformBuffer(ubo);
 }
 
+void
+VulkanGraphicsUniformSet::uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept
+{
+	this->needUpdate(true);
+	_variant.uniformBuffer(ubo, offset, size);
+}
+
 bool
 VulkanGraphicsUniformSet::getBool() const noexcept
 {
@@ -693,6 +700,24 @@ VulkanGraphicsUniformSet::getBuffer() const noexcept
 	return _variant.getBuffer();
 }
 
+std::uint32_t
+VulkanGraphicsUniformSet::getBufferOffset() const noexcept
+{
+	return _variant.getBufferOffset();
+}
+
+std::uint32_t
+VulkanGraphicsUniformSet::getBufferSize() const noexcept
+{
+	return _variant.getBufferSize();
+}
+
+std::uint32_t
+VulkanGraphicsUniformSet::getVersion() const noexcept
+{
+	return _variant.getVersion();
+}
+
 void
 VulkanGraphicsUniformSet::setGraphicsParam(GraphicsParamPtr param) noexcept
 {
@@ -871,6 +896,8 @@ VulkanDescriptorSetLayout::getDevice() noexcept
 
 VulkanDescriptorSet::VulkanDescriptorSet() noexcept
 	: _vkDescriptorSet(VK_NULL_HANDLE)
+	, _globalUniformFrame(0)
+	, _globalUniformDirty(true)
 {
 }
 
@@ -911,6 +938,8 @@ VulkanDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc) n
 	{
 		if (param->getType() == GraphicsUniformType::GraphicsUniformTypeUniformBuffer)
 		{
+			_dynamicBindings.push_back(param->getBindingPoint());
+
 			auto uniformBlock = param->downcast<VulkanGraphicsUniformBlock>();
 			auto& name = uniformBlock->getName();
 			if (name == "Globals")
@@ -936,8 +965,15 @@ VulkanDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc) n
 				}
 
 				_globalUniformBlock = uniformBlock->downcast_pointer<VulkanGraphicsUniformBlock>();
+				_globalUniformData.resize(uniformBlock->getBlockSize());
 				_globalData = ubo->downcast_pointer<VulkanGraphicsData>();
 			}
+			else
+			{
+				auto uniformSet = std::make_shared<VulkanGraphicsUniformSet>();
+				uniformSet->setGraphicsParam(param);
+				_activeUniformSets.push_back(uniformSet);
+			}
 		}
 		else
 		{
@@ -947,14 +983,18 @@ VulkanDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc) n
 		}
 	}
 
+	std::sort(_dynamicBindings.begin(), _dynamicBindings.end());
+	_dynamicBuffers.resize(_dynamicBindings.size(), VK_NULL_HANDLE);
+	_dynamicOffsets.resize(_dynamicBindings.size(), 0);
+
 	std::vector<VkWriteDescriptorSet> descriptorWrites;
+	VkDescriptorBufferInfo bufferInfo;
 
 	if (_globalUniformBlock)
 	{
 		auto uniformBlock = _globalUniformBlock;
 		auto data = _globalData->downcast<VulkanGraphicsData>();
 
-		VkDescriptorBufferInfo bufferInfo;
 		bufferInfo.buffer = data->getBuffer();
 		bufferInfo.offset = 0;
 		bufferInfo.range = data->getGraphicsDataDesc().getStreamSize();
@@ -972,6 +1012,8 @@ VulkanDescriptorSet::setup(const GraphicsDescriptorSetDesc& descriptorSetDesc) n
 		write.pTexelBufferView = nullptr;
 
 		descriptorWrites.push_back(write);
+
+		_dynamicBuffers[this->getDynamicSlot(uniformBlock->getBindingPoint())] = data->getBuffer();
 	}
 
 	if (!descriptorWrites.empty())
@@ -999,6 +1041,7 @@ VulkanDescriptorSet::update() noexcept
 	std::uint32_t descriptorWriteCount = 0;
 	VkWriteDescriptorSet descriptorWrites[10];
 	VkDescriptorImageInfo descriptorImageInfos[10];
+	VkDescriptorBufferInfo descriptorBufferInfos[10];
 
 	for (auto& it : _activeUniformSets)
 	{
@@ -1073,7 +1116,38 @@ VulkanDescriptorSet::update() noexcept
 		case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
 			break;
 		case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-			break;
+		{
+			auto& buffer = it->getBuffer();
+			if (buffer)
+			{
+				auto slot = this->getDynamicSlot(bindingPoint);
+				auto vkBuffer = buffer->downcast<VulkanGraphicsData>()->getBuffer();
+				if (_dynamicBuffers[slot] != vkBuffer)
+				{
+					auto& info = descriptorBufferInfos[descriptorWriteCount];
+					info.buffer = vkBuffer;
+					info.offset = 0;
+					info.range = it->getBufferSize() > 0 ? it->getBufferSize() : param->downcast<VulkanGraphicsUniformBlock>()->getBlockSize();
+
+					auto& write = descriptorWrites[descriptorWriteCount++];
+					write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					write.pNext = nullptr;
+					write.descriptorType = VulkanTypes::asDescriptorType(type);
+					write.descriptorCount = 1;
+					write.dstSet = _vkDescriptorSet;
+					write.dstArrayElement = 0;
+					write.dstBinding = bindingPoint;
+					write.pBufferInfo = &info;
+					write.pImageInfo = nullptr;
+					write.pTexelBufferView = nullptr;
+
+					_dynamicBuffers[slot] = vkBuffer;
+				}
+
+				_dynamicOffsets[slot] = it->getBufferOffset();
+			}
+		}
+		break;
 		case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 			break;
 		case GraphicsUniformType::GraphicsUniformTypeInputAttachment:
@@ -1088,7 +1162,7 @@ VulkanDescriptorSet::update() noexcept
 		vkUpdateDescriptorSets(_device.lock()->getDevice(), descriptorWriteCount, descriptorWrites, 0, nullptr);
 	}
 
-	void* buffer = nullptr;
+	void* buffer = _globalUniformData.data();
 
 	for (auto& activeUniformSet : _activeGlobalUniformSets)
 	{
@@ -1096,11 +1170,7 @@ VulkanDescriptorSet::update() noexcept
 		if (!uniformSet->needUpdate())
 			continue;
 
-		if (!buffer)
-		{
-			if (!_globalData->map(0, _globalData->getGraphicsDataDesc().getStreamSize(), &buffer))
-				break;
-		}			
+		_globalUniformDirty = true;
 
 		auto uniform = uniformSet->getGraphicsParam()->downcast<VulkanGraphicsUniform>();
 		auto uniformType = uniform->getType();
@@ -1205,11 +1275,87 @@ VulkanDescriptorSet::update() noexcept
 
 		uniformSet->needUpdate(false);
 	}
+}
 
-	if (buffer)
+void
+VulkanDescriptorSet::bindGlobalUniformData(const GraphicsDataPtr& data, std::uint32_t offset, std::uint64_t frame) noexcept
+{
+	assert(data);
+	assert(_globalUniformBlock);
+
+	auto slot = this->getDynamicSlot(_globalUniformBlock->getBindingPoint());
+	auto vkBuffer = data->downcast<VulkanGraphicsData>()->getBuffer();
+	if (_dynamicBuffers[slot] != vkBuffer)
 	{
+		VkDescriptorBufferInfo bufferInfo;
+		bufferInfo.buffer = vkBuffer;
+		bufferInfo.offset = 0;
+		bufferInfo.range = _globalUniformBlock->getBlockSize();
+
+		VkWriteDescriptorSet write;
+		write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		write.pNext = nullptr;
+		write.descriptorType = VulkanTypes::asDescriptorType(_globalUniformBlock->getType());
+		write.descriptorCount = 1;
+		write.dstSet = _vkDescriptorSet;
+		write.dstArrayElement = 0;
+		write.dstBinding = _globalUniformBlock->getBindingPoint();
+		write.pBufferInfo = &bufferInfo;
+		write.pImageInfo = nullptr;
+		write.pTexelBufferView = nullptr;
+
+		vkUpdateDescriptorSets(_device.lock()->getDevice(), 1, &write, 0, nullptr);
+
+		_dynamicBuffers[slot] = vkBuffer;
+	}
+
+	_dynamicOffsets[slot] = offset;
+
+	_globalUniformFrame = frame;
+	_globalUniformDirty = false;
+}
+
+void
+VulkanDescriptorSet::flushGlobalUniformData() noexcept
+{
+	assert(_globalData);
+
+	void* buffer = nullptr;
+	if (_globalData->map(0, _globalUniformData.size(), &buffer))
+	{
+		std::memcpy(buffer, _globalUniformData.data(), _globalUniformData.size());
 		_globalData->unmap();
 	}
+
+	this->bindGlobalUniformData(_globalData, 0, std::numeric_limits<std::uint64_t>::max());
+}
+
+bool
+VulkanDescriptorSet::needUploadGlobalUniformData(std::uint64_t frame) const noexcept
+{
+	if (_globalUniformDirty)
+		return true;
+	return _globalUniformFrame != frame && _globalUniformFrame != std::numeric_limits<std::uint64_t>::max();
+}
+
+const std::vector<std::uint8_t>&
+VulkanDescriptorSet::getGlobalUniformData() const noexcept
+{
+	return _globalUniformData;
+}
+
+const std::vector<std::uint32_t>&
+VulkanDescriptorSet::getDynamicOffsets() const noexcept
+{
+	return _dynamicOffsets;
+}
+
+std::size_t
+VulkanDescriptorSet::getDynamicSlot(std::uint32_t bindingPoint) const noexcept
+{
+	auto it = std::lower_bound(_dynamicBindings.begin(), _dynamicBindings.end(), bindingPoint);
+	assert(it != _dynamicBindings.end() && *it == bindingPoint);
+	return std::distance(_dynamicBindings.begin(), it);
 }
 
 VkDescriptorSet
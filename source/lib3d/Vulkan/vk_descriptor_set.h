@@ -111,6 +111,7 @@ public:
 	void uniform4fmatv(std::size_t num, const float* mat4) noexcept;
 	void uniformTexture(GraphicsTexturePtr texture, GraphicsSamplerPtr sampler) noexcept;
 	void uniformBuffer(GraphicsDataPtr ubo) noexcept;
+	void uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept;
 
 	bool getBool() const noexcept;
 	int getInt() const noexcept;
@@ -146,6 +147,10 @@ public:
 	const GraphicsTexturePtr& getTexture() const noexcept;
 	const GraphicsSamplerPtr& getTextureSampler() const noexcept;
 	const GraphicsDataPtr& getBuffer() const noexcept;
+	std::uint32_t getBufferOffset() const noexcept;
+	std::uint32_t getBufferSize() const noexcept;
+
+	std::uint32_t getVersion() const noexcept;
 
 	void setGraphicsParam(GraphicsParamPtr param) noexcept;
 	const GraphicsParamPtr& getGraphicsParam() const noexcept;
@@ -228,11 +233,29 @@ public:
 
 	void update() noexcept;
 
+	void bindGlobalUniformData(const GraphicsDataPtr& data, std::uint32_t offset, std::uint64_t frame) noexcept;
+	void flushGlobalUniformData() noexcept;
+
+	bool needUploadGlobalUniformData(std::uint64_t frame) const noexcept;
+
+	const std::vector<std::uint8_t>& getGlobalUniformData() const noexcept;
+	const std::vector<std::uint32_t>& getDynamicOffsets() const noexcept;
+
+private:
+	std::size_t getDynamicSlot(std::uint32_t bindingPoint) const noexcept;
+
 private:
 	VkDescriptorSet _vkDescriptorSet;
 
 	VulkanGraphicsDataPtr _globalData;
 	VulkanGraphicsUniformBlockPtr _globalUniformBlock;
+	std::vector<std::uint8_t> _globalUniformData;
+	std::uint64_t _globalUniformFrame;
+	bool _globalUniformDirty;
+
+	std::vector<VkBuffer> _dynamicBuffers;
+	std::vector<std::uint32_t> _dynamicBindings;
+	std::vector<std::uint32_t> _dynamicOffsets;
 
 	std::vector<VkWriteDescriptorSet> _writes;
 
@@ -52,6 +52,15 @@ VulkanDeviceContext::VulkanDeviceContext() noexcept
 	: _viewports(8)
 	, _scissor(8)
 	, _clearValues(8)
+	, _uniformStreamData(nullptr)
+	, _uniformStreamSize(0)
+	, _uniformStreamCount(3)
+	, _uniformStreamIndex(0)
+	, _uniformStreamOffset(0)
+	, _uniformStreamAlignment(1)
+	, _uniformStreamFrame(0)
+	, _uniformUploadBytes(0)
+	, _uniformUploadSkips(0)
 {
 }
 
@@ -71,12 +80,25 @@ VulkanDeviceContext::setup(const GraphicsContextDesc& desc) noexcept
 	if (!this->initCommandList())
 		return false;
 
+	if (desc.getUniformStreamSize() > 0)
+	{
+		if (!this->initUniformStream(desc.getUniformStreamSize()))
+			return false;
+	}
+
 	return true;
 }
 
 void
 VulkanDeviceContext::close() noexcept
 {
+	if (_uniformStreamData)
+	{
+		_uniformStream->unmap();
+		_uniformStreamData = nullptr;
+	}
+
+	_uniformStream.reset();
 	_commandQueue.reset();
 	_commandList.reset();
 	_commandPool.reset();
@@ -94,6 +116,10 @@ VulkanDeviceContext::renderBegin() noexcept
 
 		_commandList->setFramebuffer(swapchaic->getSwapchainFramebuffers()[swapchaic->getSwapchainImageIndex()]);
 	}
+
+	_uniformStreamOffset = _uniformStreamIndex * _uniformStreamSize;
+	_uniformUploadBytes = 0;
+	_uniformUploadSkips = 0;
 }
 
 void
@@ -106,6 +132,11 @@ VulkanDeviceContext::renderEnd() noexcept
 		_commandQueue->present(&_swapchain, 1);
 
 	_commandQueue->wait();
+
+	if (_uniformStream)
+		_uniformStreamIndex = (_uniformStreamIndex + 1) % _uniformStreamCount;
+
+	_uniformStreamFrame++;
 }
 
 void
@@ -239,7 +270,28 @@ VulkanDeviceContext::setDescriptorSet(const GraphicsDescriptorSetPtr& descriptor
 	assert(descriptorSet);
 	assert(descriptorSet->isInstanceOf<VulkanDescriptorSet>());
 
-	descriptorSet->downcast<VulkanDescriptorSet>()->update();
+	auto vkDescriptorSet = descriptorSet->downcast<VulkanDescriptorSet>();
+	vkDescriptorSet->update();
+
+	auto& globalData = vkDescriptorSet->getGlobalUniformData();
+	if (!globalData.empty())
+	{
+		if (vkDescriptorSet->needUploadGlobalUniformData(_uniformStreamFrame))
+		{
+			std::uint32_t offset = 0;
+			if (this->uploadUniformStreamData(globalData.data(), globalData.size(), offset))
+				vkDescriptorSet->bindGlobalUniformData(_uniformStream, offset, _uniformStreamFrame);
+			else
+				vkDescriptorSet->flushGlobalUniformData();
+
+			_uniformUploadBytes += static_cast<std::uint32_t>(globalData.size());
+		}
+		else
+		{
+			_uniformUploadSkips++;
+		}
+	}
+
 	_commandList->setDescriptorSet(descriptorSet);
 }
 
@@ -284,6 +336,43 @@ VulkanDeviceContext::getIndexBufferData() const noexcept
 	return _indexBuffer;
 }
 
+bool
+VulkanDeviceContext::uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept
+{
+	assert(data && size > 0);
+
+	if (!_uniformStream)
+		return false;
+
+	std::uint32_t first = (_uniformStreamOffset + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+	if (first + size > (_uniformStreamIndex + 1) * _uniformStreamSize)
+		return false;
+
+	std::memcpy(_uniformStreamData + first, data, size);
+
+	offset = first;
+	_uniformStreamOffset = first + size;
+	return true;
+}
+
+GraphicsDataPtr
+VulkanDeviceContext::getUniformStreamData() const noexcept
+{
+	return _uniformStream;
+}
+
+std::uint32_t
+VulkanDeviceContext::getUniformUploadBytes() const noexcept
+{
+	return _uniformUploadBytes;
+}
+
+std::uint32_t
+VulkanDeviceContext::getUniformUploadSkips() const noexcept
+{
+	return _uniformUploadSkips;
+}
+
 void
 VulkanDeviceContext::draw(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t startVertice, std::uint32_t startInstances) noexcept
 {
@@ -352,6 +441,41 @@ VulkanDeviceContext::initCommandList() noexcept
 	return true;
 }
 
+bool
+VulkanDeviceContext::initUniformStream(std::uint32_t size) noexcept
+{
+	auto device = this->getDevice()->downcast<VulkanDevice>();
+
+	auto alignment = device->getGraphicsDeviceProperty().getGraphicsDeviceProperties().minUniformBufferOffsetAlignment;
+
+	_uniformStreamAlignment = std::max<std::uint32_t>(alignment, 1);
+	_uniformStreamSize = (size + _uniformStreamAlignment - 1) / _uniformStreamAlignment * _uniformStreamAlignment;
+
+	GraphicsDataDesc uniformStreamDesc;
+	uniformStreamDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+	uniformStreamDesc.setStreamSize(_uniformStreamSize * _uniformStreamCount);
+	uniformStreamDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit | GraphicsUsageFlagBits::GraphicsUsageFlagPersistentBit | GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit);
+
+	_uniformStream = device->createGraphicsData(uniformStreamDesc);
+	if (!_uniformStream)
+	{
+		VK_PLATFORM_LOG("Can't create uniform stream buffer.");
+		return false;
+	}
+
+	void* data = nullptr;
+	if (!_uniformStream->map(0, uniformStreamDesc.getStreamSize(), &data))
+	{
+		VK_PLATFORM_LOG("Can't map uniform stream buffer.");
+		return false;
+	}
+
+	_uniformStreamData = (std::uint8_t*)data;
+	_uniformStreamIndex = 0;
+	_uniformStreamOffset = 0;
+	return true;
+}
+
 void
 VulkanDeviceContext::setDevice(GraphicsDevicePtr device) noexcept
 {
@@ -81,6 +81,12 @@ public:
 	void setIndexBufferData(const GraphicsDataPtr& data, std::intptr_t offset, GraphicsIndexType indexType) noexcept;
 	GraphicsDataPtr getIndexBufferData() const noexcept;
 
+	bool uploadUniformStreamData(const void* data, std::uint32_t size, std::uint32_t& offset) noexcept;
+	GraphicsDataPtr getUniformStreamData() const noexcept;
+
+	std::uint32_t getUniformUploadBytes() const noexcept;
+	std::uint32_t getUniformUploadSkips() const noexcept;
+
 	void generateMipmap(const GraphicsTexturePtr& texture) noexcept;
 
 	void setFramebuffer(const GraphicsFramebufferPtr& target) noexcept;
@@ -99,6 +105,7 @@ public:
 
 private:
 	bool initCommandList() noexcept;
+	bool initUniformStream(std::uint32_t size) noexcept;
 
 private:
 	friend class VulkanDevice;
@@ -128,6 +135,18 @@ private:
 	GraphicsFramebufferPtr _framebuffer;
 	GraphicsInputLayoutPtr _inputLayout;
 
+	GraphicsDataPtr _uniformStream;
+	std::uint8_t* _uniformStreamData;
+	std::uint32_t _uniformStreamSize;
+	std::uint32_t _uniformStreamCount;
+	std::uint32_t _uniformStreamIndex;
+	std::uint32_t _uniformStreamOffset;
+	std::uint32_t _uniformStreamAlignment;
+	std::uint64_t _uniformStreamFrame;
+
+	std::uint32_t _uniformUploadBytes;
+	std::uint32_t _uniformUploadSkips;
+
 	VulkanDeviceWeakPtr _device;
 };
 
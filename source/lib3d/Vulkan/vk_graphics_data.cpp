@@ -90,7 +90,11 @@ VulkanGraphicsData::setup(const GraphicsDataDesc& dataDesc) noexcept
 	VkMemoryRequirements memReq;
 	vkGetBufferMemoryRequirements(this->getDevice()->downcast<VulkanDevice>()->getDevice(), _vkBuffer, &memReq);
 
-	if (!_memory.setup(memReq.size, memReq.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+	VkFlags memoryFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+	if (dataDesc.getUsage() & GraphicsUsageFlagBits::GraphicsUsageFlagCoherentBit)
+		memoryFlags |= VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+	if (!_memory.setup(memReq.size, memReq.memoryTypeBits, memoryFlags))
 		return false;
 
 	if (vkBindBufferMemory(this->getDevice()->downcast<VulkanDevice>()->getDevice(), _vkBuffer, _memory.getDeviceMemory(), 0) != VK_SUCCESS)
@@ -107,11 +107,13 @@ VulkanPipeline::setup(const GraphicsPipelineDesc& pipelineDesc) noexcept
 	memset(&dynamicStateEnables[0], 0, sizeof(dynamicStateEnables));
 	memset(&shaderStages[0], 0, sizeof(shaderStages));
 
-	std::uint32_t offset = 0;
+	std::map<std::uint8_t, std::uint32_t> offsets;
 
 	const auto& layouts = inputLayoutDesc.getVertexLayouts();
 	for (auto& layout : layouts)
 	{
+		auto& offset = offsets[layout.getVertexSlot()];
+
 		auto& attributes = pipelineDesc.getGraphicsProgram()->getActiveAttributes();
 		for (auto& it : attributes)
 		{
@@ -747,7 +747,7 @@ VulkanTypes::asDescriptorType(GraphicsUniformType type) noexcept
 	case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
 		return VkDescriptorType::VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
 	case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-		return VkDescriptorType::VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		return VkDescriptorType::VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 	case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 		return VkDescriptorType::VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 	case GraphicsUniformType::GraphicsUniformTypeInputAttachment:
@@ -0,0 +1,245 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/graphics_command_log.h>
+#include <ostream>
+
+_NAME_BEGIN
+
+__ImplementSingleton(GraphicsCommandLog)
+
+GraphicsCommandLogCounter::GraphicsCommandLogCounter() noexcept
+	: numDraws(0)
+	, numInstances(0)
+	, numPrimitives(0)
+	, numPipelineChanges(0)
+	, numDescriptorSetChanges(0)
+	, numVertexBufferChanges(0)
+	, numIndexBufferChanges(0)
+	, numFramebufferChanges(0)
+	, numViewportChanges(0)
+	, numStencilChanges(0)
+	, numClears(0)
+	, numPresents(0)
+	, numUploadBytes(0)
+	, numUniformBytes(0)
+{
+}
+
+std::uint32_t
+GraphicsCommandLogCounter::getStateChanges() const noexcept
+{
+	return
+		numPipelineChanges +
+		numDescriptorSetChanges +
+		numVertexBufferChanges +
+		numIndexBufferChanges +
+		numFramebufferChanges +
+		numViewportChanges +
+		numStencilChanges;
+}
+
+GraphicsCommandLog::GraphicsCommandLog() noexcept
+	: _enableRecord(false)
+{
+}
+
+GraphicsCommandLog::~GraphicsCommandLog() noexcept
+{
+}
+
+void
+GraphicsCommandLog::setRecordEnable(bool enable) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_enableRecord = enable;
+}
+
+bool
+GraphicsCommandLog::getRecordEnable() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _enableRecord;
+}
+
+void
+GraphicsCommandLog::record(GraphicsCommandLogType type, std::uint32_t arg0, std::uint32_t arg1, std::uint32_t arg2, std::uint32_t arg3) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	switch (type)
+	{
+	case GraphicsCommandLogType::GraphicsCommandLogTypeUploadBuffer:
+	case GraphicsCommandLogType::GraphicsCommandLogTypeUploadTexture:
+		_counter.numUploadBytes += arg2;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeUploadUniform:
+		_counter.numUploadBytes += arg0;
+		_counter.numUniformBytes += arg0;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetViewport:
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetScissor:
+		_counter.numViewportChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilCompareMask:
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilReference:
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilWriteMask:
+		_counter.numStencilChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetPipeline:
+		_counter.numPipelineChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetDescriptorSet:
+		_counter.numDescriptorSetChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetVertexBuffer:
+		_counter.numVertexBufferChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetIndexBuffer:
+		_counter.numIndexBufferChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetFramebuffer:
+		_counter.numFramebufferChanges++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeClearFramebuffer:
+		_counter.numClears++;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDraw:
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndexed:
+		_counter.numDraws++;
+		_counter.numInstances += arg1;
+		_counter.numPrimitives += (std::uint64_t)arg2 * arg1;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndirect:
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndexedIndirect:
+		_counter.numDraws += arg2;
+		break;
+	case GraphicsCommandLogType::GraphicsCommandLogTypePresent:
+		_counter.numPresents++;
+		break;
+	default:
+		break;
+	}
+
+	if (_enableRecord)
+	{
+		GraphicsCommandLogRecord record;
+		record.type = type;
+		record.args[0] = arg0;
+		record.args[1] = arg1;
+		record.args[2] = arg2;
+		record.args[3] = arg3;
+
+		_records.push_back(record);
+	}
+}
+
+void
+GraphicsCommandLog::clear() noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_counter = GraphicsCommandLogCounter();
+	_records.clear();
+}
+
+GraphicsCommandLogRecords
+GraphicsCommandLog::getRecords() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _records;
+}
+
+GraphicsCommandLogCounter
+GraphicsCommandLog::getCounter() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _counter;
+}
+
+void
+GraphicsCommandLog::save(std::ostream& stream) const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (auto& it : _records)
+	{
+		stream << getTypeName(it.type);
+		for (std::size_t i = 0; i < 4; i++)
+			stream << ' ' << it.args[i];
+		stream << std::endl;
+	}
+}
+
+const char*
+GraphicsCommandLog::getTypeName(GraphicsCommandLogType type) noexcept
+{
+	switch (type)
+	{
+	case GraphicsCommandLogType::GraphicsCommandLogTypeCreateBuffer:          return "CreateBuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeCreateTexture:         return "CreateTexture";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeCreateProgram:         return "CreateProgram";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeCreatePipeline:        return "CreatePipeline";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeCreateFramebuffer:     return "CreateFramebuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeCreateDescriptorSet:   return "CreateDescriptorSet";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeUploadBuffer:          return "UploadBuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeUploadTexture:         return "UploadTexture";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeUploadUniform:         return "UploadUniform";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeGenerateMipmap:        return "GenerateMipmap";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetViewport:           return "SetViewport";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetScissor:            return "SetScissor";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilCompareMask: return "SetStencilCompareMask";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilReference:   return "SetStencilReference";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetStencilWriteMask:   return "SetStencilWriteMask";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetPipeline:           return "SetPipeline";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetDescriptorSet:      return "SetDescriptorSet";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetVertexBuffer:       return "SetVertexBuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetIndexBuffer:        return "SetIndexBuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeSetFramebuffer:        return "SetFramebuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeClearFramebuffer:      return "ClearFramebuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDiscardFramebuffer:    return "DiscardFramebuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeBlitFramebuffer:       return "BlitFramebuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeReadFramebuffer:       return "ReadFramebuffer";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDraw:                  return "Draw";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndexed:           return "DrawIndexed";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndirect:          return "DrawIndirect";
+	case GraphicsCommandLogType::GraphicsCommandLogTypeDrawIndexedIndirect:   return "DrawIndexedIndirect";
+	case GraphicsCommandLogType::GraphicsCommandLogTypePresent:               return "Present";
+	default:
+		return "Unknown";
+	}
+}
+
+_NAME_END
@@ -41,11 +41,13 @@ _NAME_BEGIN
 __ImplementSubInterface(GraphicsContext, GraphicsChild, "GraphicsContext")
 
 GraphicsContextDesc::GraphicsContextDesc() noexcept
+	: _uniformStreamSize(4 * 1024 * 1024)
 {
 }
 
 GraphicsContextDesc::GraphicsContextDesc(GraphicsSwapchainPtr swapchain) noexcept
-	: _swapchain(swapchain)
+	: _uniformStreamSize(4 * 1024 * 1024)
+	, _swapchain(swapchain)
 {
 }
 
@@ -65,6 +67,18 @@ GraphicsContextDesc::getSwapchain() const noexcept
 	return _swapchain;
 }
 
+void
+GraphicsContextDesc::setUniformStreamSize(std::uint32_t size) noexcept
+{
+	_uniformStreamSize = size;
+}
+
+std::uint32_t
+GraphicsContextDesc::getUniformStreamSize() const noexcept
+{
+	return _uniformStreamSize;
+}
+
 GraphicsContext::GraphicsContext() noexcept
 {
 }
@@ -49,6 +49,9 @@
 #   include "Vulkan/vk_system.h"
 #	include "Vulkan/vk_device.h"
 #endif
+#if defined(_BUILD_NULL)
+#	include "Null/null_device.h"
+#endif
 
 _NAME_BEGIN
 
@@ -201,6 +204,19 @@ GraphicsSystem::createDevice(const GraphicsDeviceDesc& deviceDesc) noexcept
 		return nullptr;
 	}
 #endif
+#if defined(_BUILD_NULL)
+	if (deviceType == GraphicsDeviceType::GraphicsDeviceTypeNull)
+	{
+		auto device = std::make_shared<NullDevice>();
+		if (device->setup(deviceDesc))
+		{
+			_devices.push_back(device);
+			return device;
+		}
+
+		return nullptr;
+	}
+#endif
 	return nullptr;
 }
 
@@ -40,6 +40,7 @@ _NAME_BEGIN
 
 GraphicsVariant::GraphicsVariant() noexcept
 	: _type(GraphicsUniformType::GraphicsUniformTypeNone)
+	, _version(0)
 {
 	std::memset(&_value, 0, sizeof(_value));
 }
@@ -54,172 +55,142 @@ GraphicsVariant::setType(GraphicsUniformType type) noexcept
 {
 	if (_type != type)
 	{
-		if (_type == GraphicsUniformType::GraphicsUniformTypeIntArray)
+		switch (_type)
 		{
+		case GraphicsUniformType::GraphicsUniformTypeIntArray:
 			delete _value.iarray;
-			_value.iarray = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeInt2Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeInt2Array:
 			delete _value.iarray2;
-			_value.iarray2 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeInt3Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeInt3Array:
 			delete _value.iarray3;
-			_value.iarray3 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeInt4Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeInt4Array:
 			delete _value.iarray4;
-			_value.iarray4 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeUIntArray)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUIntArray:
 			delete _value.uiarray;
-			_value.uiarray = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeUInt2Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUInt2Array:
 			delete _value.uiarray2;
-			_value.uiarray2 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeUInt3Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUInt3Array:
 			delete _value.uiarray3;
-			_value.uiarray3 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeUInt4Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUInt4Array:
 			delete _value.uiarray4;
-			_value.uiarray4 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloatArray)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloatArray:
 			delete _value.farray;
-			_value.farray = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat2Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat2Array:
 			delete _value.farray2;
-			_value.farray2 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat3Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat3Array:
 			delete _value.farray3;
-			_value.farray3 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat4Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat4Array:
 			delete _value.farray4;
-			_value.farray4 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2)
-		{
-			delete _value.m2;
-			_value.m2 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3)
-		{
-			delete _value.m3;
-			_value.m3 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4)
-		{
-			delete _value.m4;
-			_value.m4 = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat2x2Array:
 			delete _value.m2array;
-			_value.m2array = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat3x3Array:
 			delete _value.m3array;
-			_value.m3array = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4Array)
-		{
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat4x4Array:
 			delete _value.m4array;
-			_value.m4array = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer)
-		{
-			delete _value.ubo;
-			_value.ubo = nullptr;
-		}
-		else if (_type == GraphicsUniformType::GraphicsUniformTypeSamplerImage ||
-			_type == GraphicsUniformType::GraphicsUniformTypeStorageImage ||
-			_type == GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler)
-		{
-			if (type != GraphicsUniformType::GraphicsUniformTypeSamplerImage ||
-				type != GraphicsUniformType::GraphicsUniformTypeStorageImage ||
-				type != GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler)
-			{
-				delete _value.texture;
-				_value.texture = nullptr;
-			}
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeSampler:
+		case GraphicsUniformType::GraphicsUniformTypeSamplerImage:
+		case GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler:
+		case GraphicsUniformType::GraphicsUniformTypeStorageImage:
+			delete _value.texture;
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeStorageTexelBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeStorageBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeStorageBufferDynamic:
+		case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
+			delete _value.buffer;
+			break;
+		default:
+			break;
 		}
 
-		if (type == GraphicsUniformType::GraphicsUniformTypeIntArray)
+		std::memset(&_value, 0, sizeof(_value));
+
+		switch (type)
+		{
+		case GraphicsUniformType::GraphicsUniformTypeIntArray:
 			_value.iarray = new std::vector<int1>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeInt2Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeInt2Array:
 			_value.iarray2 = new std::vector<int2>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeInt3Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeInt3Array:
 			_value.iarray3 = new std::vector<int3>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeInt4Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeInt4Array:
 			_value.iarray4 = new std::vector<int4>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeUIntArray)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUIntArray:
 			_value.uiarray = new std::vector<uint1>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeUInt2Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUInt2Array:
 			_value.uiarray2 = new std::vector<uint2>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeUInt3Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUInt3Array:
 			_value.uiarray3 = new std::vector<uint3>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeUInt4Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeUInt4Array:
 			_value.uiarray4 = new std::vector<uint4>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloatArray)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloatArray:
 			_value.farray = new std::vector<float1>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat2Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat2Array:
 			_value.farray2 = new std::vector<float2>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat3Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat3Array:
 			_value.farray3 = new std::vector<float3>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat4Array)
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat4Array:
 			_value.farray4 = new std::vector<float4>();
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat2x2)
-			_value.m2 = new float2x2;
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat3x3)
-			_value.m3 = new float3x3;
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat4x4)
-			_value.m4 = new float4x4;
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat3x3Array)
-			_value.m3array = new std::vector<float3x3>;
-		else if (type == GraphicsUniformType::GraphicsUniformTypeFloat4x4Array)
-			_value.m4array = new std::vector<float4x4>;
-		else if (type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer)
-			_value.ubo = new GraphicsDataPtr;
-		else if (type == GraphicsUniformType::GraphicsUniformTypeSamplerImage ||
-			type == GraphicsUniformType::GraphicsUniformTypeStorageImage ||
-			type == GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler)
-		{
-			if (_type != GraphicsUniformType::GraphicsUniformTypeSamplerImage ||
-				_type != GraphicsUniformType::GraphicsUniformTypeStorageImage ||
-				_type != GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler)
-			{
-				_value.texture = new TexturePack;
-			}
-			else
-			{
-				_value.texture->image = nullptr;
-				_value.texture->sampler = nullptr;
-			}
-		}
-		else
-		{
-			std::memset(&_value, 0, sizeof(_value));
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat2x2Array:
+			_value.m2array = new std::vector<float2x2>();
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat3x3Array:
+			_value.m3array = new std::vector<float3x3>();
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeFloat4x4Array:
+			_value.m4array = new std::vector<float4x4>();
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeSampler:
+		case GraphicsUniformType::GraphicsUniformTypeSamplerImage:
+		case GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler:
+		case GraphicsUniformType::GraphicsUniformTypeStorageImage:
+			_value.texture = new TexturePack;
+			break;
+		case GraphicsUniformType::GraphicsUniformTypeStorageTexelBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeStorageBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeStorageBufferDynamic:
+		case GraphicsUniformType::GraphicsUniformTypeUniformTexelBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
+		case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
+			_value.buffer = new BufferPack;
+			_value.buffer->offset = 0;
+			_value.buffer->size = 0;
+			break;
+		default:
+			break;
 		}
 
 		_type = type;
+		_version++;
 	}
 }
 
@@ -234,6 +205,7 @@ GraphicsVariant::uniform1b(bool b1) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeBool);
 	_value.b = b1;
+	_version++;
 }
 
 void
@@ -241,6 +213,7 @@ GraphicsVariant::uniform1i(std::int32_t i1) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt);
 	_value.i[0] = i1;
+	_version++;
 }
 
 void
@@ -249,6 +222,7 @@ GraphicsVariant::uniform2i(const int2& value) noexcept
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt2);
 	_value.i[0] = value.x;
 	_value.i[1] = value.y;
+	_version++;
 }
 
 void
@@ -257,6 +231,7 @@ GraphicsVariant::uniform2i(std::int32_t i1, std::int32_t i2) noexcept
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt2);
 	_value.i[0] = i1;
 	_value.i[1] = i2;
+	_version++;
 }
 
 void
@@ -266,6 +241,7 @@ GraphicsVariant::uniform3i(const int3& value) noexcept
 	_value.i[0] = value.x;
 	_value.i[1] = value.y;
 	_value.i[2] = value.z;
+	_version++;
 }
 
 void
@@ -275,6 +251,7 @@ GraphicsVariant::uniform3i(std::int32_t i1, std::int32_t i2, std::int32_t i3) no
 	_value.i[0] = i1;
 	_value.i[1] = i2;
 	_value.i[2] = i3;
+	_version++;
 }
 
 void
@@ -285,6 +262,7 @@ GraphicsVariant::uniform4i(const int4& value) noexcept
 	_value.i[1] = value.y;
 	_value.i[2] = value.z;
 	_value.i[3] = value.w;
+	_version++;
 }
 
 void
@@ -295,13 +273,15 @@ GraphicsVariant::uniform4i(std::int32_t i1, std::int32_t i2, std::int32_t i3, st
 	_value.i[1] = i2;
 	_value.i[2] = i3;
 	_value.i[3] = i4;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform1ui(std::uint32_t ui1) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt);
 	_value.ui[0] = ui1;
+	_version++;
 }
 
 void
@@ -310,14 +290,16 @@ GraphicsVariant::uniform2ui(const uint2& value) noexcept
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt2);
 	_value.ui[0] = value.x;
 	_value.ui[1] = value.y;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform2ui(std::uint32_t ui1, std::uint32_t ui2) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt2);
 	_value.ui[0] = ui1;
 	_value.ui[1] = ui2;
+	_version++;
 }
 
 void
@@ -327,15 +309,17 @@ GraphicsVariant::uniform3ui(const uint3& value) noexcept
 	_value.ui[0] = value.x;
 	_value.ui[1] = value.y;
 	_value.ui[2] = value.z;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform3ui(std::uint32_t ui1, std::uint32_t ui2, std::uint32_t ui3) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt3);
 	_value.ui[0] = ui1;
 	_value.ui[1] = ui2;
 	_value.ui[2] = ui3;
+	_version++;
 }
 
 void
@@ -346,6 +330,7 @@ GraphicsVariant::uniform4ui(const uint4& value) noexcept
 	_value.ui[1] = value.y;
 	_value.ui[2] = value.z;
 	_value.ui[3] = value.w;
+	_version++;
 }
 
 void
@@ -356,6 +341,7 @@ GraphicsVariant::uniform4ui(std::uint32_t ui1, std::uint32_t ui2, std::uint32_t
 	_value.ui[1] = ui2;
 	_value.ui[2] = ui3;
 	_value.ui[3] = ui4;
+	_version++;
 }
 
 void
@@ -363,6 +349,7 @@ GraphicsVariant::uniform1f(float f1) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat);
 	_value.f[0] = f1;
+	_version++;
 }
 
 void
@@ -371,6 +358,7 @@ GraphicsVariant::uniform2f(const float2& value) noexcept
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2);
 	_value.f[0] = value.x;
 	_value.f[1] = value.y;
+	_version++;
 }
 
 void
@@ -379,6 +367,7 @@ GraphicsVariant::uniform2f(float f1, float f2) noexcept
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2);
 	_value.f[0] = f1;
 	_value.f[1] = f2;
+	_version++;
 }
 
 void
@@ -388,6 +377,7 @@ GraphicsVariant::uniform3f(const float3& value) noexcept
 	_value.f[0] = value.x;
 	_value.f[1] = value.y;
 	_value.f[2] = value.z;
+	_version++;
 }
 
 void
@@ -397,6 +387,7 @@ GraphicsVariant::uniform3f(float f1, float f2, float f3) noexcept
 	_value.f[0] = f1;
 	_value.f[1] = f2;
 	_value.f[2] = f3;
+	_version++;
 }
 
 void
@@ -407,6 +398,7 @@ GraphicsVariant::uniform4f(const float4& value) noexcept
 	_value.f[1] = value.y;
 	_value.f[2] = value.z;
 	_value.f[3] = value.w;
+	_version++;
 }
 
 void
@@ -417,47 +409,55 @@ GraphicsVariant::uniform4f(float f1, float f2, float f3, float f4) noexcept
 	_value.f[1] = f2;
 	_value.f[2] = f3;
 	_value.f[3] = f4;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform2fmat(const float2x2& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2);
-	*_value.m2 = value;
+	std::memcpy(_value.f, &value, sizeof(float2x2));
+	_version++;
 }
 
 void
 GraphicsVariant::uniform2fmat(const float* mat2) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2);
-	std::memcpy(_value.m2, mat2, sizeof(float2x2));
+	std::memcpy(_value.f, mat2, sizeof(float2x2));
+	_version++;
 }
 
 void
 GraphicsVariant::uniform3fmat(const float3x3& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3);
-	*_value.m3 = value;
+	std::memcpy(_value.f, &value, sizeof(float3x3));
+	_version++;
 }
 
 void
 GraphicsVariant::uniform3fmat(const float* mat3) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3);
-	std::memcpy(_value.m3, mat3, sizeof(float3x3));
+	std::memcpy(_value.f, mat3, sizeof(float3x3));
+	_version++;
 }
 
 void
 GraphicsVariant::uniform4fmat(const float4x4& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4);
-	*_value.m4 = value;
+	std::memcpy(_value.f, &value, sizeof(float4x4));
+	_version++;
 }
+
 void
 GraphicsVariant::uniform4fmat(const float* mat4) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4);
-	std::memcpy(_value.m4, mat4, sizeof(float4x4));
+	std::memcpy(_value.f, mat4, sizeof(float4x4));
+	_version++;
 }
 
 void
@@ -465,14 +465,15 @@ GraphicsVariant::uniform1iv(const std::vector<int1>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeIntArray);
 	*_value.iarray = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform1iv(std::size_t num, const std::int32_t* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeIntArray);
-	_value.iarray->resize(num);
-	std::memcpy(_value.iarray->data(), str, sizeof(int1) * num);
+	_value.iarray->assign(str, str + num);
+	_version++;
 }
 
 void
@@ -480,6 +481,7 @@ GraphicsVariant::uniform2iv(const std::vector<int2>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt2Array);
 	*_value.iarray2 = value;
+	_version++;
 }
 
 void
@@ -487,7 +489,9 @@ GraphicsVariant::uniform2iv(std::size_t num, const std::int32_t* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt2Array);
 	_value.iarray2->resize(num);
-	std::memcpy(_value.iarray2->data(), str, sizeof(int2) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.iarray2)[i] = int2(str[i * 2], str[i * 2 + 1]);
+	_version++;
 }
 
 void
@@ -495,14 +499,17 @@ GraphicsVariant::uniform3iv(const std::vector<int3>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt3Array);
 	*_value.iarray3 = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform3iv(std::size_t num, const std::int32_t* str) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt2Array);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt3Array);
 	_value.iarray3->resize(num);
-	std::memcpy(_value.iarray3->data(), str, sizeof(int3) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.iarray3)[i] = int3(str[i * 3], str[i * 3 + 1], str[i * 3 + 2]);
+	_version++;
 }
 
 void
@@ -510,14 +517,17 @@ GraphicsVariant::uniform4iv(const std::vector<int4>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt4Array);
 	*_value.iarray4 = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform4iv(std::size_t num, const std::int32_t* str) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt2Array);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeInt4Array);
 	_value.iarray4->resize(num);
-	std::memcpy(_value.iarray4->data(), str, sizeof(int4) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.iarray4)[i] = int4(str[i * 4], str[i * 4 + 1], str[i * 4 + 2], str[i * 4 + 3]);
+	_version++;
 }
 
 void
@@ -525,14 +535,15 @@ GraphicsVariant::uniform1uiv(const std::vector<uint1>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUIntArray);
 	*_value.uiarray = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform1uiv(std::size_t num, const std::uint32_t* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUIntArray);
-	_value.uiarray->resize(num);
-	std::memcpy(_value.uiarray->data(), str, sizeof(uint1) * num);
+	_value.uiarray->assign(str, str + num);
+	_version++;
 }
 
 void
@@ -540,6 +551,7 @@ GraphicsVariant::uniform2uiv(const std::vector<uint2>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt2Array);
 	*_value.uiarray2 = value;
+	_version++;
 }
 
 void
@@ -547,7 +559,9 @@ GraphicsVariant::uniform2uiv(std::size_t num, const std::uint32_t* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt2Array);
 	_value.uiarray2->resize(num);
-	std::memcpy(_value.uiarray2->data(), str, sizeof(uint2) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.uiarray2)[i] = uint2(str[i * 2], str[i * 2 + 1]);
+	_version++;
 }
 
 void
@@ -555,6 +569,7 @@ GraphicsVariant::uniform3uiv(const std::vector<uint3>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt3Array);
 	*_value.uiarray3 = value;
+	_version++;
 }
 
 void
@@ -562,7 +577,9 @@ GraphicsVariant::uniform3uiv(std::size_t num, const std::uint32_t* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt3Array);
 	_value.uiarray3->resize(num);
-	std::memcpy(_value.uiarray3->data(), str, sizeof(uint3) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.uiarray3)[i] = uint3(str[i * 3], str[i * 3 + 1], str[i * 3 + 2]);
+	_version++;
 }
 
 void
@@ -570,6 +587,7 @@ GraphicsVariant::uniform4uiv(const std::vector<uint4>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt4Array);
 	*_value.uiarray4 = value;
+	_version++;
 }
 
 void
@@ -577,7 +595,9 @@ GraphicsVariant::uniform4uiv(std::size_t num, const std::uint32_t* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUInt4Array);
 	_value.uiarray4->resize(num);
-	std::memcpy(_value.uiarray4->data(), str, sizeof(uint4) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.uiarray4)[i] = uint4(str[i * 4], str[i * 4 + 1], str[i * 4 + 2], str[i * 4 + 3]);
+	_version++;
 }
 
 void
@@ -585,14 +605,15 @@ GraphicsVariant::uniform1fv(const std::vector<float1>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloatArray);
 	*_value.farray = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform1fv(std::size_t num, const float* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloatArray);
-	_value.farray->resize(num);
-	std::memcpy(_value.farray->data(), str, sizeof(float1) * num);
+	_value.farray->assign(str, str + num);
+	_version++;
 }
 
 void
@@ -600,6 +621,7 @@ GraphicsVariant::uniform2fv(const std::vector<float2>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2Array);
 	*_value.farray2 = value;
+	_version++;
 }
 
 void
@@ -607,7 +629,9 @@ GraphicsVariant::uniform2fv(std::size_t num, const float* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2Array);
 	_value.farray2->resize(num);
-	std::memcpy(_value.farray2->data(), str, sizeof(float2) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.farray2)[i] = float2(str[i * 2], str[i * 2 + 1]);
+	_version++;
 }
 
 void
@@ -615,6 +639,7 @@ GraphicsVariant::uniform3fv(const std::vector<float3>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3Array);
 	*_value.farray3 = value;
+	_version++;
 }
 
 void
@@ -622,7 +647,9 @@ GraphicsVariant::uniform3fv(std::size_t num, const float* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3Array);
 	_value.farray3->resize(num);
-	std::memcpy(_value.farray3->data(), str, sizeof(float3) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.farray3)[i] = float3(str[i * 3], str[i * 3 + 1], str[i * 3 + 2]);
+	_version++;
 }
 
 void
@@ -630,6 +657,7 @@ GraphicsVariant::uniform4fv(const std::vector<float4>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4Array);
 	*_value.farray4 = value;
+	_version++;
 }
 
 void
@@ -637,7 +665,9 @@ GraphicsVariant::uniform4fv(std::size_t num, const float* str) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4Array);
 	_value.farray4->resize(num);
-	std::memcpy(_value.farray4->data(), str, sizeof(float4) * num);
+	for (std::size_t i = 0; i < num; i++)
+		(*_value.farray4)[i] = float4(str[i * 4], str[i * 4 + 1], str[i * 4 + 2], str[i * 4 + 3]);
+	_version++;
 }
 
 void
@@ -645,14 +675,20 @@ GraphicsVariant::uniform2fmatv(const std::vector<float2x2>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2Array);
 	*_value.m2array = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform2fmatv(std::size_t num, const float* mat2) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4Array);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2Array);
 	_value.m2array->resize(num);
-	std::memcpy(_value.m2array->data(), mat2, sizeof(float2x2) * num);
+	for (std::size_t i = 0; i < num; i++)
+	{
+		auto m = mat2 + i * 4;
+		(*_value.m2array)[i] = float2x2(m[0], m[1], m[2], m[3]);
+	}
+	_version++;
 }
 
 void
@@ -660,14 +696,20 @@ GraphicsVariant::uniform3fmatv(const std::vector<float3x3>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3Array);
 	*_value.m3array = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform3fmatv(std::size_t num, const float* mat3) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4Array);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3Array);
 	_value.m3array->resize(num);
-	std::memcpy(_value.m3array->data(), mat3, sizeof(float3x3) * num);
+	for (std::size_t i = 0; i < num; i++)
+	{
+		auto m = mat3 + i * 9;
+		(*_value.m3array)[i] = float3x3(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+	}
+	_version++;
 }
 
 void
@@ -675,14 +717,20 @@ GraphicsVariant::uniform4fmatv(const std::vector<float4x4>& value) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4Array);
 	*_value.m4array = value;
+	_version++;
 }
 
 void
 GraphicsVariant::uniform4fmatv(std::size_t num, const float* mat4) noexcept
 {
-	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4Array);
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4Array);
 	_value.m4array->resize(num);
-	std::memcpy(_value.m4array->data(), mat4, sizeof(float4x4) * num);
+	for (std::size_t i = 0; i < num; i++)
+	{
+		auto m = mat4 + i * 16;
+		(*_value.m4array)[i] = float4x4(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8], m[9], m[10], m[11], m[12], m[13], m[14], m[15]);
+	}
+	_version++;
 }
 
 void
@@ -691,13 +739,27 @@ GraphicsVariant::uniformTexture(GraphicsTexturePtr texture, GraphicsSamplerPtr s
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeStorageImage || _type == GraphicsUniformType::GraphicsUniformTypeCombinedImageSampler || _type == GraphicsUniformType::GraphicsUniformTypeSamplerImage);
 	_value.texture->image = texture;
 	_value.texture->sampler = sampler;
+	_version++;
 }
 
 void
 GraphicsVariant::uniformBuffer(GraphicsDataPtr ubo) noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
-	*_value.ubo = ubo;
+	_value.buffer->data = ubo;
+	_value.buffer->offset = 0;
+	_value.buffer->size = 0;
+	_version++;
+}
+
+void
+GraphicsVariant::uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept
+{
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
+	_value.buffer->data = ubo;
+	_value.buffer->offset = offset;
+	_value.buffer->size = size;
+	_version++;
 }
 
 bool
@@ -795,21 +857,21 @@ const float2x2&
 GraphicsVariant::getFloat2x2() const noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat2x2);
-	return (float2x2&)*_value.m2;
+	return (float2x2&)_value.f;
 }
 
 const float3x3&
 GraphicsVariant::getFloat3x3() const noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat3x3);
-	return (float3x3&)*_value.m3;
+	return (float3x3&)_value.f;
 }
 
 const float4x4&
 GraphicsVariant::getFloat4x4() const noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeFloat4x4);
-	return (float4x4&)*_value.m4;
+	return (float4x4&)_value.f;
 }
 
 const std::vector<int1>&
@@ -935,7 +997,27 @@ const GraphicsDataPtr&
 GraphicsVariant::getBuffer() const noexcept
 {
 	assert(_type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
-	return *_value.ubo;
+	return _value.buffer->data;
+}
+
+std::uint32_t
+GraphicsVariant::getBufferOffset() const noexcept
+{
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
+	return _value.buffer->offset;
+}
+
+std::uint32_t
+GraphicsVariant::getBufferSize() const noexcept
+{
+	assert(_type == GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
+	return _value.buffer->size;
+}
+
+std::uint32_t
+GraphicsVariant::getVersion() const noexcept
+{
+	return _version;
 }
 
 _NAME_END
\ No newline at end of file
@@ -124,6 +124,7 @@ AnimationProperty::AnimationProperty() noexcept
 	: _frame(0)
 	, _fps(30)
 	, _delta(0)
+	, _pose(std::make_shared<AnimationPose>())
 {
 }
 
@@ -241,6 +242,25 @@ AnimationProperty::getIKArray() const noexcept
 	return _iks;
 }
 
+const AnimationPosePtr&
+AnimationProperty::getPose() const noexcept
+{
+	return _pose;
+}
+
+void
+AnimationProperty::setClip(const AnimationClipPtr& clip) noexcept
+{
+	_clip = clip;
+	this->updateBones(_bones);
+}
+
+const AnimationClipPtr&
+AnimationProperty::getClip() const noexcept
+{
+	return _clip;
+}
+
 AnimationPropertyPtr
 AnimationProperty::clone() noexcept
 {
@@ -249,6 +269,7 @@ AnimationProperty::clone() noexcept
 	anim->_boneAnimation = this->_boneAnimation;
 	anim->_morphAnimation = this->_morphAnimation;
 	anim->_frame = this->_frame;
+	anim->_clip = this->_clip;
 	return anim;
 }
 
@@ -275,9 +296,25 @@ AnimationProperty::updateMotion() noexcept
 void
 AnimationProperty::updateBones(const Bones& bones) noexcept
 {
+	_pose->setBoneArray(bones);
+
+	_motionKeys.clear();
+	_motionTracks.clear();
+	_motionCurves.clear();
+	_clipTracks.clear();
+	_clipCursors.clear();
+
 	if (bones.empty())
+		return;
+
+	if (_clip)
 	{
-		_bindAnimation.clear();
+		_clipTracks.resize(bones.size());
+		_clipCursors.resize(bones.size(), 0);
+
+		for (std::size_t i = 0; i < bones.size(); i++)
+			_clipTracks[i] = _clip->findTrack(bones[i].getName());
+
 		return;
 	}
 
@@ -287,23 +324,45 @@ AnimationProperty::updateBones(const Bones& bones) noexcept
 		bindBoneMaps[bones[i].getName()] = i + 1;
 	}
 
-	std::size_t numFrame = 0;
-	std::size_t numAnimation = this->getNumBoneAnimation();
+	std::vector<std::vector<std::size_t>> bindAnimation(bones.size());
 
+	std::size_t numAnimation = this->getNumBoneAnimation();
 	for (std::size_t i = 0; i < numAnimation; i++)
 	{
-		numFrame = std::max((std::int32_t)numFrame, _boneAnimation[i].getFrameNo());
+		auto it = bindBoneMaps.find(_boneAnimation[i].getName());
+		if (it != bindBoneMaps.end())
+			bindAnimation[it->second - 1].push_back(i);
 	}
 
-	_bindAnimation.resize(bones.size());
+	std::map<std::uint32_t, std::uint32_t> curves;
 
-	for (std::size_t i = 0; i < numAnimation; i++)
+	_motionTracks.resize(bones.size());
+
+	for (std::size_t i = 0; i < bones.size(); i++)
 	{
-		auto& name = _boneAnimation[i].getName();
-		auto& bone = bindBoneMaps[name];
-		if (bone > 0)
+		auto& motions = bindAnimation[i];
+		std::stable_sort(motions.begin(), motions.end(), [&](std::size_t a, std::size_t b) { return _boneAnimation[a].getFrameNo() < _boneAnimation[b].getFrameNo(); });
+
+		auto& track = _motionTracks[i];
+		track.offset = _motionKeys.size();
+		track.count = motions.size();
+		track.cursor = 0;
+
+		for (auto& motion : motions)
 		{
-			_bindAnimation[bone - 1].push_back(i);
+			auto& anim = _boneAnimation[motion];
+			auto& interp = anim.getInterpolation();
+
+			MotionKey key;
+			key.frame = anim.getFrameNo();
+			key.position = anim.getPosition();
+			key.rotation = anim.getRotation();
+			key.curves[0] = this->bakeMotionCurve(interp.interpX, curves);
+			key.curves[1] = this->bakeMotionCurve(interp.interpY, curves);
+			key.curves[2] = this->bakeMotionCurve(interp.interpZ, curves);
+			key.curves[3] = this->bakeMotionCurve(interp.interpW, curves);
+
+			_motionKeys.push_back(key);
 		}
 	}
 }
@@ -312,38 +371,41 @@ bool
 AnimationProperty::updateBoneMotion(std::size_t index) noexcept
 {
 	auto& bone = _bones[index];
-	const auto& motion = _bindAnimation[index];
-	if (motion.empty())
-	{
-		bone.setRotation(Quaternion::Zero);
 
-		if (bone.getParent() != (-1))
+	bool hasMotion = false;
+
+	Vector3 position;
+	Quaternion rotate;
+
+	if (_clip)
+	{
+		if (_clipTracks[index] >= 0)
 		{
-			auto& parent = _bones[bone.getParent()];
-			auto position = (bone.getPosition() - parent.getPosition());
-			float4x4 m;
-			m.makeTranslate(position);
-			bone.setLocalTransform(m);
+			_clip->sample(_clipTracks[index], _frame, _clipCursors[index], position, rotate);
+			hasMotion = true;
 		}
+	}
+	else if (_motionTracks[index].count > 0)
+	{
+		this->sampleMotion(_motionTracks[index], _frame, position, rotate);
+		hasMotion = true;
+	}
+
+	if (!hasMotion)
+	{
+		if (bone.getParent() != (-1))
+			_pose->setLocalTransform(index, bone.getPosition() - _bones[bone.getParent()].getPosition(), Quaternion::Zero);
 		else
-		{
-			float4x4 m;
-			m.makeTranslate(bone.getPosition());
-			bone.setLocalTransform(m);
-		}
+			_pose->setLocalTransform(index, bone.getPosition(), Quaternion::Zero);
 
 		return false;
 	}
 	else
 	{
-		Vector3 position;
-		Quaternion rotate;
-		this->interpolateMotion(rotate, position, motion, _frame);
-
 		if (bone.getParent() == (-1))
-			updateTransform(bone, bone.getPosition() + position, rotate);
+			_pose->setLocalTransform(index, bone.getPosition() + position, rotate);
 		else
-			updateTransform(bone, bone.getPosition() + position - _bones[bone.getParent()].getPosition(), rotate);
+			_pose->setLocalTransform(index, bone.getPosition() + position - _bones[bone.getParent()].getPosition(), rotate);
 
 		return true;
 	}
@@ -359,59 +421,39 @@ AnimationProperty::updateBoneMotion() noexcept
 void
 AnimationProperty::updateBoneMatrix() noexcept
 {
-	std::size_t size = _bones.size();
-	for (std::size_t i = 0; i < size; i++)
-	{
-		std::intptr_t  parent = _bones[i].getParent();
-		if ((std::size_t)parent > size)
-			_bones[i].setTransform(_bones[i].getLocalTransform());
-		else
-			_bones[i].setTransform(math::transformMultiply(_bones[parent].getTransform(), _bones[i].getLocalTransform()));
-	}
+	_pose->updateWorldTransforms();
 }
 
 void
-AnimationProperty::updateBoneMatrix(Bone& bone) noexcept
+AnimationProperty::updateBoneMatrix(std::size_t index) noexcept
 {
-	if (bone.getParent() != (-1))
-	{
-		auto& parent = _bones.at(bone.getParent());
-		updateBoneMatrix(parent);
-		bone.setTransform(math::transformMultiply(parent.getTransform(), bone.getLocalTransform()));
-	}
-	else
-	{
-		bone.setTransform(bone.getLocalTransform());
-	}
+	_pose->updateWorldTransform(index);
 }
 
 void
 AnimationProperty::updateIK() noexcept
 {
 	for (auto& ik : _iks)
-		this->updateIK(_bones, ik);
+		this->updateIK(ik);
 }
 
 void
-AnimationProperty::updateIK(Bones& bones, const IKAttr& ik) noexcept
+AnimationProperty::updateIK(const IKAttr& ik) noexcept
 {
-	auto& effector = bones.at(ik.boneIndex);
-	auto& target = bones.at(ik.targetBoneIndex);
-
-	const Vector3& effectPos = effector.getTransform().getTranslate();
+	const Vector3& effectPos = _pose->getWorldTransform(ik.boneIndex).getTranslate();
 
 	for (std::uint32_t i = 0; i < ik.iterations; i++)
 	{
 		for (std::uint32_t j = 0; j < ik.chainLength; j++)
 		{
-			auto& bone = bones[ik.child[j].boneIndex];
+			std::size_t bone = ik.child[j].boneIndex;
 
-			Vector3 targetPos = target.getTransform().getTranslate();
+			Vector3 targetPos = _pose->getWorldTransform(ik.targetBoneIndex).getTranslate();
 			if (math::distance(effectPos, targetPos) < EPSILON)
 				return;
 
-			Vector3 dstLocal = math::invTranslateVector3(bone.getTransform(), targetPos);
-			Vector3 srcLocal = math::invTranslateVector3(bone.getTransform(), effectPos);
+			Vector3 dstLocal = math::invTranslateVector3(_pose->getWorldTransform(bone), targetPos);
+			Vector3 srcLocal = math::invTranslateVector3(_pose->getWorldTransform(bone), effectPos);
 
 			srcLocal = math::normalize(srcLocal);
 			dstLocal = math::normalize(dstLocal);
@@ -440,25 +482,14 @@ AnimationProperty::updateIK(Bones& bones, const IKAttr& ik) noexcept
 				q0.makeRotate(euler);
 			}
 
-			Quaternion qq = math::cross(bone.getRotation(), q0);
-			updateTransform(bone, bone.getLocalTransform().getTranslate(), qq);
+			Quaternion qq = math::cross(_pose->getLocalRotation(bone), q0);
+			_pose->setLocalRotation(bone, qq);
 
-			this->updateBoneMatrix(target);
+			this->updateBoneMatrix(ik.targetBoneIndex);
 		}
 	}
 }
 
-void
-AnimationProperty::updateTransform(Bone& bone, const float3& translate, const Quaternion& rotate) noexcept
-{
-	float4x4 transform;
-	transform.makeRotate(rotate);
-	transform.setTranslate(translate);
-
-	bone.setRotation(rotate);
-	bone.setLocalTransform(transform);
-}
-
 MotionSegment
 AnimationProperty::findMotionSegment(int frame, const std::vector<std::size_t>& motions) noexcept
 {
@@ -579,4 +610,83 @@ AnimationProperty::interpolateMotion(Quaternion& rotation, Vector3& position, co
 	}
 }
 
+std::uint32_t
+AnimationProperty::bakeMotionCurve(const std::uint8_t interp[4], std::map<std::uint32_t, std::uint32_t>& curves) noexcept
+{
+	std::uint32_t hash = interp[0] | interp[1] << 8 | interp[2] << 16 | interp[3] << 24;
+
+	auto it = curves.find(hash);
+	if (it != curves.end())
+		return it->second;
+
+	std::uint32_t curve = static_cast<std::uint32_t>(curves.size());
+	curves[hash] = curve;
+
+	_motionCurves.resize(_motionCurves.size() + AnimationClip::CurveSamples * 2);
+
+	float* xs = _motionCurves.data() + curve * AnimationClip::CurveSamples * 2;
+	AnimationClip::bakeCurve(interp, xs, xs + AnimationClip::CurveSamples);
+
+	return curve;
+}
+
+float
+AnimationProperty::sampleMotionCurve(std::uint32_t curve, float t) const noexcept
+{
+	const float* xs = _motionCurves.data() + curve * AnimationClip::CurveSamples * 2;
+	return AnimationClip::sampleCurve(xs, xs + AnimationClip::CurveSamples, t);
+}
+
+std::size_t
+AnimationProperty::findMotionKey(MotionTrack& track, std::int32_t frame) noexcept
+{
+	const MotionKey* keys = _motionKeys.data() + track.offset;
+
+	std::size_t cursor = track.cursor;
+	if (keys[cursor].frame > frame)
+	{
+		cursor = std::upper_bound(keys, keys + track.count, frame, [](std::int32_t f, const MotionKey& key) { return f < key.frame; }) - keys;
+		cursor = cursor > 0 ? cursor - 1 : 0;
+	}
+	else if (cursor + 1 < track.count && keys[cursor + 1].frame <= frame)
+	{
+		cursor++;
+
+		// playback steps at most a key per update, anything further is a seek
+		if (cursor + 1 < track.count && keys[cursor + 1].frame <= frame)
+			cursor = std::upper_bound(keys + cursor + 1, keys + track.count, frame, [](std::int32_t f, const MotionKey& key) { return f < key.frame; }) - keys - 1;
+	}
+
+	track.cursor = cursor;
+	return cursor;
+}
+
+void
+AnimationProperty::sampleMotion(MotionTrack& track, std::int32_t frame, Vector3& position, Quaternion& rotation) noexcept
+{
+	std::size_t cursor = this->findMotionKey(track, frame);
+
+	auto& key0 = _motionKeys[track.offset + cursor];
+	if (cursor + 1 >= track.count || frame <= key0.frame)
+	{
+		position = key0.position;
+		rotation = key0.rotation;
+		return;
+	}
+
+	auto& key1 = _motionKeys[track.offset + cursor + 1];
+
+	float ratio = (float)(frame - key0.frame) / (key1.frame - key0.frame);
+
+	float tx = this->sampleMotionCurve(key0.curves[0], ratio);
+	float ty = this->sampleMotionCurve(key0.curves[1], ratio);
+	float tz = this->sampleMotionCurve(key0.curves[2], ratio);
+	float tr = this->sampleMotionCurve(key0.curves[3], ratio);
+
+	position = Vector3(1 - tx, 1 - ty, 1 - tz) * key0.position;
+	position += Vector3(tx, ty, tz) * key1.position;
+
+	rotation = math::slerp(key0.rotation, key1.rotation, tr);
+}
+
 _NAME_END
\ No newline at end of file
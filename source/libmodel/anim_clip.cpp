@@ -0,0 +1,700 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/anim_clip.h>
+#include <ray/anim.h>
+#include <limits>
+
+_NAME_BEGIN
+
+#pragma pack(push)
+#pragma pack(1)
+
+struct ClipHeader
+{
+	char magic[8];
+	std::uint32_t version;
+	float fps;
+	std::uint32_t numFrames;
+	std::uint32_t numTracks;
+	std::uint32_t numKeys;
+	std::uint32_t numPositions;
+	std::uint32_t numCurves;
+};
+
+struct ClipTrackHeader
+{
+	std::uint32_t count;
+	std::uint8_t hasPosition;
+	float3 minimum;
+	float3 extent;
+};
+
+#pragma pack(pop)
+
+struct ClipKey
+{
+	std::int32_t frame;
+	Vector3 position;
+	Quaternion rotation;
+	std::uint8_t interp[16];
+};
+
+static const char ClipMagic[8] = { 'R', 'A', 'Y', 'C', 'L', 'I', 'P', 0 };
+static const std::uint32_t ClipVersion = 1;
+
+static const std::size_t ClipReductionWindow = 256;
+
+static const float ClipRotationRange = 0.707106781f;
+
+static void ClipEncodeRotation(const Quaternion& q, std::uint16_t data[3]) noexcept
+{
+	float v[4] = { q.x, q.y, q.z, q.w };
+
+	std::size_t largest = 0;
+	for (std::size_t i = 1; i < 4; i++)
+	{
+		if (std::fabs(v[i]) > std::fabs(v[largest]))
+			largest = i;
+	}
+
+	float sign = v[largest] < 0.0f ? -1.0f : 1.0f;
+
+	std::uint64_t bits = largest;
+	std::size_t shift = 2;
+
+	for (std::size_t i = 0; i < 4; i++)
+	{
+		if (i == largest)
+			continue;
+
+		float n = math::clamp((v[i] * sign + ClipRotationRange) / (2.0f * ClipRotationRange), 0.0f, 1.0f);
+		bits |= (std::uint64_t)(n * 32767.0f + 0.5f) << shift;
+		shift += 15;
+	}
+
+	data[0] = bits & 0xFFFF;
+	data[1] = (bits >> 16) & 0xFFFF;
+	data[2] = (bits >> 32) & 0xFFFF;
+}
+
+static Quaternion ClipDecodeRotation(const std::uint16_t data[3]) noexcept
+{
+	std::uint64_t bits = data[0] | (std::uint64_t)data[1] << 16 | (std::uint64_t)data[2] << 32;
+
+	std::size_t largest = bits & 3;
+	std::size_t shift = 2;
+
+	float v[4];
+	float sum = 0.0f;
+
+	for (std::size_t i = 0; i < 4; i++)
+	{
+		if (i == largest)
+			continue;
+
+		v[i] = ((bits >> shift) & 0x7FFF) / 32767.0f * (2.0f * ClipRotationRange) - ClipRotationRange;
+		sum += v[i] * v[i];
+		shift += 15;
+	}
+
+	v[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+
+	return Quaternion(v[0], v[1], v[2], v[3]);
+}
+
+static std::uint16_t ClipEncodeScalar(float value, float minimum, float extent) noexcept
+{
+	if (extent <= 0.0f)
+		return 0;
+	return (std::uint16_t)(math::clamp((value - minimum) / extent, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static float ClipDecodeScalar(std::uint16_t value, float minimum, float extent) noexcept
+{
+	return minimum + extent * (value / 65535.0f);
+}
+
+static void ClipEvaluate(const ClipKey& key0, const ClipKey& key1, const float* tables, std::int32_t frame, Vector3& position, Quaternion& rotation) noexcept
+{
+	const std::size_t N = AnimationClip::CurveSamples;
+
+	if (key1.frame <= key0.frame || frame <= key0.frame)
+	{
+		position = key0.position;
+		rotation = key0.rotation;
+		return;
+	}
+
+	float ratio = (float)(frame - key0.frame) / (key1.frame - key0.frame);
+
+	float tx = AnimationClip::sampleCurve(tables + N * 0, tables + N * 1, ratio);
+	float ty = AnimationClip::sampleCurve(tables + N * 2, tables + N * 3, ratio);
+	float tz = AnimationClip::sampleCurve(tables + N * 4, tables + N * 5, ratio);
+	float tr = AnimationClip::sampleCurve(tables + N * 6, tables + N * 7, ratio);
+
+	position = Vector3(1 - tx, 1 - ty, 1 - tz) * key0.position;
+	position += Vector3(tx, ty, tz) * key1.position;
+
+	rotation = math::slerp(key0.rotation, key1.rotation, tr);
+}
+
+static float ClipRotationError(const Quaternion& q1, const Quaternion& q2) noexcept
+{
+	float sign = math::dot(q1, q2) < 0.0f ? -1.0f : 1.0f;
+
+	float x = q1.x - q2.x * sign;
+	float y = q1.y - q2.y * sign;
+	float z = q1.z - q2.z * sign;
+	float w = q1.w - q2.w * sign;
+
+	return 2.0f * std::sqrt(x * x + y * y + z * z + w * w);
+}
+
+static void ClipBakeInterpolation(const std::uint8_t interp[16], float* tables) noexcept
+{
+	const std::size_t N = AnimationClip::CurveSamples;
+
+	for (std::size_t i = 0; i < 4; i++)
+		AnimationClip::bakeCurve(interp + i * 4, tables + N * i * 2, tables + N * (i * 2 + 1));
+}
+
+AnimationClip::AnimationClip() noexcept
+	: _fps(30.0f)
+	, _numFrames(0)
+{
+}
+
+AnimationClip::~AnimationClip() noexcept
+{
+}
+
+bool
+AnimationClip::build(const AnimationProperty& animation, float positionError, float rotationError) noexcept
+{
+	std::vector<std::string> names;
+	std::map<std::string, std::vector<ClipKey>> tracks;
+
+	for (std::size_t i = 0; i < animation.getNumBoneAnimation(); i++)
+	{
+		auto& anim = animation.getBoneAnimation(i);
+		if (anim.getFrameNo() < 0 || anim.getFrameNo() > std::numeric_limits<std::uint16_t>::max())
+			return false;
+
+		auto& interp = anim.getInterpolation();
+
+		ClipKey key;
+		key.frame = anim.getFrameNo();
+		key.position = anim.getPosition();
+		key.rotation = math::normalize(anim.getRotation());
+		std::memcpy(key.interp + 0, interp.interpX, 4);
+		std::memcpy(key.interp + 4, interp.interpY, 4);
+		std::memcpy(key.interp + 8, interp.interpZ, 4);
+		std::memcpy(key.interp + 12, interp.interpW, 4);
+
+		auto it = tracks.find(anim.getName());
+		if (it == tracks.end())
+		{
+			names.push_back(anim.getName());
+			it = tracks.insert(std::make_pair(anim.getName(), std::vector<ClipKey>())).first;
+		}
+
+		it->second.push_back(key);
+	}
+
+	_tracks.clear();
+	_curvePalette.clear();
+	_frames.clear();
+	_curves.clear();
+	_rotations.clear();
+	_positions.clear();
+	_numFrames = 0;
+
+	std::map<std::string, std::uint16_t> palette;
+	std::map<std::string, std::vector<float>> tables;
+
+	for (auto& name : names)
+	{
+		auto& keys = tracks[name];
+
+		std::stable_sort(keys.begin(), keys.end(), [](const ClipKey& a, const ClipKey& b) { return a.frame < b.frame; });
+
+		std::vector<ClipKey> unique;
+		for (auto& key : keys)
+		{
+			if (!unique.empty() && unique.back().frame == key.frame)
+				unique.back() = key;
+			else
+				unique.push_back(key);
+		}
+
+		keys.swap(unique);
+
+		std::vector<const float*> keyTables(keys.size());
+		for (std::size_t i = 0; i < keys.size(); i++)
+		{
+			auto& table = tables[std::string((const char*)keys[i].interp, sizeof(keys[i].interp))];
+			if (table.empty())
+			{
+				table.resize(CurveSamples * 8);
+				ClipBakeInterpolation(keys[i].interp, table.data());
+			}
+
+			keyTables[i] = table.data();
+		}
+
+		std::vector<std::size_t> kept;
+		kept.push_back(0);
+
+		std::size_t cursor = 0;
+		while (cursor + 1 < keys.size())
+		{
+			std::size_t next = cursor + 1;
+
+			while (next + 1 < keys.size() && next - cursor < ClipReductionWindow)
+			{
+				auto& key0 = keys[cursor];
+				auto& key1 = keys[next + 1];
+
+				bool acceptable = true;
+
+				std::size_t segment = cursor;
+				for (std::int32_t frame = key0.frame + 1; frame < key1.frame && acceptable; frame++)
+				{
+					while (segment + 1 < keys.size() && keys[segment + 1].frame <= frame)
+						segment++;
+
+					Vector3 position, reference;
+					Quaternion rotation, referenceRotation;
+
+					ClipEvaluate(key0, key1, keyTables[cursor], frame, position, rotation);
+					ClipEvaluate(keys[segment], keys[segment + 1], keyTables[segment], frame, reference, referenceRotation);
+
+					if (math::distance(position, reference) > positionError)
+						acceptable = false;
+
+					if (ClipRotationError(rotation, referenceRotation) > rotationError)
+						acceptable = false;
+				}
+
+				if (!acceptable)
+					break;
+
+				next++;
+			}
+
+			kept.push_back(next);
+			cursor = next;
+		}
+
+		MotionClipTrack track;
+		track.name = name;
+		track.offset = (std::uint32_t)_frames.size();
+		track.count = (std::uint32_t)kept.size();
+		track.positionOffset = (std::uint32_t)_positions.size();
+
+		float3 minimum = keys[kept.front()].position;
+		float3 maximum = minimum;
+		for (auto index : kept)
+		{
+			minimum = math::min(minimum, keys[index].position);
+			maximum = math::max(maximum, keys[index].position);
+		}
+
+		track.minimum = minimum;
+		track.extent = maximum - minimum;
+
+		track.hasPosition = track.extent.x > 0.0f || track.extent.y > 0.0f || track.extent.z > 0.0f;
+
+		for (auto index : kept)
+		{
+			auto& key = keys[index];
+
+			std::string hash((const char*)key.interp, sizeof(key.interp));
+
+			auto it = palette.find(hash);
+			if (it == palette.end())
+			{
+				if (palette.size() > std::numeric_limits<std::uint16_t>::max())
+					return false;
+
+				it = palette.insert(std::make_pair(hash, (std::uint16_t)palette.size())).first;
+				_curvePalette.insert(_curvePalette.end(), key.interp, key.interp + sizeof(key.interp));
+			}
+
+			std::uint16_t rotation[3];
+			ClipEncodeRotation(key.rotation, rotation);
+
+			_frames.push_back((std::uint16_t)key.frame);
+			_curves.push_back(it->second);
+			_rotations.insert(_rotations.end(), rotation, rotation + 3);
+
+			if (track.hasPosition)
+			{
+				_positions.push_back(ClipEncodeScalar(key.position.x, track.minimum.x, track.extent.x));
+				_positions.push_back(ClipEncodeScalar(key.position.y, track.minimum.y, track.extent.y));
+				_positions.push_back(ClipEncodeScalar(key.position.z, track.minimum.z, track.extent.z));
+			}
+
+			_numFrames = std::max(_numFrames, (std::uint32_t)key.frame + 1);
+		}
+
+		_tracks.push_back(track);
+	}
+
+	this->_bakeCurves();
+	return true;
+}
+
+bool
+AnimationClip::load(StreamReader& stream) noexcept
+{
+	ClipHeader header;
+	if (!stream.read((char*)&header, sizeof(header))) return false;
+
+	if (std::memcmp(header.magic, ClipMagic, sizeof(ClipMagic)) != 0) return false;
+	if (header.version != ClipVersion) return false;
+	if (!(header.fps > 0.0f)) return false;
+
+	_fps = header.fps;
+	_numFrames = header.numFrames;
+
+	// the sizes are computed in size_t so a crafted count can't wrap around before the resize
+	_curvePalette.resize((std::size_t)header.numCurves * 16);
+	_frames.resize(header.numKeys);
+	_curves.resize(header.numKeys);
+	_rotations.resize((std::size_t)header.numKeys * 3);
+	_positions.resize((std::size_t)header.numPositions * 3);
+	_tracks.resize(header.numTracks);
+
+	if (!_curvePalette.empty())
+	{
+		if (!stream.read((char*)_curvePalette.data(), _curvePalette.size())) return false;
+	}
+
+	std::uint32_t offset = 0;
+	std::uint32_t positionOffset = 0;
+
+	for (auto& track : _tracks)
+	{
+		std::uint16_t length = 0;
+		if (!stream.read((char*)&length, sizeof(length))) return false;
+
+		track.name.resize(length);
+		if (length > 0)
+		{
+			if (!stream.read((char*)&track.name[0], length)) return false;
+		}
+
+		ClipTrackHeader trackHeader;
+		if (!stream.read((char*)&trackHeader, sizeof(trackHeader))) return false;
+
+		track.offset = offset;
+		track.count = trackHeader.count;
+		track.positionOffset = positionOffset;
+		track.minimum = trackHeader.minimum;
+		track.extent = trackHeader.extent;
+		track.hasPosition = trackHeader.hasPosition ? true : false;
+
+		if (track.count == 0 || track.count > header.numKeys - offset)
+			return false;
+
+		if (!stream.read((char*)&_frames[offset], (std::size_t)track.count * sizeof(std::uint16_t))) return false;
+		if (!stream.read((char*)&_curves[offset], (std::size_t)track.count * sizeof(std::uint16_t))) return false;
+		if (!stream.read((char*)&_rotations[(std::size_t)offset * 3], (std::size_t)track.count * sizeof(std::uint16_t) * 3)) return false;
+
+		if (trackHeader.hasPosition)
+		{
+			if (track.count > header.numPositions - positionOffset)
+				return false;
+
+			if (!stream.read((char*)&_positions[(std::size_t)positionOffset * 3], (std::size_t)track.count * sizeof(std::uint16_t) * 3)) return false;
+			positionOffset += track.count;
+		}
+
+		// the cursors of the samplers only move forward, so the frames of a track have to be strictly increasing
+		for (std::size_t i = 0; i < track.count; i++)
+		{
+			if (_curves[offset + i] >= header.numCurves)
+				return false;
+
+			if (i > 0 && _frames[offset + i] <= _frames[offset + i - 1])
+				return false;
+		}
+
+		offset += track.count;
+	}
+
+	this->_bakeCurves();
+	return true;
+}
+
+bool
+AnimationClip::save(StreamWrite& stream) const noexcept
+{
+	ClipHeader header;
+	std::memcpy(header.magic, ClipMagic, sizeof(ClipMagic));
+	header.version = ClipVersion;
+	header.fps = _fps;
+	header.numFrames = _numFrames;
+	header.numTracks = (std::uint32_t)_tracks.size();
+	header.numKeys = (std::uint32_t)_frames.size();
+	header.numPositions = (std::uint32_t)_positions.size() / 3;
+	header.numCurves = (std::uint32_t)_curvePalette.size() / 16;
+
+	if (!stream.write((char*)&header, sizeof(header))) return false;
+
+	if (!_curvePalette.empty())
+	{
+		if (!stream.write((char*)_curvePalette.data(), _curvePalette.size())) return false;
+	}
+
+	for (auto& track : _tracks)
+	{
+		std::uint16_t length = (std::uint16_t)std::min<std::size_t>(track.name.size(), std::numeric_limits<std::uint16_t>::max());
+		if (!stream.write((char*)&length, sizeof(length))) return false;
+		if (length > 0)
+		{
+			if (!stream.write(track.name.data(), length)) return false;
+		}
+
+		ClipTrackHeader trackHeader;
+		trackHeader.count = track.count;
+		trackHeader.hasPosition = track.hasPosition;
+		trackHeader.minimum = track.minimum;
+		trackHeader.extent = track.extent;
+
+		if (!stream.write((char*)&trackHeader, sizeof(trackHeader))) return false;
+		if (!stream.write((char*)&_frames[track.offset], track.count * sizeof(std::uint16_t))) return false;
+		if (!stream.write((char*)&_curves[track.offset], track.count * sizeof(std::uint16_t))) return false;
+		if (!stream.write((char*)&_rotations[track.offset * 3], track.count * sizeof(std::uint16_t) * 3)) return false;
+
+		if (trackHeader.hasPosition)
+		{
+			if (!stream.write((char*)&_positions[track.positionOffset * 3], track.count * sizeof(std::uint16_t) * 3)) return false;
+		}
+	}
+
+	return true;
+}
+
+void
+AnimationClip::setFps(float fps) noexcept
+{
+	_fps = fps;
+}
+
+float
+AnimationClip::getFps() const noexcept
+{
+	return _fps;
+}
+
+std::size_t
+AnimationClip::getNumFrames() const noexcept
+{
+	return _numFrames;
+}
+
+std::size_t
+AnimationClip::getNumKeys() const noexcept
+{
+	return _frames.size();
+}
+
+std::size_t
+AnimationClip::getNumTracks() const noexcept
+{
+	return _tracks.size();
+}
+
+std::int32_t
+AnimationClip::findTrack(const std::string& name) const noexcept
+{
+	for (std::size_t i = 0; i < _tracks.size(); i++)
+	{
+		if (_tracks[i].name == name)
+			return (std::int32_t)i;
+	}
+
+	return -1;
+}
+
+const MotionClipTrack&
+AnimationClip::getTrack(std::size_t index) const noexcept
+{
+	assert(index < _tracks.size());
+	return _tracks[index];
+}
+
+float
+AnimationClip::getDuration() const noexcept
+{
+	return _fps > 0.0f ? _numFrames / _fps : 0.0f;
+}
+
+std::size_t
+AnimationClip::getMemoryUsage() const noexcept
+{
+	std::size_t size = sizeof(AnimationClip);
+	size += _curvePalette.size();
+	size += _curveTables.size() * sizeof(float);
+	size += _frames.size() * sizeof(std::uint16_t);
+	size += _curves.size() * sizeof(std::uint16_t);
+	size += _rotations.size() * sizeof(std::uint16_t);
+	size += _positions.size() * sizeof(std::uint16_t);
+
+	for (auto& track : _tracks)
+		size += sizeof(MotionClipTrack) + track.name.size();
+
+	return size;
+}
+
+float
+AnimationClip::getBytesPerBoneSecond() const noexcept
+{
+	float duration = this->getDuration();
+	if (_tracks.empty() || duration <= 0.0f)
+		return 0.0f;
+
+	return this->getMemoryUsage() / (_tracks.size() * duration);
+}
+
+void
+AnimationClip::sample(std::size_t index, std::int32_t frame, std::size_t& cursor, Vector3& position, Quaternion& rotation) const noexcept
+{
+	assert(index < _tracks.size());
+
+	auto& track = _tracks[index];
+	const std::uint16_t* frames = _frames.data() + track.offset;
+
+	if (cursor >= track.count || frames[cursor] > frame)
+	{
+		cursor = std::upper_bound(frames, frames + track.count, frame, [](std::int32_t f, std::uint16_t key) { return f < key; }) - frames;
+		cursor = cursor > 0 ? cursor - 1 : 0;
+	}
+	else if (cursor + 1 < track.count && frames[cursor + 1] <= frame)
+	{
+		cursor++;
+
+		// playback steps at most a key per update, anything further is a seek
+		if (cursor + 1 < track.count && frames[cursor + 1] <= frame)
+			cursor = std::upper_bound(frames + cursor + 1, frames + track.count, frame, [](std::int32_t f, std::uint16_t key) { return f < key; }) - frames - 1;
+	}
+
+	ClipKey key0;
+	key0.frame = frames[cursor];
+	this->_decodePosition(track, cursor, key0.position);
+	this->_decodeRotation(track, cursor, key0.rotation);
+
+	if (cursor + 1 >= track.count || frame <= key0.frame)
+	{
+		position = key0.position;
+		rotation = key0.rotation;
+		return;
+	}
+
+	ClipKey key1;
+	key1.frame = frames[cursor + 1];
+	this->_decodePosition(track, cursor + 1, key1.position);
+	this->_decodeRotation(track, cursor + 1, key1.rotation);
+
+	const float* tables = _curveTables.data() + _curves[track.offset + cursor] * CurveSamples * 8;
+	ClipEvaluate(key0, key1, tables, frame, position, rotation);
+}
+
+void
+AnimationClip::bakeCurve(const std::uint8_t interp[4], float xs[CurveSamples], float ys[CurveSamples]) noexcept
+{
+	float xa = interp[0] / 256.0f;
+	float xb = interp[2] / 256.0f;
+	float ya = interp[1] / 256.0f;
+	float yb = interp[3] / 256.0f;
+
+	for (std::size_t i = 0; i < CurveSamples; i++)
+	{
+		float s = (float)i / (CurveSamples - 1);
+		xs[i] = 3 * xa * s * (1 - s) * (1 - s) + 3 * xb * s * s * (1 - s) + s * s * s;
+		ys[i] = 3 * ya * s * (1 - s) * (1 - s) + 3 * yb * s * s * (1 - s) + s * s * s;
+	}
+}
+
+float
+AnimationClip::sampleCurve(const float xs[CurveSamples], const float ys[CurveSamples], float t) noexcept
+{
+	std::size_t i = std::upper_bound(xs, xs + CurveSamples, t) - xs;
+	i = math::clamp<std::size_t>(i, 1, CurveSamples - 1) - 1;
+
+	float dx = xs[i + 1] - xs[i];
+	if (dx <= 0.0f)
+		return ys[i];
+
+	return ys[i] + (ys[i + 1] - ys[i]) * math::clamp((t - xs[i]) / dx, 0.0f, 1.0f);
+}
+
+void
+AnimationClip::_bakeCurves() noexcept
+{
+	std::size_t numCurves = _curvePalette.size() / 16;
+
+	_curveTables.resize(numCurves * CurveSamples * 8);
+
+	for (std::size_t i = 0; i < numCurves; i++)
+		ClipBakeInterpolation(_curvePalette.data() + i * 16, _curveTables.data() + i * CurveSamples * 8);
+}
+
+void
+AnimationClip::_decodePosition(const MotionClipTrack& track, std::size_t key, Vector3& position) const noexcept
+{
+	if (!track.hasPosition)
+	{
+		position = track.minimum;
+		return;
+	}
+
+	const std::uint16_t* data = _positions.data() + (track.positionOffset + key) * 3;
+	position.x = ClipDecodeScalar(data[0], track.minimum.x, track.extent.x);
+	position.y = ClipDecodeScalar(data[1], track.minimum.y, track.extent.y);
+	position.z = ClipDecodeScalar(data[2], track.minimum.z, track.extent.z);
+}
+
+void
+AnimationClip::_decodeRotation(const MotionClipTrack& track, std::size_t key, Quaternion& rotation) const noexcept
+{
+	rotation = ClipDecodeRotation(_rotations.data() + (track.offset + key) * 3);
+}
+
+_NAME_END
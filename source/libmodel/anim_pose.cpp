@@ -0,0 +1,244 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/anim_pose.h>
+
+_NAME_BEGIN
+
+AnimationPose::AnimationPose() noexcept
+	: _version(0)
+{
+}
+
+AnimationPose::~AnimationPose() noexcept
+{
+}
+
+void
+AnimationPose::setBoneArray(const Bones& bones) noexcept
+{
+	std::size_t size = bones.size();
+
+	_parents.resize(size);
+	_localTranslates.resize(size);
+	_localScalings.resize(size);
+	_localRotations.resize(size);
+	_worldTransforms.resize(size);
+
+	for (std::size_t i = 0; i < size; i++)
+	{
+		std::int16_t parent = bones[i].getParent();
+		if (parent < 0 || (std::size_t)parent >= size)
+			parent = -1;
+
+		_parents[i] = parent;
+		_localRotations[i] = Quaternion::Zero;
+		_localScalings[i] = float3::One;
+
+		if (parent == -1)
+			_localTranslates[i] = bones[i].getPosition();
+		else
+			_localTranslates[i] = bones[i].getPosition() - bones[parent].getPosition();
+	}
+
+	this->_updateEvaluationOrder();
+	this->updateWorldTransforms();
+}
+
+std::size_t
+AnimationPose::getNumBones() const noexcept
+{
+	return _parents.size();
+}
+
+void
+AnimationPose::setParent(std::size_t index, std::int16_t parent) noexcept
+{
+	assert(index < _parents.size());
+	_parents[index] = parent;
+	this->_updateEvaluationOrder();
+}
+
+std::int16_t
+AnimationPose::getParent(std::size_t index) const noexcept
+{
+	assert(index < _parents.size());
+	return _parents[index];
+}
+
+void
+AnimationPose::setLocalTranslate(std::size_t index, const float3& translate) noexcept
+{
+	assert(index < _localTranslates.size());
+	_localTranslates[index] = translate;
+}
+
+const float3&
+AnimationPose::getLocalTranslate(std::size_t index) const noexcept
+{
+	assert(index < _localTranslates.size());
+	return _localTranslates[index];
+}
+
+void
+AnimationPose::setLocalRotation(std::size_t index, const Quaternion& rotation) noexcept
+{
+	assert(index < _localRotations.size());
+	_localRotations[index] = rotation;
+}
+
+const Quaternion&
+AnimationPose::getLocalRotation(std::size_t index) const noexcept
+{
+	assert(index < _localRotations.size());
+	return _localRotations[index];
+}
+
+void
+AnimationPose::setLocalScaling(std::size_t index, const float3& scaling) noexcept
+{
+	assert(index < _localScalings.size());
+	_localScalings[index] = scaling;
+}
+
+const float3&
+AnimationPose::getLocalScaling(std::size_t index) const noexcept
+{
+	assert(index < _localScalings.size());
+	return _localScalings[index];
+}
+
+void
+AnimationPose::setLocalTransform(std::size_t index, const float3& translate, const Quaternion& rotation) noexcept
+{
+	assert(index < _parents.size());
+	_localTranslates[index] = translate;
+	_localRotations[index] = rotation;
+}
+
+const float4x4&
+AnimationPose::getWorldTransform(std::size_t index) const noexcept
+{
+	assert(index < _worldTransforms.size());
+	return _worldTransforms[index];
+}
+
+const std::vector<float4x4>&
+AnimationPose::getWorldTransforms() const noexcept
+{
+	return _worldTransforms;
+}
+
+const std::vector<std::uint16_t>&
+AnimationPose::getEvaluationOrder() const noexcept
+{
+	return _order;
+}
+
+std::size_t
+AnimationPose::getVersion() const noexcept
+{
+	return _version;
+}
+
+void
+AnimationPose::updateWorldTransforms() noexcept
+{
+	for (auto index : _order)
+	{
+		float4x4 local;
+		local.makeTransform(_localTranslates[index], _localRotations[index], _localScalings[index]);
+
+		std::int16_t parent = _parents[index];
+		if (parent == -1)
+			_worldTransforms[index] = local;
+		else
+			_worldTransforms[index] = math::transformMultiply(_worldTransforms[parent], local);
+	}
+
+	_version++;
+}
+
+void
+AnimationPose::updateWorldTransform(std::size_t index) noexcept
+{
+	assert(index < _parents.size());
+
+	std::int16_t parent = _parents[index];
+	if (parent != -1)
+		this->updateWorldTransform(parent);
+
+	float4x4 local;
+	local.makeTransform(_localTranslates[index], _localRotations[index], _localScalings[index]);
+
+	if (parent == -1)
+		_worldTransforms[index] = local;
+	else
+		_worldTransforms[index] = math::transformMultiply(_worldTransforms[parent], local);
+
+	_version++;
+}
+
+void
+AnimationPose::_updateEvaluationOrder() noexcept
+{
+	std::size_t size = _parents.size();
+
+	std::vector<std::uint16_t> depths(size, 0);
+	for (std::size_t i = 0; i < size; i++)
+	{
+		std::size_t depth = 0;
+		std::int16_t parent = _parents[i];
+		while (parent != -1 && depth < size)
+		{
+			parent = _parents[parent];
+			depth++;
+		}
+
+		if (depth >= size)
+			_parents[i] = -1;
+
+		depths[i] = depth < size ? depth : 0;
+	}
+
+	_order.resize(size);
+	for (std::size_t i = 0; i < size; i++)
+		_order[i] = i;
+
+	std::stable_sort(_order.begin(), _order.end(), [&](std::uint16_t a, std::uint16_t b) { return depths[a] < depths[b]; });
+}
+
+_NAME_END
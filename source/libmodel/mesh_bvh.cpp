@@ -0,0 +1,482 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/mesh_bvh.h>
+#include <ray/modhelp.h>
+
+_NAME_BEGIN
+
+const std::size_t MaxBVHDepth = 64;
+
+static float
+surfaceArea(const float3& min, const float3& max) noexcept
+{
+	float3 d = max - min;
+	return d.x * d.y + d.y * d.z + d.z * d.x;
+}
+
+MeshBVH::MeshBVH() noexcept
+{
+}
+
+MeshBVH::~MeshBVH() noexcept
+{
+}
+
+bool
+MeshBVH::build(const MeshProperty& mesh) noexcept
+{
+	this->clear();
+
+	auto& vertices = mesh.getVertexArray();
+	auto& indices = mesh.getIndicesArray();
+	auto& subsets = mesh.getMeshSubsets();
+
+	std::vector<std::uint32_t> faces;
+	std::vector<std::uint32_t> faceSubsets;
+
+	if (indices.empty())
+	{
+		for (std::uint32_t i = 0; i + 2 < vertices.size(); i += 3)
+		{
+			faces.push_back(i);
+			faceSubsets.push_back(0);
+		}
+	}
+	else if (subsets.empty())
+	{
+		for (std::uint32_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			faces.push_back(i);
+			faceSubsets.push_back(0);
+		}
+	}
+	else
+	{
+		for (std::uint32_t n = 0; n < subsets.size(); n++)
+		{
+			std::uint32_t first = subsets[n].startIndices;
+			std::uint32_t last = std::min<std::uint32_t>(first + subsets[n].indicesCount, indices.size());
+
+			for (std::uint32_t i = first; i + 2 < last; i += 3)
+			{
+				faces.push_back(i);
+				faceSubsets.push_back(n);
+			}
+		}
+	}
+
+	// subset indices are relative to the first vertex of their subset
+	auto baseVertex = [&](std::size_t i) -> std::uint32_t
+	{
+		return (indices.empty() || subsets.empty()) ? 0 : subsets[faceSubsets[i]].startVertices;
+	};
+
+	auto vertex = [&](std::uint32_t i, std::uint32_t base) -> const float3&
+	{
+		return vertices[indices.empty() ? i : base + indices[i]];
+	};
+
+	std::vector<float3> centers;
+	std::vector<MeshBVHNode> bounds;
+	std::vector<std::uint32_t> order;
+	std::vector<std::uint32_t> valid;
+
+	centers.reserve(faces.size());
+	bounds.reserve(faces.size());
+	order.reserve(faces.size());
+	valid.reserve(faces.size());
+
+	for (std::size_t i = 0; i < faces.size(); i++)
+	{
+		std::uint32_t face = faces[i];
+		std::uint32_t base = baseVertex(i);
+		if (!indices.empty())
+		{
+			if (base + indices[face] >= vertices.size() || base + indices[face + 1] >= vertices.size() || base + indices[face + 2] >= vertices.size())
+				continue;
+		}
+
+		const float3& v0 = vertex(face, base);
+		const float3& v1 = vertex(face + 1, base);
+		const float3& v2 = vertex(face + 2, base);
+
+		MeshBVHNode box;
+		box.min = math::min(math::min(v0, v1), v2);
+		box.max = math::max(math::max(v0, v1), v2);
+
+		centers.push_back((box.min + box.max) * 0.5f);
+		bounds.push_back(box);
+		order.push_back((std::uint32_t)valid.size());
+		valid.push_back((std::uint32_t)i);
+	}
+
+	if (order.empty())
+		return false;
+
+	_nodes.reserve(order.size() * 2 / LeafSize + 1);
+	_nodes.emplace_back();
+
+	this->subdivide(0, 0, (std::uint32_t)order.size(), 0, centers, bounds, order);
+
+	_nodes.shrink_to_fit();
+
+	_triangles.resize(order.size() * 3);
+	_triangleIndices.resize(order.size());
+	_triangleSubsets.resize(order.size());
+
+	for (std::size_t i = 0; i < order.size(); i++)
+	{
+		std::uint32_t face = faces[valid[order[i]]];
+		std::uint32_t base = baseVertex(valid[order[i]]);
+
+		const float3& v0 = vertex(face, base);
+		const float3& v1 = vertex(face + 1, base);
+		const float3& v2 = vertex(face + 2, base);
+
+		_triangles[i * 3] = v0;
+		_triangles[i * 3 + 1] = v1 - v0;
+		_triangles[i * 3 + 2] = v2 - v0;
+
+		_triangleIndices[i] = face / 3;
+		_triangleSubsets[i] = faceSubsets[valid[order[i]]];
+	}
+
+	return true;
+}
+
+void
+MeshBVH::subdivide(std::uint32_t index, std::uint32_t first, std::uint32_t count, std::uint32_t depth, const std::vector<float3>& centers, const std::vector<MeshBVHNode>& bounds, std::vector<std::uint32_t>& order) noexcept
+{
+	float3 minimum = bounds[order[first]].min;
+	float3 maximum = bounds[order[first]].max;
+	float3 centerMin = centers[order[first]];
+	float3 centerMax = centers[order[first]];
+
+	for (std::uint32_t i = first + 1; i < first + count; i++)
+	{
+		minimum = math::min(minimum, bounds[order[i]].min);
+		maximum = math::max(maximum, bounds[order[i]].max);
+		centerMin = math::min(centerMin, centers[order[i]]);
+		centerMax = math::max(centerMax, centers[order[i]]);
+	}
+
+	_nodes[index].min = minimum;
+	_nodes[index].max = maximum;
+	_nodes[index].offset = first;
+	_nodes[index].count = count;
+
+	if (count <= LeafSize || depth >= MaxBVHDepth)
+		return;
+
+	std::uint8_t bestAxis = 0;
+	std::size_t bestSplit = 0;
+	float bestCost = surfaceArea(minimum, maximum) * count;
+
+	for (std::uint8_t axis = 0; axis < 3; axis++)
+	{
+		float extent = centerMax[axis] - centerMin[axis];
+		if (extent <= 0.0f)
+			continue;
+
+		float scale = BinCount / extent;
+
+		std::uint32_t binCounts[BinCount] = { 0 };
+		float3 binMin[BinCount];
+		float3 binMax[BinCount];
+
+		for (std::uint32_t i = first; i < first + count; i++)
+		{
+			std::size_t bin = std::min<std::size_t>((std::size_t)((centers[order[i]][axis] - centerMin[axis]) * scale), BinCount - 1);
+			if (binCounts[bin]++ == 0)
+			{
+				binMin[bin] = bounds[order[i]].min;
+				binMax[bin] = bounds[order[i]].max;
+			}
+			else
+			{
+				binMin[bin] = math::min(binMin[bin], bounds[order[i]].min);
+				binMax[bin] = math::max(binMax[bin], bounds[order[i]].max);
+			}
+		}
+
+		float rightArea[BinCount];
+		std::uint32_t rightCount[BinCount];
+
+		float3 boxMin = float3(FLT_MAX, FLT_MAX, FLT_MAX);
+		float3 boxMax = float3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		std::uint32_t sum = 0;
+
+		for (std::size_t i = BinCount - 1; i > 0; i--)
+		{
+			if (binCounts[i] > 0)
+			{
+				boxMin = math::min(boxMin, binMin[i]);
+				boxMax = math::max(boxMax, binMax[i]);
+				sum += binCounts[i];
+			}
+
+			rightArea[i] = sum > 0 ? surfaceArea(boxMin, boxMax) : 0.0f;
+			rightCount[i] = sum;
+		}
+
+		boxMin = float3(FLT_MAX, FLT_MAX, FLT_MAX);
+		boxMax = float3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		sum = 0;
+
+		for (std::size_t i = 0; i < BinCount - 1; i++)
+		{
+			if (binCounts[i] > 0)
+			{
+				boxMin = math::min(boxMin, binMin[i]);
+				boxMax = math::max(boxMax, binMax[i]);
+				sum += binCounts[i];
+			}
+
+			if (sum == 0 || rightCount[i + 1] == 0)
+				continue;
+
+			float cost = surfaceArea(boxMin, boxMax) * sum + rightArea[i + 1] * rightCount[i + 1];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = i + 1;
+			}
+		}
+	}
+
+	if (bestSplit == 0)
+		return;
+
+	float scale = BinCount / (centerMax[bestAxis] - centerMin[bestAxis]);
+
+	auto middle = std::partition(order.begin() + first, order.begin() + first + count, [&](std::uint32_t i)
+	{
+		std::size_t bin = std::min<std::size_t>((std::size_t)((centers[i][bestAxis] - centerMin[bestAxis]) * scale), BinCount - 1);
+		return bin < bestSplit;
+	});
+
+	std::uint32_t leftCount = (std::uint32_t)(middle - order.begin()) - first;
+	if (leftCount == 0 || leftCount == count)
+		return;
+
+	std::uint32_t left = (std::uint32_t)_nodes.size();
+	_nodes.emplace_back();
+
+	this->subdivide(left, first, leftCount, depth + 1, centers, bounds, order);
+
+	std::uint32_t right = (std::uint32_t)_nodes.size();
+	_nodes.emplace_back();
+
+	this->subdivide(right, first + leftCount, count - leftCount, depth + 1, centers, bounds, order);
+
+	_nodes[index].offset = right;
+	_nodes[index].count = 0;
+}
+
+void
+MeshBVH::clear() noexcept
+{
+	_nodes.clear();
+	_triangles.clear();
+	_triangleIndices.clear();
+	_triangleSubsets.clear();
+}
+
+bool
+MeshBVH::empty() const noexcept
+{
+	return _nodes.empty();
+}
+
+std::size_t
+MeshBVH::getNumNodes() const noexcept
+{
+	return _nodes.size();
+}
+
+std::size_t
+MeshBVH::getNumTriangles() const noexcept
+{
+	return _triangleIndices.size();
+}
+
+std::size_t
+MeshBVH::getMemoryUsage() const noexcept
+{
+	std::size_t size = 0;
+	size += _nodes.size() * sizeof(MeshBVHNode);
+	size += _triangles.size() * sizeof(float3);
+	size += _triangleIndices.size() * sizeof(std::uint32_t);
+	size += _triangleSubsets.size() * sizeof(std::uint32_t);
+	return size;
+}
+
+bool
+MeshBVH::slab(const MeshBVHNode& node, const float3& origin, const float3& invDir, float maxDistance, float& distance) noexcept
+{
+	float tmin = 0.0f;
+	float tmax = maxDistance;
+
+	for (std::uint8_t i = 0; i < 3; i++)
+	{
+		float t1 = (node.min[i] - origin[i]) * invDir[i];
+		float t2 = (node.max[i] - origin[i]) * invDir[i];
+
+		tmin = std::max(tmin, std::min(t1, t2));
+		tmax = std::min(tmax, std::max(t1, t2));
+	}
+
+	distance = tmin;
+	return tmin <= tmax;
+}
+
+bool
+MeshBVH::raycast(const float3& origin, const float3& direction, float maxDistance, MeshBVHHit& hit) const noexcept
+{
+	if (_nodes.empty())
+		return false;
+
+	float3 invDir;
+	invDir.x = direction.x != 0.0f ? 1.0f / direction.x : BIG_NUMBER;
+	invDir.y = direction.y != 0.0f ? 1.0f / direction.y : BIG_NUMBER;
+	invDir.z = direction.z != 0.0f ? 1.0f / direction.z : BIG_NUMBER;
+
+	float distance;
+	if (!slab(_nodes[0], origin, invDir, maxDistance, distance))
+		return false;
+
+	std::uint32_t stack[MaxBVHDepth + 1];
+	float stackDistance[MaxBVHDepth + 1];
+	std::size_t count = 0;
+
+	stack[count] = 0;
+	stackDistance[count++] = distance;
+
+	bool found = false;
+	float closest = maxDistance;
+
+	while (count > 0)
+	{
+		--count;
+
+		if (stackDistance[count] > closest)
+			continue;
+
+		std::uint32_t index = stack[count];
+		const MeshBVHNode& node = _nodes[index];
+
+		if (node.count > 0)
+		{
+			for (std::uint32_t i = node.offset; i < node.offset + node.count; i++)
+			{
+				const float3& v0 = _triangles[i * 3];
+				const float3& e1 = _triangles[i * 3 + 1];
+				const float3& e2 = _triangles[i * 3 + 2];
+
+				float3 p = math::cross(direction, e2);
+				float det = math::dot(e1, p);
+				if (std::abs(det) < 1e-12f)
+					continue;
+
+				float invDet = 1.0f / det;
+
+				float3 s = origin - v0;
+				float u = math::dot(s, p) * invDet;
+				if (u < 0.0f || u > 1.0f)
+					continue;
+
+				float3 q = math::cross(s, e1);
+				float v = math::dot(direction, q) * invDet;
+				if (v < 0.0f || u + v > 1.0f)
+					continue;
+
+				float t = math::dot(e2, q) * invDet;
+				if (t < 0.0f || t >= closest)
+					continue;
+
+				closest = t;
+				found = true;
+
+				hit.triangle = _triangleIndices[i];
+				hit.subset = _triangleSubsets[i];
+				hit.distance = t;
+				hit.u = u;
+				hit.v = v;
+			}
+		}
+		else
+		{
+			std::uint32_t left = index + 1;
+			std::uint32_t right = node.offset;
+
+			float leftDistance, rightDistance;
+			bool hitLeft = slab(_nodes[left], origin, invDir, closest, leftDistance);
+			bool hitRight = slab(_nodes[right], origin, invDir, closest, rightDistance);
+
+			if (hitLeft && hitRight)
+			{
+				if (leftDistance < rightDistance)
+				{
+					std::swap(left, right);
+					std::swap(leftDistance, rightDistance);
+				}
+
+				stack[count] = left;
+				stackDistance[count++] = leftDistance;
+				stack[count] = right;
+				stackDistance[count++] = rightDistance;
+			}
+			else if (hitLeft)
+			{
+				stack[count] = left;
+				stackDistance[count++] = leftDistance;
+			}
+			else if (hitRight)
+			{
+				stack[count] = right;
+				stackDistance[count++] = rightDistance;
+			}
+
+			assert(count <= MaxBVHDepth + 1);
+		}
+	}
+
+	return found;
+}
+
+_NAME_END
@@ -56,6 +56,10 @@
 #   include "modsdkmesh.h"
 #endif
 
+#if _BUILD_CLIP_HANDLER
+#   include "modclip.h"
+#endif
+
 // #include "ray/modelx.h"
 // #include "ray/model3ds.h"
 // #include "ray/modelmd3.h"
@@ -116,6 +120,10 @@ std::shared_ptr<ModelHandler> vmdHandler = std::make_shared<VMDHandler>();
 std::shared_ptr<ModelHandler> sdkmeshHandler = std::make_shared<SDKMeshHandler>();
 #endif
 
+#if _BUILD_CLIP_HANDLER
+std::shared_ptr<ModelHandler> clipHandler = std::make_shared<ClipHandler>();
+#endif
+
 void GetModelInstanceList(Model& model)
 {
 #if _BUILD_OBJ_HANDLER
@@ -137,6 +145,10 @@ void GetModelInstanceList(Model& model)
 #if _BUILD_SDKMESH_HANDLER
 	model.addHandler(sdkmeshHandler);
 #endif
+
+#if _BUILD_CLIP_HANDLER
+	model.addHandler(clipHandler);
+#endif
 	//     #if (!defined _BUILD_NO_X_HANDLER)
 	//         out.push_back(new XFileLoader());
 	//     #endif
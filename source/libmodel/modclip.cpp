@@ -0,0 +1,103 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include "modclip.h"
+
+#include <ray/anim.h>
+
+_NAME_BEGIN
+
+ClipHandler::ClipHandler() noexcept
+{
+}
+
+ClipHandler::~ClipHandler() noexcept
+{
+}
+
+bool
+ClipHandler::doCanRead(StreamReader& stream) const noexcept
+{
+	char magic[8];
+
+	if (stream.read(magic, sizeof(magic)))
+	{
+		if (std::strncmp(magic, "RAYCLIP", 8) == 0)
+			return true;
+	}
+
+	return false;
+}
+
+bool
+ClipHandler::doCanRead(const char* type) const noexcept
+{
+	return std::strncmp(type, "clip", 4) == 0;
+}
+
+bool
+ClipHandler::doLoad(StreamReader& stream, Model& model) noexcept
+{
+	auto clip = std::make_shared<AnimationClip>();
+	if (!clip->load(stream))
+		return false;
+
+	auto animtion = std::make_shared<AnimationProperty>();
+	animtion->setClip(clip);
+
+	model.addAnimtion(animtion);
+
+	return true;
+}
+
+bool
+ClipHandler::doSave(StreamWrite& stream, const Model& model) noexcept
+{
+	if (!model.hasAnimations())
+		return false;
+
+	auto& animtion = model.getAnimationList().back();
+	if (animtion->getClip())
+		return animtion->getClip()->save(stream);
+
+	AnimationClip clip;
+	if (!clip.build(*animtion))
+		return false;
+
+	return clip.save(stream);
+}
+
+_NAME_END
@@ -2,7 +2,7 @@
 // | Project : ray.
 // | All rights reserved.
 // +----------------------------------------------------------------------
-// | Copyright (c) 2013-2014.
+// | Copyright (c) 2013-2017.
 // +----------------------------------------------------------------------
 // | * Redistribution and use of this software in source and binary forms,
 // |   with or without modification, are permitted provided that the following
@@ -34,32 +34,30 @@
 // | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
-#ifndef _H_RENDER_TRAVERSER_H_
-#define _H_RENDER_TRAVERSER_H_
+#ifndef _H_MODCLIP_H_
+#define _H_MODCLIP_H_
 
-#include <ray/occlusion_query_queue.h>
-#include <queue>
+#include <ray/model.h>
 
 _NAME_BEGIN
 
-class OcclusionTraverser
+class ClipHandler final : public ModelHandler
 {
 public:
+	ClipHandler() noexcept;
+	~ClipHandler() noexcept;
 
-    virtual void traverse() noexcept;
-    virtual void traverseObject(OcclusionObjectPtr object) noexcept;
+	bool doCanRead(StreamReader& stream) const noexcept;
+	bool doCanRead(const char* type) const noexcept;
 
-    virtual void update() noexcept;
+	bool doLoad(StreamReader& stream, Model& model) noexcept;
+	bool doSave(StreamWrite& stream, const Model& model) noexcept;
 
-protected:
-
-    std::size_t _frustumCulledCount;
-
-    std::unique_ptr<OcclusionTree> _tree;
-
-    std::queue<OcclusionObjectPtr> _distanceQueue;
+private:
+	ClipHandler(const ClipHandler&) = delete;
+	ClipHandler& operator=(const ClipHandler&) = delete;
 };
 
 _NAME_END
 
-#endif
\ No newline at end of file
+#endif
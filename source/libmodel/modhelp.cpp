@@ -35,6 +35,7 @@
 // | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // +----------------------------------------------------------------------
 #include <ray/modhelp.h>
+#include <ray/mesh_bvh.h>
 
 _NAME_BEGIN
 
@@ -421,6 +422,7 @@ void
 MeshProperty::setVertexArray(const Float3Array& array) noexcept
 {
 	_vertices = array;
+	_bvh.reset();
 }
 
 void
@@ -452,6 +454,7 @@ void
 MeshProperty::setIndicesArray(const UintArray& array) noexcept
 {
 	_indices = array;
+	_bvh.reset();
 }
 
 void
@@ -464,6 +467,7 @@ void
 MeshProperty::setMeshSubsets(const MeshSubsets& subsets) noexcept
 {
 	_meshSubsets = subsets;
+	_bvh.reset();
 }
 
 void
@@ -476,6 +480,7 @@ void
 MeshProperty::setVertexArray(Float3Array&& array) noexcept
 {
 	_vertices = std::move(array);
+	_bvh.reset();
 }
 
 void
@@ -507,6 +512,7 @@ void
 MeshProperty::setIndicesArray(UintArray&& array) noexcept
 {
 	_indices = std::move(array);
+	_bvh.reset();
 }
 
 void
@@ -525,6 +531,7 @@ void
 MeshProperty::setMeshSubsets(MeshSubsets&& subsets) noexcept
 {
 	_meshSubsets = std::move(subsets);
+	_bvh.reset();
 }
 
 Float3Array&
@@ -649,6 +656,12 @@ MeshProperty::getBoundingBox() const noexcept
 	return _boundingBox;
 }
 
+const MeshBVHPtr&
+MeshProperty::getBVH() const noexcept
+{
+	return _bvh;
+}
+
 void
 MeshProperty::clear() noexcept
 {
@@ -657,6 +670,7 @@ MeshProperty::clear() noexcept
 	_colors = Float4Array();
 	_tangents = Float4Array();
 	_indices = UintArray();
+	_bvh.reset();
 
 	for (std::size_t i = 0; i < 8; i++)
 		_texcoords[i] = Float2Array();
@@ -677,6 +691,7 @@ MeshProperty::clone() noexcept
 	mesh->setIndicesArray(this->getIndicesArray());
 	mesh->_boundingBox = this->_boundingBox;
 	mesh->_meshSubsets = this->_meshSubsets;
+	mesh->_bvh = this->_bvh;
 
 	return mesh;
 }
@@ -1655,4 +1670,14 @@ MeshProperty::computeBoundingBox() noexcept
 		_boundingBox.encapsulate(it.boundingBox);
 }
 
+void
+MeshProperty::computeBVH() noexcept
+{
+	auto bvh = std::make_shared<MeshBVH>();
+	if (bvh->build(*this))
+		_bvh = std::move(bvh);
+	else
+		_bvh.reset();
+}
+
 _NAME_END
\ No newline at end of file
@@ -45,9 +45,11 @@ class MotionState final : public btMotionState
 public:
 	btTransform _graphicsWorldTrans;
 	PhysicsBody* _userPointer;
+	bool _needFetchResult;
 
 	MotionState(PhysicsBody* body)
 		: _userPointer(body)
+		, _needFetchResult(false)
 	{
 		_graphicsWorldTrans.setIdentity();
 	}
@@ -71,10 +73,7 @@ private:
 	virtual void setWorldTransform(const btTransform& centerOfMassWorldTrans)
 	{
 		_graphicsWorldTrans = centerOfMassWorldTrans;
-
-		auto listener = _userPointer->getRigidbodyListener();
-		if (listener)
-			listener->onFetchResult();
+		_needFetchResult = true;
 	}
 
 private:
@@ -95,6 +94,7 @@ PhysicsBody::PhysicsBody() noexcept
 	, _gravity(Vector3::Zero)
 	, _linearVelocity(Vector3::Zero)
 	, _angularVelocity(Vector3::Zero)
+	, _worldTransform(float4x4::One)
 	, _sleep(false)
 	, _rigidbody(nullptr)
 	, _listener(nullptr)
@@ -152,6 +152,8 @@ PhysicsBody::close() noexcept
 void
 PhysicsBody::setMass(float value) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 	{
 		btVector3 btv3LocalInertia;
@@ -172,6 +174,8 @@ PhysicsBody::setMass(float value) noexcept
 void
 PhysicsBody::setRestitution(float value) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 		_rigidbody->setRestitution(value);
 	_restitution = value;
@@ -180,6 +184,8 @@ PhysicsBody::setRestitution(float value) noexcept
 void
 PhysicsBody::setLinearVelocity(const Vector3& value) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 	{
 		btVector3 velocity;
@@ -196,6 +202,8 @@ PhysicsBody::setLinearVelocity(const Vector3& value) noexcept
 void
 PhysicsBody::setAngularVelocity(const Vector3& value) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 	{
 		btVector3 velocity;
@@ -212,6 +220,8 @@ PhysicsBody::setAngularVelocity(const Vector3& value) noexcept
 void
 PhysicsBody::setLinearDamping(float damping) noexcept
 {
+	this->waitSimulation();
+
 	if (damping < 0.f)
 		damping = 0.f;
 
@@ -224,6 +234,8 @@ PhysicsBody::setLinearDamping(float damping) noexcept
 void
 PhysicsBody::setAngularDamping(float damping) noexcept
 {
+	this->waitSimulation();
+
 	if (damping < 0.f)
 		damping = 0.f;
 
@@ -236,6 +248,8 @@ PhysicsBody::setAngularDamping(float damping) noexcept
 void
 PhysicsBody::setFriction(float value) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 		_rigidbody->setFriction(value);
 	_friction = value;
@@ -244,6 +258,8 @@ PhysicsBody::setFriction(float value) noexcept
 void
 PhysicsBody::setGravity(const Vector3& value) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 	{
 		btVector3 gravity;
@@ -260,12 +276,17 @@ PhysicsBody::setGravity(const Vector3& value) noexcept
 void
 PhysicsBody::setWorldTransform(const float4x4& value) noexcept
 {
+	this->waitSimulation();
+
+	_worldTransform = value;
 	_motion->setFromOpenGLMatrix(value);
 }
 
 void
 PhysicsBody::isKinematic(bool isKinematic) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 	{
 		if (isKinematic)
@@ -286,6 +307,8 @@ PhysicsBody::isKinematic() const noexcept
 void
 PhysicsBody::sleep(bool sleep) noexcept
 {
+	this->waitSimulation();
+
 	if (_rigidbody)
 	{
 		if (sleep)
@@ -351,12 +374,14 @@ PhysicsBody::getAngularVelocity() const noexcept
 void
 PhysicsBody::getWorldTransform(float4x4& m) const noexcept
 {
-	_motion->getFromOpenGLMatrix(m);
+	m = _worldTransform;
 }
 
 void
 PhysicsBody::addForce(const Vector3& value) noexcept
 {
+	this->waitSimulation();
+
 	assert(_rigidbody);
 
 	btVector3 force;
@@ -370,6 +395,8 @@ PhysicsBody::addForce(const Vector3& value) noexcept
 void
 PhysicsBody::addRelativeForce(const Vector3& value, const Vector3& axis) noexcept
 {
+	this->waitSimulation();
+
 	assert(_rigidbody);
 
 	btVector3 force;
@@ -388,6 +415,8 @@ PhysicsBody::addRelativeForce(const Vector3& value, const Vector3& axis) noexcep
 void
 PhysicsBody::addTorque(const Vector3& value) noexcept
 {
+	this->waitSimulation();
+
 	assert(_rigidbody);
 
 	btVector3 torque;
@@ -401,6 +430,8 @@ PhysicsBody::addTorque(const Vector3& value) noexcept
 void
 PhysicsBody::addImpulse(const Vector3& value, const Vector3& axis) noexcept
 {
+	this->waitSimulation();
+
 	assert(_rigidbody);
 
 	btVector3 force;
@@ -478,4 +509,25 @@ PhysicsBody::getRigidbody() noexcept
 	return _rigidbody.get();
 }
 
+void
+PhysicsBody::fetchResult() noexcept
+{
+	if (_motion->_needFetchResult)
+	{
+		_motion->getFromOpenGLMatrix(_worldTransform);
+		_motion->_needFetchResult = false;
+
+		if (_listener)
+			_listener->onFetchResult();
+	}
+}
+
+void
+PhysicsBody::waitSimulation() const noexcept
+{
+	auto scene = _scene.lock();
+	if (scene)
+		scene->wait();
+}
+
 _NAME_END
\ No newline at end of file
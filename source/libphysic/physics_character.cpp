@@ -131,6 +131,8 @@ PhysicsCharacter::setHeight(float height) noexcept
 void
 PhysicsCharacter::setMovePosition(const Vector3& pos) noexcept
 {
+	this->waitSimulation();
+
 	if (_character)
 	{
 		btVector3 origin(pos.x, pos.y, pos.z);
@@ -147,6 +149,8 @@ PhysicsCharacter::setMovePosition(const Vector3& pos) noexcept
 void
 PhysicsCharacter::setWalkDirection(const Vector3& direction) noexcept
 {
+	this->waitSimulation();
+
 	if (_character)
 	{
 		btVector3 walkDirection;
@@ -169,6 +173,8 @@ PhysicsCharacter::getWalkDirection() const noexcept
 const Vector3&
 PhysicsCharacter::getMovePosition() const noexcept
 {
+	this->waitSimulation();
+
 	if (_character)
 	{
 		auto transform = _character->getGhostObject()->getWorldTransform();
@@ -185,12 +191,16 @@ PhysicsCharacter::getMovePosition() const noexcept
 bool
 PhysicsCharacter::canJumping() const noexcept
 {
+	this->waitSimulation();
+
 	return _character->onGround() && !this->wasJumping();
 }
 
 bool
 PhysicsCharacter::wasJumping() const noexcept
 {
+	this->waitSimulation();
+
 	assert(_character);
 	return _character->wasJumping();
 }
@@ -198,11 +208,21 @@ PhysicsCharacter::wasJumping() const noexcept
 void
 PhysicsCharacter::jump(float speed) noexcept
 {
+	this->waitSimulation();
+
 	assert(_character);
 	_character->setJumpSpeed(10);
 	_character->jump();
 }
 
+void
+PhysicsCharacter::waitSimulation() const noexcept
+{
+	auto scene = _scene.lock();
+	if (scene)
+		scene->wait();
+}
+
 void
 PhysicsCharacter::setPhysicsScene(PhysicsScenePtr scene) noexcept
 {
@@ -36,6 +36,7 @@
 // +----------------------------------------------------------------------
 #include <ray/physics_scene.h>
 #include <ray/physics_system.h>
+#include <ray/radix_sort.h>
 #include "bullet_types.h"
 
 _NAME_BEGIN
@@ -45,6 +46,9 @@ PhysicsScene::Setting::Setting() noexcept
 	, mass(1000.0f)
 	, speed(10.0f)
 	, skinWidth(0.0001f)
+	, fixedTimeStep(1.0f / 60.0f)
+	, maxSubSteps(4)
+	, async(false)
 	, gravity(0.0f, -9.81f, 0.0f)
 {
 	aabb.min = Vector3(-1000, -1000, -1000);
@@ -58,6 +62,8 @@ PhysicsScene::PhysicsScene() noexcept
 	, _solver(nullptr)
 	, _dynamicsWorld(nullptr)
 	, _isFetchResult(false)
+	, _isSimulating(false)
+	, _needFetchResult(false)
 {
 }
 
@@ -91,6 +97,23 @@ PhysicsScene::setup(const Setting& setting) noexcept
 void
 PhysicsScene::close() noexcept
 {
+	this->wait();
+
+	if (_simulationThread)
+	{
+		_simulationThread->stop();
+		_simulationThread.reset();
+	}
+
+	_contactPairs.clear();
+	_lastContactPairs.clear();
+	_contactEvents.clear();
+
+	for (auto& it : _contacts)
+		it.clear();
+
+	_needFetchResult = false;
+
 	if (_collisionConfiguration)
 	{
 		delete _collisionConfiguration;
@@ -149,12 +172,36 @@ PhysicsScene::setSkitWindow(float width) noexcept
 void
 PhysicsScene::setGravity(const Vector3& v) noexcept
 {
+	this->wait();
+
 	if (_dynamicsWorld)
 		_dynamicsWorld->setGravity(btVector3(v.x, v.y, v.z));
 
 	_setting.gravity = v;
 }
 
+void
+PhysicsScene::setFixedTimeStep(float step) noexcept
+{
+	assert(step > 0.0f);
+	_setting.fixedTimeStep = step;
+}
+
+void
+PhysicsScene::setMaxSubSteps(std::uint32_t steps) noexcept
+{
+	_setting.maxSubSteps = steps;
+}
+
+void
+PhysicsScene::setAsync(bool async) noexcept
+{
+	if (!async)
+		this->fetchResult();
+
+	_setting.async = async;
+}
+
 float
 PhysicsScene::getLength() const noexcept
 {
@@ -185,12 +232,36 @@ PhysicsScene::getGravity() const noexcept
 	return _setting.gravity;
 }
 
+float
+PhysicsScene::getFixedTimeStep() const noexcept
+{
+	return _setting.fixedTimeStep;
+}
+
+std::uint32_t
+PhysicsScene::getMaxSubSteps() const noexcept
+{
+	return _setting.maxSubSteps;
+}
+
+bool
+PhysicsScene::getAsync() const noexcept
+{
+	return _setting.async;
+}
+
 bool 
 PhysicsScene::isFetchResult() const noexcept
 {
 	return _isFetchResult;
 }
 
+bool
+PhysicsScene::isSimulating() const noexcept
+{
+	return _isSimulating;
+}
+
 /*int
 PhysicsScene::raycast(const Vector3& rayFromWorld, const Vector3& rayToWorld, RaycastHit& hit)
 {
@@ -277,18 +348,21 @@ PhysicsScene::raycastAll(const Vector3& rayFromWorld, const Vector3& rayToWorld,
 void 
 PhysicsScene::addJoint(btTypedConstraint* joint) noexcept
 {
+	this->wait();
 	_dynamicsWorld->addConstraint(joint);
 }
 
 void 
 PhysicsScene::removeJoint(btTypedConstraint* joint) noexcept
 {
+	this->wait();
 	_dynamicsWorld->removeConstraint(joint);
 }
 
 void
 PhysicsScene::addRigidbody(PhysicsBody* body) noexcept
 {
+	this->wait();
 	_dynamicsWorld->addRigidBody(body->getRigidbody(), 1 << body->getLayer(), body->getLayerMask());
 	_rigidbodys.push_back(body);
 }
@@ -296,6 +370,8 @@ PhysicsScene::addRigidbody(PhysicsBody* body) noexcept
 void
 PhysicsScene::removeRigidbody(PhysicsBody* body) noexcept
 {
+	this->wait();
+
 	_dynamicsWorld->removeRigidBody(body->getRigidbody());
 
 	auto it = std::find(_rigidbodys.begin(), _rigidbodys.end(), body);
@@ -303,82 +379,324 @@ PhysicsScene::removeRigidbody(PhysicsBody* body) noexcept
 	{
 		_rigidbodys.erase(it);
 	}
+
+	auto object = body->getRigidbody();
+
+	PhysicsContacts exits;
+	for (auto& pair : _lastContactPairs)
+	{
+		if (pair.object0 != object && pair.object1 != object)
+			continue;
+
+		auto contact = pair.contact;
+		if (contact.body0 == body)
+		{
+			std::swap(contact.body0, contact.body1);
+			contact.normal = -contact.normal;
+		}
+
+		if (contact.body0 && contact.body0 != body)
+			exits.push_back(contact);
+	}
+
+	_lastContactPairs.erase(std::remove_if(_lastContactPairs.begin(), _lastContactPairs.end(), [object](const ContactPair& pair)
+	{
+		return pair.object0 == object || pair.object1 == object;
+	}), _lastContactPairs.end());
+
+	for (auto& contacts : _contacts)
+	{
+		for (auto& contact : contacts)
+		{
+			if (contact.body0 == body) contact.body0 = nullptr;
+			if (contact.body1 == body) contact.body1 = nullptr;
+		}
+	}
+
+	for (auto& it : _contactEvents)
+	{
+		if (it.body == body)
+			it.body = nullptr;
+	}
+
+	// the pairs are gone, so the next step would never report these, tell the partners now
+	for (auto& contact : exits)
+	{
+		auto listener = contact.body0->getRigidbodyListener();
+		if (listener)
+			listener->onCollisionExit(&contact, 1);
+	}
 }
 
 void
 PhysicsScene::addCharacter(btCollisionObject* object) noexcept
 {
+	this->wait();
 	_dynamicsWorld->addCollisionObject(object, btBroadphaseProxy::CharacterFilter, btBroadphaseProxy::StaticFilter | btBroadphaseProxy::DefaultFilter);
 }
 
 void
 PhysicsScene::removeCharacter(btCollisionObject* object) noexcept
 {
+	this->wait();
 	_dynamicsWorld->removeCollisionObject(object);
 }
 
 void
 PhysicsScene::addAction(btActionInterface* action) noexcept
 {
+	this->wait();
 	_dynamicsWorld->addAction(action);
 }
 
 void
 PhysicsScene::removeAction(btActionInterface* action) noexcept
 {
+	this->wait();
 	_dynamicsWorld->removeAction(action);
 }
 
 void
 PhysicsScene::simulation(float delta) noexcept
 {
-	_isFetchResult = true;
+	assert(_dynamicsWorld);
 
-	/*if (_isEnableForce)
+	if (_setting.async)
+	{
+		this->fetchResult();
+
+		if (!_simulationThread)
+		{
+			_simulationThread = std::make_unique<ThreadPool>();
+			_simulationThread->start(1);
+		}
+
+		_isSimulating = true;
+		_needFetchResult = true;
+
+		_simulationThread->exce(_simulationGroup, [this, delta]()
+		{
+			this->_simulation(delta);
+		});
+	}
+	else
 	{
-		_body->addForce(_constantForce);
-		_body->addTorque(_constantTorque);
-		_body->setLinearVelocity(_body->getLinearVelocity() + _constantVelocity);
-		_body->setAngularVelocity(_body->getAngularVelocity() + _constantAngularVelocity);
-	}*/
+		this->wait();
 
-	_dynamicsWorld->stepSimulation(delta);
+		_needFetchResult = true;
+		this->_simulation(delta);
+		this->fetchResult();
+	}
+}
 
-	auto dispatcher = _dynamicsWorld->getDispatcher();
-	if (dispatcher)
+void
+PhysicsScene::wait() noexcept
+{
+	if (_isSimulating)
 	{
-		auto numManifolds = _dispatcher->getNumManifolds();
-		for (int i = 0; i < numManifolds; i++)
+		_simulationThread->wait(_simulationGroup);
+		_isSimulating = false;
+	}
+}
+
+void
+PhysicsScene::fetchResult() noexcept
+{
+	this->wait();
+
+	if (!_needFetchResult)
+		return;
+
+	_isFetchResult = true;
+	_needFetchResult = false;
+
+	for (std::size_t i = 0; i < _rigidbodys.size(); i++)
+		_rigidbodys[i]->fetchResult();
+
+	this->_dispatchContacts();
+
+	_isFetchResult = false;
+}
+
+void
+PhysicsScene::_simulation(float delta) noexcept
+{
+	_dynamicsWorld->stepSimulation(delta, _setting.maxSubSteps, _setting.fixedTimeStep);
+
+	this->_updateContacts();
+}
+
+void
+PhysicsScene::_updateContacts() noexcept
+{
+	_contactPairs.clear();
+
+	auto numManifolds = _dispatcher->getNumManifolds();
+	for (int i = 0; i < numManifolds; i++)
+	{
+		auto manifold = _dispatcher->getManifoldByIndexInternal(i);
+
+		auto numContacts = manifold->getNumContacts();
+		if (numContacts == 0)
+			continue;
+
+		auto object0 = manifold->getBody0();
+		auto object1 = manifold->getBody1();
+
+		auto body0 = (PhysicsBody*)object0->getUserPointer();
+		auto body1 = (PhysicsBody*)object1->getUserPointer();
+		if (!body0 && !body1)
+			continue;
+
+		bool swap = object1 < object0;
+
+		ContactPair pair;
+		pair.object0 = swap ? object1 : object0;
+		pair.object1 = swap ? object0 : object1;
+		pair.contact.body0 = swap ? body1 : body0;
+		pair.contact.body1 = swap ? body0 : body1;
+		pair.contact.distance = FLT_MAX;
+		pair.contact.impulse = 0.0f;
+		pair.contact.numContacts = numContacts;
+
+		for (int j = 0; j < numContacts; j++)
 		{
-			auto contactManifold = _dispatcher->getManifoldByIndexInternal(i);
-			if (contactManifold->getNumContacts() == 0)
-				continue;
+			auto& point = manifold->getContactPoint(j);
+
+			pair.contact.impulse += point.getAppliedImpulse();
+
+			if (point.getDistance() < pair.contact.distance)
+			{
+				auto& position = swap ? point.getPositionWorldOnB() : point.getPositionWorldOnA();
+				auto normal = swap ? -point.m_normalWorldOnB : point.m_normalWorldOnB;
+
+				pair.contact.point = Vector3(position.x(), position.y(), position.z());
+				pair.contact.normal = Vector3(normal.x(), normal.y(), normal.z());
+				pair.contact.distance = point.getDistance();
+			}
+		}
+
+		_contactPairs.push_back(pair);
+	}
+
+	auto less = [](const ContactPair& a, const ContactPair& b)
+	{
+		return a.object0 < b.object0 || (a.object0 == b.object0 && a.object1 < b.object1);
+	};
+
+	std::sort(_contactPairs.begin(), _contactPairs.end(), less);
 
-			auto objA = contactManifold->getBody0();
-			auto objB = contactManifold->getBody1();
+	if (!_contactPairs.empty())
+	{
+		std::size_t count = 1;
 
-			auto objAPointer = objA->getUserPointer();
-			auto objBPointer = objB->getUserPointer();
+		for (std::size_t i = 1; i < _contactPairs.size(); i++)
+		{
+			auto& last = _contactPairs[count - 1];
+			auto& pair = _contactPairs[i];
 
-			if (objAPointer)
+			if (last.object0 == pair.object0 && last.object1 == pair.object1)
 			{
-				PhysicsBody* bodyA = (PhysicsBody*)objAPointer;
-				auto listenerA = bodyA->getRigidbodyListener();
-				if (listenerA)
-					listenerA->onCollisionStay();
+				last.contact.impulse += pair.contact.impulse;
+				last.contact.numContacts += pair.contact.numContacts;
+
+				if (pair.contact.distance < last.contact.distance)
+				{
+					last.contact.point = pair.contact.point;
+					last.contact.normal = pair.contact.normal;
+					last.contact.distance = pair.contact.distance;
+				}
 			}
+			else
+			{
+				_contactPairs[count++] = pair;
+			}
+		}
+
+		_contactPairs.resize(count);
+	}
+
+	for (auto& it : _contacts)
+		it.clear();
+
+	std::size_t i = 0;
+	std::size_t j = 0;
+
+	while (i < _lastContactPairs.size() || j < _contactPairs.size())
+	{
+		if (j == _contactPairs.size() || (i < _lastContactPairs.size() && less(_lastContactPairs[i], _contactPairs[j])))
+			_contacts[ContactTypeExit].push_back(_lastContactPairs[i++].contact);
+		else if (i == _lastContactPairs.size() || less(_contactPairs[j], _lastContactPairs[i]))
+			_contacts[ContactTypeEnter].push_back(_contactPairs[j++].contact);
+		else
+		{
+			_contacts[ContactTypeStay].push_back(_contactPairs[j++].contact);
+			i++;
+		}
+	}
+
+	_lastContactPairs.swap(_contactPairs);
+}
+
+void
+PhysicsScene::_dispatchContacts() noexcept
+{
+	_contactEvents.clear();
+
+	for (std::uint8_t type = ContactTypeEnter; type <= ContactTypeExit; type++)
+	{
+		auto& contacts = _contacts[type];
+		for (std::uint32_t i = 0; i < contacts.size(); i++)
+		{
+			auto body0 = contacts[i].body0;
+			auto body1 = contacts[i].body1;
+
+			if (body0 && body0->getRigidbodyListener())
+				_contactEvents.push_back(ContactEvent{ (std::uint64_t)body0, body0, type, false, i });
+
+			if (body1 && body1->getRigidbodyListener())
+				_contactEvents.push_back(ContactEvent{ (std::uint64_t)body1, body1, type, true, i });
+		}
+	}
+
+	// events are pushed in type and index order, so a stable sort on the body alone groups them per listener call
+	radixSort64(_contactEvents, _contactEventsTemp);
 
-			if (objBPointer)
+	for (std::size_t i = 0; i < _contactEvents.size();)
+	{
+		auto body = _contactEvents[i].body;
+		auto type = _contactEvents[i].type;
+
+		_contactBatch.clear();
+
+		for (; i < _contactEvents.size() && _contactEvents[i].body == body && _contactEvents[i].type == type; i++)
+		{
+			auto contact = _contacts[type][_contactEvents[i].index];
+			if (_contactEvents[i].swap)
 			{
-				PhysicsBody* bodyB = (PhysicsBody*)objBPointer;
-				auto listenerB = bodyB->getRigidbodyListener();
-				if (listenerB)
-					listenerB->onCollisionStay();
+				std::swap(contact.body0, contact.body1);
+				contact.normal = -contact.normal;
 			}
+
+			_contactBatch.push_back(contact);
 		}
+
+		if (!body)
+			continue;
+
+		auto listener = body->getRigidbodyListener();
+		if (!listener)
+			continue;
+
+		if (type == ContactTypeEnter)
+			listener->onCollisionEnter(_contactBatch.data(), _contactBatch.size());
+		else if (type == ContactTypeStay)
+			listener->onCollisionStay(_contactBatch.data(), _contactBatch.size());
+		else
+			listener->onCollisionExit(_contactBatch.data(), _contactBatch.size());
 	}
 
-	_isFetchResult = false;
+	_contactEvents.clear();
 }
 
 _NAME_END
\ No newline at end of file
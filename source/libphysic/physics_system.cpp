@@ -68,6 +68,8 @@ PhysicsSystem::open() noexcept
 void
 PhysicsSystem::close() noexcept
 {
+	if (_scene)
+		_scene->wait();
 }
 
 PhysicsScenePtr
@@ -91,4 +93,11 @@ PhysicsSystem::simulation(float delta) noexcept
 		_scene->simulation(delta);
 }
 
+void
+PhysicsSystem::fetchResult() noexcept
+{
+	if (_scene)
+		_scene->fetchResult();
+}
+
 _NAME_END
\ No newline at end of file
@@ -0,0 +1,599 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/cookedreader.h>
+#include <ray/fstream.h>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+_NAME_BEGIN
+
+// Cooked archives are a flat image: header, string table, then a node table.
+// Every record is 4-byte aligned so the image can be used in place once read or mapped.
+// Containers own a contiguous run of child nodes, so no per-node pointers are stored.
+// Object members are sorted by key, so keyed lookups binary search the node table.
+
+const std::uint32_t COOKED_MAGIC = 0x4E435352; // "RSCN"
+const std::uint32_t COOKED_VERSION = 2;
+const std::uint32_t COOKED_NOKEY = 0xFFFFFFFF;
+
+struct CookedHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint32_t numNodes;
+	std::uint32_t numStrings;
+	std::uint32_t stringBytes;
+	std::uint32_t reserved;
+};
+
+struct CookedNode
+{
+	std::uint8_t type;
+	std::uint8_t reserved[3];
+	std::uint32_t key;
+	std::uint32_t value;
+	std::uint32_t count;
+};
+
+class CookedImage
+{
+public:
+	CookedImage(const char* data, std::size_t length) except
+	{
+		if (length < sizeof(CookedHeader))
+			throw failure("cooked archive is truncated");
+
+		_header = reinterpret_cast<const CookedHeader*>(data);
+		if (_header->magic != COOKED_MAGIC)
+			throw failure("invalid cooked archive magic");
+
+		if (_header->version != COOKED_VERSION)
+			throw failure("unsupported cooked archive version");
+
+		std::size_t offsetBytes = (std::size_t(_header->numStrings) + 1) * sizeof(std::uint32_t);
+		std::size_t stringBytes = (std::size_t(_header->stringBytes) + 3) & ~std::size_t(3);
+		std::size_t nodeBytes = std::size_t(_header->numNodes) * sizeof(CookedNode);
+
+		if (length < sizeof(CookedHeader) + offsetBytes + stringBytes + nodeBytes || _header->numNodes == 0)
+			throw failure("cooked archive is truncated");
+
+		_offsets = reinterpret_cast<const std::uint32_t*>(data + sizeof(CookedHeader));
+		_strings = data + sizeof(CookedHeader) + offsetBytes;
+		_nodes = reinterpret_cast<const CookedNode*>(_strings + stringBytes);
+
+		for (std::uint32_t i = 0; i < _header->numStrings; i++)
+		{
+			if (_offsets[i] >= _offsets[i + 1] || _offsets[i + 1] > _header->stringBytes)
+				throw failure("cooked archive has a corrupt string table");
+
+			if (_strings[_offsets[i + 1] - 1] != 0)
+				throw failure("cooked archive has an unterminated string");
+		}
+	}
+
+	std::uint32_t size() const noexcept
+	{
+		return _header->numNodes;
+	}
+
+	const CookedNode& node(std::uint32_t index) const noexcept
+	{
+		return _nodes[index];
+	}
+
+	std::uint32_t find(std::uint32_t index, const char* key) const except
+	{
+		const auto& node = _nodes[index];
+		if (node.type != archivebuf::type_t::object)
+			return CookedReader::npos;
+
+		this->check(index, node);
+
+		std::uint32_t first = node.value;
+		std::uint32_t last = node.value + node.count;
+
+		while (first < last)
+		{
+			std::uint32_t mid = first + (last - first) / 2;
+
+			auto key_index = _nodes[mid].key;
+			if (key_index >= _header->numStrings)
+				throw failure("cooked archive string index out of range");
+
+			int result = std::strcmp(_strings + _offsets[key_index], key);
+			if (result == 0)
+				return mid;
+			else if (result < 0)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+
+		return CookedReader::npos;
+	}
+
+	archivebuf::string_t string(std::uint32_t index) const except
+	{
+		if (index >= _header->numStrings)
+			throw failure("cooked archive string index out of range");
+
+		return archivebuf::string_t(_strings + _offsets[index], _offsets[index + 1] - _offsets[index] - 1);
+	}
+
+	void read(archivebuf& buf, std::uint32_t index) const except
+	{
+		const auto& node = _nodes[index];
+
+		switch (node.type)
+		{
+		case archivebuf::type_t::null:
+			break;
+		case archivebuf::type_t::boolean:
+			buf = node.value ? true : false;
+			break;
+		case archivebuf::type_t::number_integer:
+			buf = static_cast<archivebuf::number_integer_t>(node.value);
+			break;
+		case archivebuf::type_t::number_unsigned:
+			buf = static_cast<archivebuf::number_unsigned_t>(node.value);
+			break;
+		case archivebuf::type_t::number_float:
+		{
+			archivebuf::number_float_t value;
+			std::memcpy(&value, &node.value, sizeof(value));
+			buf = value;
+		}
+		break;
+		case archivebuf::type_t::string:
+			buf = this->string(node.value);
+			break;
+		case archivebuf::type_t::array:
+		{
+			this->check(index, node);
+
+			buf.emplace(archivebuf::type_t::array);
+
+			auto& values = buf.get<archivebuf::array_t>();
+			values.reserve(node.count);
+
+			for (std::uint32_t i = 0; i < node.count; i++)
+			{
+				values.emplace_back();
+				this->read(values.back(), node.value + i);
+			}
+		}
+		break;
+		case archivebuf::type_t::object:
+		{
+			this->check(index, node);
+
+			buf.emplace(archivebuf::type_t::object);
+
+			for (std::uint32_t i = 0; i < node.count; i++)
+			{
+				archivebuf value;
+				this->read(value, node.value + i);
+				buf.push_back(this->string(_nodes[node.value + i].key), std::move(value));
+			}
+		}
+		break;
+		default:
+			throw failure("cooked archive has an unknown node type");
+		}
+	}
+
+private:
+	void check(std::uint32_t index, const CookedNode& node) const except
+	{
+		if (node.count == 0)
+			return;
+
+		if (node.value <= index || node.value >= _header->numNodes || node.count > _header->numNodes - node.value)
+			throw failure("cooked archive node children out of range");
+	}
+
+private:
+	const CookedHeader* _header;
+	const std::uint32_t* _offsets;
+	const char* _strings;
+	const CookedNode* _nodes;
+};
+
+class CookedBuilder
+{
+public:
+	void build(const archivebuf& root) except
+	{
+		std::vector<std::pair<const archivebuf*, std::uint32_t>> queue;
+		queue.emplace_back(&root, 0);
+
+		_nodes.emplace_back();
+		_nodes.back().key = COOKED_NOKEY;
+
+		// Breadth-first so that every container's children land in one contiguous run.
+		for (std::size_t head = 0; head < queue.size(); head++)
+		{
+			const archivebuf& buf = *queue[head].first;
+			std::uint32_t index = queue[head].second;
+
+			CookedNode& node = _nodes[index];
+			node.type = static_cast<std::uint8_t>(buf.type());
+
+			switch (buf.type())
+			{
+			case archivebuf::type_t::null:
+				break;
+			case archivebuf::type_t::boolean:
+				node.value = buf.get<archivebuf::boolean_t>() ? 1 : 0;
+				break;
+			case archivebuf::type_t::number_integer:
+				node.value = static_cast<std::uint32_t>(buf.get<archivebuf::number_integer_t>());
+				break;
+			case archivebuf::type_t::number_unsigned:
+				node.value = buf.get<archivebuf::number_unsigned_t>();
+				break;
+			case archivebuf::type_t::number_float:
+			{
+				archivebuf::number_float_t value = buf.get<archivebuf::number_float_t>();
+				std::memcpy(&node.value, &value, sizeof(value));
+			}
+			break;
+			case archivebuf::type_t::string:
+				node.value = this->intern(buf.get<archivebuf::string_t>());
+				break;
+			case archivebuf::type_t::array:
+			{
+				const auto& values = buf.get<archivebuf::array_t>();
+
+				std::uint32_t first = static_cast<std::uint32_t>(_nodes.size());
+				node.value = first;
+				node.count = static_cast<std::uint32_t>(values.size());
+
+				_nodes.resize(_nodes.size() + values.size());
+
+				for (std::size_t i = 0; i < values.size(); i++)
+				{
+					_nodes[first + i].key = COOKED_NOKEY;
+					queue.emplace_back(&values[i], first + static_cast<std::uint32_t>(i));
+				}
+			}
+			break;
+			case archivebuf::type_t::object:
+			{
+				std::uint32_t first = static_cast<std::uint32_t>(_nodes.size());
+				std::uint32_t count = static_cast<std::uint32_t>(std::distance(buf.begin(), buf.end()));
+
+				_nodes[index].value = first;
+				_nodes[index].count = count;
+				_nodes.resize(_nodes.size() + count);
+
+				std::vector<std::pair<const archivebuf::string_t*, const archivebuf*>> members;
+				members.reserve(count);
+
+				for (auto& it : buf)
+					members.emplace_back(&it.first, &it.second);
+
+				std::stable_sort(members.begin(), members.end(), [](const auto& a, const auto& b)
+				{
+					return std::strcmp(a.first->c_str(), b.first->c_str()) < 0;
+				});
+
+				std::uint32_t i = first;
+				for (auto& it : members)
+				{
+					_nodes[i].key = this->intern(*it.first);
+					queue.emplace_back(it.second, i++);
+				}
+			}
+			break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void write(StreamWrite& stream) except
+	{
+		CookedHeader header;
+		header.magic = COOKED_MAGIC;
+		header.version = COOKED_VERSION;
+		header.numNodes = static_cast<std::uint32_t>(_nodes.size());
+		header.numStrings = static_cast<std::uint32_t>(_offsets.size());
+		header.stringBytes = static_cast<std::uint32_t>(_strings.size());
+		header.reserved = 0;
+
+		_offsets.push_back(header.stringBytes);
+		_strings.resize((_strings.size() + 3) & ~std::size_t(3), 0);
+
+		stream.write((const char*)&header, sizeof(header));
+		stream.write((const char*)_offsets.data(), _offsets.size() * sizeof(std::uint32_t));
+		stream.write(_strings.data(), _strings.size());
+		stream.write((const char*)_nodes.data(), _nodes.size() * sizeof(CookedNode));
+
+		if (!stream.good())
+			throw failure("failed to write cooked archive");
+	}
+
+private:
+	std::uint32_t intern(const archivebuf::string_t& value) noexcept
+	{
+		auto it = _stringTable.find(value);
+		if (it != _stringTable.end())
+			return it->second;
+
+		std::uint32_t index = static_cast<std::uint32_t>(_offsets.size());
+		_offsets.push_back(static_cast<std::uint32_t>(_strings.size()));
+		_strings.insert(_strings.end(), value.begin(), value.end());
+		_strings.push_back(0);
+		_stringTable[value] = index;
+
+		return index;
+	}
+
+private:
+	std::vector<CookedNode> _nodes;
+	std::vector<std::uint32_t> _offsets;
+	std::vector<char> _strings;
+	std::unordered_map<archivebuf::string_t, std::uint32_t> _stringTable;
+};
+
+CookedReader::CookedReader() noexcept
+{
+}
+
+CookedReader::CookedReader(StreamReader& stream) except
+{
+	this->open(stream);
+}
+
+CookedReader::CookedReader(const std::string& path) except
+{
+	this->open(path);
+}
+
+CookedReader::~CookedReader() noexcept
+{
+	this->close();
+}
+
+CookedReader&
+CookedReader::open(StreamReader& stream) except
+{
+	try
+	{
+		this->close();
+
+		auto length = stream.size();
+		if (length < static_cast<streamsize>(sizeof(CookedHeader)))
+		{
+			this->setstate(ios_base::failbit);
+			return *this;
+		}
+
+		_data.resize((std::size_t)(length + 3) / sizeof(std::uint32_t));
+		if (!stream.read((char*)_data.data(), (std::streamsize)length))
+		{
+			this->close();
+			this->setstate(ios_base::failbit);
+			return *this;
+		}
+
+		_image = std::make_unique<CookedImage>((const char*)_data.data(), (std::size_t)length);
+
+		this->clear(ios_base::goodbit);
+		return *this;
+	}
+	catch (const std::exception& e)
+	{
+		this->close();
+		this->setstate(ios_base::failbit);
+		throw failure(e.what());
+	}
+}
+
+CookedReader&
+CookedReader::open(const std::string& path) except
+{
+	ifstream stream;
+	if (stream.open(path))
+		return this->open(stream);
+	else
+	{
+		this->setstate(ios_base::failbit);
+		return *this;
+	}
+}
+
+bool
+CookedReader::is_open() const noexcept
+{
+	return _image ? true : false;
+}
+
+void
+CookedReader::close() noexcept
+{
+	_image.reset();
+	_data.clear();
+	_data.shrink_to_fit();
+}
+
+CookedReader::node_t
+CookedReader::root() const noexcept
+{
+	return _image ? 0 : npos;
+}
+
+CookedReader::type_t
+CookedReader::type(node_t node) const noexcept
+{
+	if (!_image || node >= _image->size())
+		return type_t::null;
+	return static_cast<type_t>(_image->node(node).type);
+}
+
+std::size_t
+CookedReader::size(node_t node) const noexcept
+{
+	auto type = this->type(node);
+	if (type != type_t::array && type != type_t::object)
+		return 0;
+	return _image->node(node).count;
+}
+
+CookedReader::node_t
+CookedReader::at(node_t node, std::size_t n) const noexcept
+{
+	if (n >= this->size(node))
+		return npos;
+
+	auto& value = _image->node(node);
+	if (value.value <= node || value.value >= _image->size() || value.count > _image->size() - value.value)
+		return npos;
+
+	return value.value + static_cast<node_t>(n);
+}
+
+CookedReader::node_t
+CookedReader::find(node_t node, const char* key) const noexcept
+{
+	assert(key);
+
+	if (!_image || node >= _image->size())
+		return npos;
+
+	try
+	{
+		return _image->find(node, key);
+	}
+	catch (const std::exception&)
+	{
+		return npos;
+	}
+}
+
+void
+CookedReader::read(node_t node, archivebuf& buf) const except
+{
+	if (!_image || node >= _image->size())
+		throw failure("cooked archive node out of range");
+
+	_image->read(buf, node);
+}
+
+bool
+CookedReader::can_read(StreamReader& stream) noexcept
+{
+	std::uint32_t magic = 0;
+
+	auto pos = stream.tellg();
+	if (!stream.read((char*)&magic, sizeof(magic)))
+		stream.clear();
+
+	stream.seekg(pos, ios_base::beg);
+
+	return magic == COOKED_MAGIC;
+}
+
+CookedWrite::CookedWrite() noexcept
+	: oarchive(&_buf)
+{
+}
+
+CookedWrite::~CookedWrite() noexcept
+{
+	this->close();
+}
+
+CookedWrite&
+CookedWrite::save(StreamWrite& stream) except
+{
+	return this->save(stream, _buf);
+}
+
+CookedWrite&
+CookedWrite::save(const std::string& path) except
+{
+	return this->save(path, _buf);
+}
+
+CookedWrite&
+CookedWrite::save(StreamWrite& stream, const archivebuf& buf) except
+{
+	try
+	{
+		CookedBuilder builder;
+		builder.build(buf);
+		builder.write(stream);
+
+		ios_base::clear(ios_base::goodbit);
+		return *this;
+	}
+	catch (const std::exception& e)
+	{
+		this->setstate(ios_base::failbit);
+		throw failure(e.what());
+	}
+}
+
+CookedWrite&
+CookedWrite::save(const std::string& path, const archivebuf& buf) except
+{
+	ofstream stream;
+	if (stream.open(path))
+		return this->save(stream, buf);
+	else
+	{
+		this->setstate(ios_base::failbit);
+		return *this;
+	}
+}
+
+void
+CookedWrite::close() noexcept
+{
+	_buf.clear();
+}
+
+bool
+CookedWrite::is_open() const noexcept
+{
+	return _buf.size();
+}
+
+_NAME_END
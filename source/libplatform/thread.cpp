@@ -38,172 +38,226 @@
 
 _NAME_BEGIN
 
-ThreadLambda::ThreadLambda() noexcept
-	: _isQuitRequest(false)
-	, _isFlushRequest(false)
+__ImplementSingleton(ThreadPool)
+
+// worker index of the calling thread, the owner pushes and pops at the back of its
+// own queue while other threads steal from the front.
+static thread_local ThreadPool* _threadPool = nullptr;
+static thread_local std::size_t _threadIndex = 0;
+
+ThreadTaskGroup::ThreadTaskGroup() noexcept
+	: _pending(0)
 {
 }
 
-ThreadLambda::~ThreadLambda() noexcept
+ThreadTaskGroup::~ThreadTaskGroup() noexcept
 {
-	this->stop();
+	assert(this->done());
 }
 
-void
-ThreadLambda::start() noexcept
+bool
+ThreadTaskGroup::done() const noexcept
 {
-	if (!_thread)
-		_thread = std::make_unique<std::thread>(std::bind(&ThreadLambda::dispose, this));
+	return _pending == 0;
 }
 
-void
-ThreadLambda::stop() noexcept
+std::exception_ptr
+ThreadTaskGroup::exception() const noexcept
 {
-	this->flush();
-	this->signalQuitCond();
-	this->join();
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _exception;
 }
 
-void
-ThreadLambda::exce(std::function<void(void)>& func) noexcept
+ThreadPool::ThreadPool() noexcept
+	: _isQuitRequest(false)
+	, _taskCount(0)
+	, _taskNext(0)
 {
-	_mutex.lock();
-	_taskUpdate.push_back(func);
-	_mutex.unlock();
 }
 
-void
-ThreadLambda::exce(std::function<void(void)>&& func) noexcept
+ThreadPool::~ThreadPool() noexcept
 {
-	_mutex.lock();
-	_taskUpdate.push_back(std::move(func));
-	_mutex.unlock();
+	this->stop();
 }
 
 void
-ThreadLambda::join() noexcept
+ThreadPool::start(std::size_t threads) noexcept
 {
-	if (_thread)
+	if (!_queues.empty())
+		return;
+
+	if (threads == 0)
 	{
-		_thread->join();
-		_thread = nullptr;
+		std::size_t hardware = std::thread::hardware_concurrency();
+		threads = hardware > 1 ? hardware - 1 : 0;
 	}
+
+	_isQuitRequest = false;
+
+	for (std::size_t i = 0; i <= threads; i++)
+		_queues.push_back(std::make_unique<ThreadQueue>());
+
+	for (std::size_t i = 0; i < threads; i++)
+		_threads.push_back(std::make_unique<std::thread>(std::bind(&ThreadPool::dispose, this, i + 1)));
 }
 
 void
-ThreadLambda::flush() noexcept
+ThreadPool::stop() noexcept
 {
-	if (!_isQuitRequest)
-	{
-		this->waitFlushFinishedCond();
+	_mutex.lock();
+	_isQuitRequest = true;
+	_taskRequest.notify_all();
+	_mutex.unlock();
 
-		_mutex.lock();
-		_taskUpdate.swap(_taskDispose);
-		_mutex.unlock();
+	for (auto& it : _threads)
+		it->join();
 
-		this->signalFlushCond();
-	}
+	_threads.clear();
+
+	ThreadTask task;
+	while (this->pop(task))
+		this->execute(task);
+
+	_queues.clear();
 }
 
-void
-ThreadLambda::finish() noexcept
+std::size_t
+ThreadPool::getThreadCount() const noexcept
 {
-	if (!_isQuitRequest)
-	{
-		this->flush();
-		this->waitFlushFinishedCond();
-	}
+	return _threads.size();
 }
 
-std::exception_ptr
-ThreadLambda::exception() const noexcept
+void
+ThreadPool::exce(ThreadTaskGroup& group, std::function<void(void)>&& func) noexcept
 {
-	return _exception;
+	if (_queues.empty())
+		this->start();
+
+	group._pending++;
+
+	ThreadTask task;
+	task.func = std::move(func);
+	task.group = &group;
+
+	this->push(std::move(task));
 }
 
 void
-ThreadLambda::signalQuitCond() noexcept
+ThreadPool::exce(ThreadTaskGroup& group, std::size_t count, const std::function<void(std::size_t)>& func) noexcept
 {
-	_mutex.lock();
-	_isQuitRequest = true;
-	_flushRequest.notify_one();
-	_mutex.unlock();
+	for (std::size_t i = 0; i < count; i++)
+		this->exce(group, std::bind(func, i));
 }
 
 void
-ThreadLambda::signalFlushCond() noexcept
+ThreadPool::wait(ThreadTaskGroup& group) noexcept
 {
-	_mutex.lock();
-	_isFlushRequest = true;
-	_flushRequest.notify_one();
-	_mutex.unlock();
+	while (!group.done())
+	{
+		ThreadTask task;
+		if (this->pop(task))
+			this->execute(task);
+		else
+			std::this_thread::yield();
+	}
 }
 
 void
-ThreadLambda::signalFlushFinishCond() noexcept
+ThreadPool::push(ThreadTask&& task) noexcept
 {
+	std::size_t index = 0;
+	if (_threadPool == this)
+		index = _threadIndex;
+	else
+		index = _taskNext++ % _queues.size();
+
+	_taskCount++;
+
+	auto& queue = *_queues[index];
+	queue.mutex.lock();
+	queue.tasks.push_back(std::move(task));
+	queue.mutex.unlock();
+
 	_mutex.lock();
-	_isFlushRequest = false;
-	_finishRequest.notify_all();
+	_taskRequest.notify_one();
 	_mutex.unlock();
 }
 
-void
-ThreadLambda::waitFlushCond() noexcept
+bool
+ThreadPool::pop(ThreadTask& task) noexcept
 {
-	std::unique_lock<std::mutex> lock(_mutex);
-	if (lock)
+	if (_taskCount == 0 || _queues.empty())
+		return false;
+
+	std::size_t index = _threadPool == this ? _threadIndex : 0;
+
+	auto& local = *_queues[index];
+	local.mutex.lock();
+	if (!local.tasks.empty())
 	{
-		if (_isQuitRequest)
-			return;
+		task = std::move(local.tasks.back());
+		local.tasks.pop_back();
+		local.mutex.unlock();
 
-		while (!_isFlushRequest)
-		{
-			_flushRequest.wait(lock);
-		}
+		_taskCount--;
+		return true;
 	}
-}
+	local.mutex.unlock();
 
-void
-ThreadLambda::waitFlushFinishedCond() noexcept
-{
-	std::unique_lock<std::mutex> lock(_mutex);
-	if (lock)
+	for (std::size_t i = 1; i < _queues.size(); i++)
 	{
-		if (_isQuitRequest)
-			return;
-
-		while (_isFlushRequest)
+		auto& victim = *_queues[(index + i) % _queues.size()];
+		victim.mutex.lock();
+		if (!victim.tasks.empty())
 		{
-			_finishRequest.wait(lock);
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			victim.mutex.unlock();
+
+			_taskCount--;
+			return true;
 		}
+		victim.mutex.unlock();
 	}
+
+	return false;
 }
 
 void
-ThreadLambda::dispose() noexcept
+ThreadPool::execute(ThreadTask& task) noexcept
 {
 	try
 	{
-		while (!_isQuitRequest)
-		{
-			this->waitFlushCond();
+		task.func();
+	}
+	catch (...)
+	{
+		// only the first failure of a group is kept, the caller reads it from the group after wait
+		std::lock_guard<std::mutex> lock(task.group->_mutex);
+		if (!task.group->_exception)
+			task.group->_exception = std::current_exception();
+	}
 
-			for (auto& it : _taskDispose)
-			{
-				it();
-			}
+	task.group->_pending--;
+}
 
-			_taskDispose.clear();
+void
+ThreadPool::dispose(std::size_t index) noexcept
+{
+	_threadPool = this;
+	_threadIndex = index;
 
-			this->signalFlushFinishCond();
-		}
-	}
-	catch (...)
+	while (!_isQuitRequest)
 	{
-		_isQuitRequest = true;
+		ThreadTask task;
+		if (this->pop(task))
+		{
+			this->execute(task);
+			continue;
+		}
 
-		_exception = std::current_exception();
+		std::unique_lock<std::mutex> lock(_mutex);
+		_taskRequest.wait(lock, [this]() { return _isQuitRequest || _taskCount > 0; });
 	}
 }
 
@@ -58,6 +58,8 @@ Camera::Camera() noexcept
 	, _cameraOrder(CameraOrder::CameraOrder3D)
 	, _cameraClearType(CameraClearFlagBits::CameraClearColorBit)
 	, _cameraRenderFlags(CameraRenderFlagBits::CameraRenderScreenBit)
+	, _visiableAssigned(false)
+	, _isOcclusionCull(true)
 	, _needUpdateViewProject(true)
 	, _project(float4x4::One)
 	, _projectInverse(float4x4::One)
@@ -403,6 +405,18 @@ Camera::getCameraRenderFlags() const noexcept
 	return _cameraRenderFlags;
 }
 
+void
+Camera::setOcclusionCull(bool enable) noexcept
+{
+	_isOcclusionCull = enable;
+}
+
+bool
+Camera::getOcclusionCull() const noexcept
+{
+	return _isOcclusionCull;
+}
+
 void
 Camera::setSwapchain(GraphicsSwapchainPtr swapchin) noexcept
 {
@@ -440,6 +454,22 @@ Camera::getRenderDataManager() const noexcept
 	return _dataManager;
 }
 
+void
+Camera::assginVisiable() noexcept
+{
+	if (_dataManager)
+	{
+		_dataManager->assginVisiable(*this);
+		_visiableAssigned = true;
+	}
+}
+
+void
+Camera::resetVisiable() noexcept
+{
+	_visiableAssigned = false;
+}
+
 void
 Camera::_updateOrtho() const noexcept
 {
@@ -505,7 +535,11 @@ Camera::onRenderBefore(const Camera& camera) noexcept
 
 	if (_dataManager)
 	{
-		_dataManager->assginVisiable(*this);
+		if (!_visiableAssigned)
+			_dataManager->assginVisiable(*this);
+
+		_visiableAssigned = false;
+
 		_dataManager->noticeObjectsRenderBefore(*this);
 	}
 }
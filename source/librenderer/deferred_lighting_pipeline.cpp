@@ -46,16 +46,27 @@
 #include <ray/graphics_state.h>
 #include <ray/graphics_texture.h>
 #include <ray/graphics_framebuffer.h>
+#include <ray/graphics_data.h>
 #include <ray/material.h>
 #include <ray/shadow_render_framebuffer.h>
 #include <ray/reflective_shadow_render_framebuffer.h>
 
 _NAME_BEGIN
 
+// unshadowed point and spot lights are binned into a froxel grid and shaded in one fullscreen pass per layer,
+// light indices are packed as bytes so a pass holds up to 256 lights, more lights or an overflowing index list take additional passes.
+static const std::uint32_t ClusterCountX = 16;
+static const std::uint32_t ClusterCountY = 8;
+static const std::uint32_t ClusterCountZ = 24;
+static const std::uint32_t ClusterMaxLights = 256;
+static const std::uint32_t ClusterMaxIndices = 16384;
+static const std::size_t ClusterMinLights = 4;
+
 DeferredLightingPipeline::DeferredLightingPipeline() noexcept
 	: _mrsiiDerivMipBase(0)
 	, _mrsiiDerivMipCount(4)
 	, _enabledMRSSI(false)
+	, _enabledClusteredLighting(true)
 {
 }
 
@@ -65,12 +76,13 @@ DeferredLightingPipeline::~DeferredLightingPipeline() noexcept
 }
 
 bool
-DeferredLightingPipeline::setup(const RenderPipelinePtr& pipeline, bool enableMRSII) noexcept
+DeferredLightingPipeline::setup(const RenderPipelinePtr& pipeline, bool enableMRSII, bool enableClusteredLighting) noexcept
 {
 	assert(pipeline);
 
 	_pipeline = pipeline;
 	_enabledMRSSI = enableMRSII;
+	_enabledClusteredLighting = enableClusteredLighting;
 
 	if (!this->initTextureFormat(*_pipeline))
 		return false;
@@ -81,6 +93,9 @@ DeferredLightingPipeline::setup(const RenderPipelinePtr& pipeline, bool enableMR
 	if (!this->setupDeferredMaterials(*_pipeline))
 		return false;
 
+	if (!this->setupClusteredLights(*_pipeline))
+		return false;
+
 	if (_enabledMRSSI)
 		return this->setupMRSII(*pipeline);
 
@@ -92,6 +107,7 @@ DeferredLightingPipeline::close() noexcept
 {
 	this->destroySemantic();
 	this->destroyDeferredMaterials();
+	this->destroyClusteredLights();
 	this->destroyMRSIIMaterials();
 	this->destroyMRSIITextures();
 	this->destroyMRSIIRenderTextures();
@@ -315,7 +331,25 @@ DeferredLightingPipeline::renderDirectLights(RenderPipeline& pipeline, const Gra
 {
 	pipeline.setFramebuffer(target);
 
+	_clusteredLights.clear();
+
 	auto& lights = pipeline.getCamera()->getRenderDataManager()->getRenderData(RenderQueue::RenderQueueLights);
+	if (_enabledClusteredLighting && pipeline.getCamera()->getCameraType() == CameraType::CameraTypePerspective)
+	{
+		for (auto& it : lights)
+		{
+			auto light = it->downcast<Light>();
+			if (light->getLightType() == LightType::LightTypePoint ||
+				(light->getLightType() == LightType::LightTypeSpot && light->getShadowMode() == ShadowMode::ShadowModeNone))
+			{
+				_clusteredLights.push_back(light);
+			}
+		}
+
+		if (_clusteredLights.size() < ClusterMinLights)
+			_clusteredLights.clear();
+	}
+
 	for (auto& it : lights)
 	{
 		auto light = it->downcast<Light>();
@@ -328,15 +362,20 @@ DeferredLightingPipeline::renderDirectLights(RenderPipeline& pipeline, const Gra
 			this->renderDirectionalLight(pipeline, *light);
 			break;
 		case LightType::LightTypePoint:
-			this->renderPointLight(pipeline, *light);
+			if (_clusteredLights.empty())
+				this->renderPointLight(pipeline, *light);
 			break;
 		case LightType::LightTypeSpot:
-			this->renderSpotLight(pipeline, *light);
+			if (_clusteredLights.empty() || light->getShadowMode() != ShadowMode::ShadowModeNone)
+				this->renderSpotLight(pipeline, *light);
 			break;
 		default:
 			break;
 		}
 	}
+
+	if (!_clusteredLights.empty())
+		this->renderClusteredLights(pipeline, _clusteredLights);
 }
 
 void
@@ -346,23 +385,7 @@ DeferredLightingPipeline::renderSunLight(RenderPipeline& pipeline, const Light&
 	_lightEyeDirection->uniform3f(math::invRotateVector3(pipeline.getCamera()->getTransform(), light.getForward()));
 	_lightAttenuation->uniform3f(light.getLightAttenuation());
 
-	auto& shadowMap = light.getCamera()->getRenderPipelineFramebuffer()->downcast<ShadowRenderFramebuffer>()->getFramebuffer()->getGraphicsFramebufferDesc().getColorAttachment().getBindingTexture();
-	if (shadowMap)
-	{
-		float shadowFactor = light.getShadowFactor() / (light.getCamera()->getFar() - light.getCamera()->getNear());
-		float shaodwBias = light.getShadowBias();
-
-		_shadowMap->uniformTexture(shadowMap);
-		_shadowFactor->uniform2f(shadowFactor, shaodwBias);
-		_shadowView2LightView->uniform4f(light.getCamera()->getView().getAxisZ() * pipeline.getCamera()->getViewInverse());
-		_shadowView2LightViewProject->uniform4fmat(light.getCamera()->getViewProject() * pipeline.getCamera()->getViewInverse());
-
-		pipeline.drawScreenQuadLayer(*_deferredSunLightShadow, light.getLayer());
-	}
-	else
-	{
-		pipeline.drawScreenQuadLayer(*_deferredSunLight, light.getLayer());
-	}
+	this->renderShadowCascades(pipeline, light, *_deferredSunLight, *_deferredSunLightShadow);
 }
 
 void
@@ -372,23 +395,7 @@ DeferredLightingPipeline::renderDirectionalLight(RenderPipeline& pipeline, const
 	_lightEyeDirection->uniform3f(math::invRotateVector3(pipeline.getCamera()->getTransform(), light.getForward()));
 	_lightAttenuation->uniform3f(light.getLightAttenuation());
 
-	auto& shadowMap = light.getCamera()->getRenderPipelineFramebuffer()->downcast<ShadowRenderFramebuffer>()->getFramebuffer()->getGraphicsFramebufferDesc().getColorAttachment().getBindingTexture();
-	if (shadowMap)
-	{
-		float shadowFactor = light.getShadowFactor() / (light.getCamera()->getFar() - light.getCamera()->getNear());
-		float shaodwBias = light.getShadowBias();
-
-		_shadowMap->uniformTexture(shadowMap);
-		_shadowFactor->uniform2f(shadowFactor, shaodwBias);
-		_shadowView2LightView->uniform4f(light.getCamera()->getView().getAxisZ() * pipeline.getCamera()->getViewInverse());
-		_shadowView2LightViewProject->uniform4fmat(light.getCamera()->getViewProject() * pipeline.getCamera()->getViewInverse());
-
-		pipeline.drawScreenQuadLayer(*_deferredDirectionalLightShadow, light.getLayer());
-	}
-	else
-	{
-		pipeline.drawScreenQuadLayer(*_deferredDirectionalLight, light.getLayer());
-	}
+	this->renderShadowCascades(pipeline, light, *_deferredDirectionalLight, *_deferredDirectionalLightShadow);
 }
 
 void
@@ -420,22 +427,178 @@ DeferredLightingPipeline::renderSpotLight(RenderPipeline& pipeline, const Light&
 
 	pipeline.setTransform(transform);
 
-	auto& shadowMap = light.getCamera()->getRenderPipelineFramebuffer()->downcast<ShadowRenderFramebuffer>()->getFramebuffer()->getGraphicsFramebufferDesc().getColorAttachment().getBindingTexture();
-	if (shadowMap)
-	{
-		float shadowFactor = light.getShadowFactor() / (light.getCamera()->getFar() - light.getCamera()->getNear());
-		float shaodwBias = light.getShadowBias();
+	if (this->bindShadowMap(pipeline, light, light.getCamera()))
+		pipeline.drawCone(*_deferredSpotLightShadow, light.getLayer());
+	else
+		pipeline.drawCone(*_deferredSpotLight, light.getLayer());
+}
 
-		_shadowMap->uniformTexture(shadowMap);
-		_shadowFactor->uniform2f(shadowFactor, shaodwBias);
-		_shadowView2LightView->uniform4f(light.getCamera()->getView().getAxisZ() * pipeline.getCamera()->getViewInverse());
-		_shadowView2LightViewProject->uniform4fmat(light.getCamera()->getViewProject() * pipeline.getCamera()->getViewInverse());
+void
+DeferredLightingPipeline::renderShadowCascades(RenderPipeline& pipeline, const Light& light, const MaterialTech& tech, const MaterialTech& shadowTech) noexcept
+{
+	auto& cascades = light.getShadowCascadeCameras(*pipeline.getCamera());
+	auto& splits = light.getShadowCascadeSplits(*pipeline.getCamera());
 
-		pipeline.drawCone(*_deferredSpotLightShadow, light.getLayer());
+	if (cascades.empty() || splits.size() != cascades.size() + 1)
+	{
+		_shadowCascadeRange->uniform2f(0.0f, std::numeric_limits<float>::max());
+
+		if (this->bindShadowMap(pipeline, light, light.getCamera()))
+			pipeline.drawScreenQuadLayer(shadowTech, light.getLayer());
+		else
+			pipeline.drawScreenQuadLayer(tech, light.getLayer());
 	}
 	else
 	{
-		pipeline.drawCone(*_deferredSpotLight, light.getLayer());
+		// each cascade only lights the pixels between its splits, the pixels beyond the last split are lit without shadow
+		for (std::size_t i = 0; i < cascades.size(); i++)
+		{
+			_shadowCascadeRange->uniform2f(i > 0 ? splits[i] : 0.0f, splits[i + 1]);
+
+			if (this->bindShadowMap(pipeline, light, cascades[i]))
+				pipeline.drawScreenQuadLayer(shadowTech, light.getLayer());
+			else
+				pipeline.drawScreenQuadLayer(tech, light.getLayer());
+		}
+
+		_shadowCascadeRange->uniform2f(splits.back(), std::numeric_limits<float>::max());
+		pipeline.drawScreenQuadLayer(tech, light.getLayer());
+	}
+}
+
+bool
+DeferredLightingPipeline::bindShadowMap(RenderPipeline& pipeline, const Light& light, const CameraPtr& camera) noexcept
+{
+	if (!camera)
+		return false;
+
+	auto& framebuffer = camera->getRenderPipelineFramebuffer();
+	if (!framebuffer || !framebuffer->getFramebuffer())
+		return false;
+
+	auto& shadowMap = framebuffer->getFramebuffer()->getGraphicsFramebufferDesc().getColorAttachment().getBindingTexture();
+	if (!shadowMap)
+		return false;
+
+	// shadow maps of the shadow atlas only cover one tile, the clip space of the light is remapped onto the tile
+	// so that PosToCoord in the shader lands inside it.
+	float4 coord(1.0f, 1.0f, 0.0f, 0.0f);
+
+	if (framebuffer->isInstanceOf<ShadowRenderFramebuffer>())
+	{
+		auto shadowFramebuffer = framebuffer->downcast<ShadowRenderFramebuffer>();
+		if (shadowFramebuffer->getAtlasTile() < 0)
+			return false;
+
+		coord = shadowFramebuffer->getAtlasCoord();
+	}
+
+	float4x4 atlasTransform;
+	atlasTransform.makeScale(coord.x, coord.y, 1.0f);
+	atlasTransform.setTranslate(coord.x + coord.z * 2.0f - 1.0f, coord.y + coord.w * 2.0f - 1.0f, 0.0f);
+
+	float shadowFactor = light.getShadowFactor() / (camera->getFar() - camera->getNear());
+	float shaodwBias = light.getShadowBias();
+
+	_shadowMap->uniformTexture(shadowMap);
+	_shadowFactor->uniform2f(shadowFactor, shaodwBias);
+	_shadowView2LightView->uniform4f(camera->getView().getAxisZ() * pipeline.getCamera()->getViewInverse());
+	_shadowView2LightViewProject->uniform4fmat(atlasTransform * camera->getViewProject() * pipeline.getCamera()->getViewInverse());
+
+	return true;
+}
+
+void
+DeferredLightingPipeline::renderClusteredLights(RenderPipeline& pipeline, std::vector<const Light*>& lights) noexcept
+{
+	auto camera = pipeline.getCamera();
+
+	_lightCluster.setProject(camera->getProjectInverse(), camera->getNear(), camera->getFar());
+
+	std::stable_sort(lights.begin(), lights.end(), [](const Light* a, const Light* b) { return a->getLayer() < b->getLayer(); });
+
+	for (std::size_t first = 0; first < lights.size();)
+	{
+		std::size_t last = first;
+		while (last < lights.size() && last - first < ClusterMaxLights && lights[last]->getLayer() == lights[first]->getLayer())
+			last++;
+
+		// a dense batch can overflow the index list, retry with fewer lights and leave the rest to the next pass
+		for (;;)
+		{
+			_lightCluster.clear();
+
+			for (std::size_t i = first; i < last; i++)
+			{
+				auto& light = *lights[i];
+				auto position = math::invTranslateVector3(camera->getTransform(), light.getTranslate());
+
+				if (light.getLightType() == LightType::LightTypeSpot)
+					_lightCluster.addSpotLight(position, math::invRotateVector3(camera->getTransform(), light.getForward()), light.getLightRange(), light.getSpotOuterCone().y);
+				else
+					_lightCluster.addPointLight(position, light.getLightRange());
+			}
+
+			_lightCluster.compute();
+
+			if (_lightCluster.getLightIndices().size() <= ClusterMaxIndices || last - first == 1)
+				break;
+
+			last = first + (last - first) / 2;
+		}
+
+		float4* data = nullptr;
+		if (!_clusterLightData->map(0, _clusterLightData->getGraphicsDataDesc().getStreamSize(), (void**)&data))
+			return;
+
+		for (std::size_t i = first; i < last; i++)
+		{
+			auto& light = *lights[i];
+
+			auto position = math::invTranslateVector3(camera->getTransform(), light.getTranslate());
+			auto direction = math::invRotateVector3(camera->getTransform(), light.getForward());
+			auto color = light.getLightColor() * light.getLightIntensity();
+
+			*data++ = float4(position, light.getLightRange());
+			*data++ = float4(color, light.getLightType() == LightType::LightTypeSpot ? 1.0f : 0.0f);
+			*data++ = float4(direction, light.getSpotOuterCone().y);
+			*data++ = float4(light.getLightAttenuation(), light.getSpotInnerCone().y);
+		}
+
+		_clusterLightData->unmap();
+
+		auto& offsets = _lightCluster.getClusterOffsets();
+		auto& counts = _lightCluster.getClusterCounts();
+		auto& indices = _lightCluster.getLightIndices();
+
+		assert(indices.size() <= ClusterMaxIndices);
+
+		std::uint32_t* grid = nullptr;
+		if (!_clusterGridData->map(0, _clusterGridData->getGraphicsDataDesc().getStreamSize(), (void**)&grid))
+			return;
+
+		for (std::size_t i = 0; i < offsets.size(); i++)
+			grid[i] = offsets[i] | counts[i] << 16;
+
+		_clusterGridData->unmap();
+
+		std::uint32_t* packed = nullptr;
+		if (!_clusterIndexData->map(0, _clusterIndexData->getGraphicsDataDesc().getStreamSize(), (void**)&packed))
+			return;
+
+		std::size_t numIndices = indices.size();
+		std::memset(packed, 0, (numIndices + 3) / 4 * sizeof(std::uint32_t));
+
+		for (std::size_t i = 0; i < numIndices; i++)
+			packed[i >> 2] |= indices[i] << ((i & 3) * 8);
+
+		_clusterIndexData->unmap();
+
+		_clusterDepthFactor->uniform2f(_lightCluster.getDepthSliceFactor());
+
+		pipeline.drawScreenQuadLayer(*_deferredClusteredLights, lights[first]->getLayer());
+
+		first = last;
 	}
 }
 
@@ -764,6 +927,7 @@ DeferredLightingPipeline::setupDeferredMaterials(RenderPipeline& pipeline) noexc
 	_shadowFactor = _deferredLighting->getParameter("shadowFactor"); if (!_shadowFactor) return false;
 	_shadowView2LightView = _deferredLighting->getParameter("shadowView2LightView"); if (!_shadowView2LightView) return false;
 	_shadowView2LightViewProject = _deferredLighting->getParameter("shadowView2LightViewProject"); if (!_shadowView2LightViewProject) return false;
+	_shadowCascadeRange = _deferredLighting->getParameter("shadowCascadeRange"); if (!_shadowCascadeRange) return false;
 
 	_envDiffuse = _deferredLighting->getParameter("envDiffuse");
 	_envSpecular = _deferredLighting->getParameter("envSpecular");
@@ -780,6 +944,54 @@ DeferredLightingPipeline::setupDeferredMaterials(RenderPipeline& pipeline) noexc
 	return true;
 }
 
+bool
+DeferredLightingPipeline::setupClusteredLights(RenderPipeline& pipeline) noexcept
+{
+	_deferredClusteredLights = _deferredLighting->getTech("DeferredClusteredLights"); if (!_deferredClusteredLights) return false;
+
+	_clusterSize = _deferredLighting->getParameter("clusterSize"); if (!_clusterSize) return false;
+	_clusterDepthFactor = _deferredLighting->getParameter("clusterDepthFactor"); if (!_clusterDepthFactor) return false;
+	_clusterLights = _deferredLighting->getParameter("clusterLights"); if (!_clusterLights) return false;
+	_clusterGrid = _deferredLighting->getParameter("clusterGrid"); if (!_clusterGrid) return false;
+	_clusterIndices = _deferredLighting->getParameter("clusterIndices"); if (!_clusterIndices) return false;
+
+	GraphicsDataDesc lightDesc;
+	lightDesc.setStreamSize(sizeof(float4) * 4 * ClusterMaxLights);
+	lightDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit);
+	lightDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+
+	_clusterLightData = pipeline.createGraphicsData(lightDesc);
+	if (!_clusterLightData)
+		return false;
+
+	GraphicsDataDesc gridDesc;
+	gridDesc.setStreamSize(sizeof(std::uint32_t) * ClusterCountX * ClusterCountY * ClusterCountZ);
+	gridDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit);
+	gridDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+
+	_clusterGridData = pipeline.createGraphicsData(gridDesc);
+	if (!_clusterGridData)
+		return false;
+
+	GraphicsDataDesc indexDesc;
+	indexDesc.setStreamSize(sizeof(std::uint8_t) * ClusterMaxIndices);
+	indexDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit);
+	indexDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+
+	_clusterIndexData = pipeline.createGraphicsData(indexDesc);
+	if (!_clusterIndexData)
+		return false;
+
+	_clusterLights->uniformBuffer(_clusterLightData);
+	_clusterGrid->uniformBuffer(_clusterGridData);
+	_clusterIndices->uniformBuffer(_clusterIndexData);
+	_clusterSize->uniform3f(float3(ClusterCountX, ClusterCountY, ClusterCountZ));
+
+	_lightCluster.setup(ClusterCountX, ClusterCountY, ClusterCountZ);
+
+	return true;
+}
+
 bool
 DeferredLightingPipeline::initTextureFormat(RenderPipeline& pipeline) noexcept
 {
@@ -1091,6 +1303,7 @@ DeferredLightingPipeline::destroyDeferredMaterials() noexcept
 	_shadowFactor.reset();
 	_shadowView2LightView.reset();
 	_shadowView2LightViewProject.reset();
+	_shadowCascadeRange.reset();
 
 	_lightColor.reset();
 	_lightEyePosition.reset();
@@ -1099,6 +1312,24 @@ DeferredLightingPipeline::destroyDeferredMaterials() noexcept
 	_lightOuterInner.reset();
 }
 
+void
+DeferredLightingPipeline::destroyClusteredLights() noexcept
+{
+	_deferredClusteredLights.reset();
+
+	_clusterSize.reset();
+	_clusterDepthFactor.reset();
+	_clusterLights.reset();
+	_clusterGrid.reset();
+	_clusterIndices.reset();
+
+	_clusterLightData.reset();
+	_clusterGridData.reset();
+	_clusterIndexData.reset();
+
+	_clusteredLights.clear();
+}
+
 void
 DeferredLightingPipeline::destroyMRSIIMaterials() noexcept
 {
@@ -38,6 +38,7 @@
 #define _H_DEFERRED_LIGHTING_PIPELINE_H_
 
 #include <ray/render_pipeline_controller.h>
+#include <ray/light_cluster.h>
 
 _NAME_BEGIN
 
@@ -47,7 +48,7 @@ public:
 	DeferredLightingPipeline() noexcept;
 	~DeferredLightingPipeline() noexcept;
 
-	bool setup(const RenderPipelinePtr& pipeline, bool enableMRSII = false) noexcept;
+	bool setup(const RenderPipelinePtr& pipeline, bool enableMRSII = false, bool enableClusteredLighting = true) noexcept;
 	void close() noexcept;
 
 	void render3DEnvMap(const Camera* camera) noexcept;
@@ -74,6 +75,11 @@ public:
 	void renderSpotLight(RenderPipeline& pipeline, const Light& light) noexcept;
 	void renderAmbientLight(RenderPipeline& pipeline, const Light& light) noexcept;
 	void renderEnvironmentLight(RenderPipeline& pipeline, const Light& light) noexcept;
+	void renderClusteredLights(RenderPipeline& pipeline, std::vector<const Light*>& lights) noexcept;
+
+	void renderShadowCascades(RenderPipeline& pipeline, const Light& light, const MaterialTech& tech, const MaterialTech& shadowTech) noexcept;
+
+	bool bindShadowMap(RenderPipeline& pipeline, const Light& light, const CameraPtr& camera) noexcept;
 
 	void renderAmbientLights(RenderPipeline& pipeline, const GraphicsFramebufferPtr& target) noexcept;
 	void renderDirectLights(RenderPipeline& pipeline, const GraphicsFramebufferPtr& target) noexcept;
@@ -95,6 +101,7 @@ private:
 
 	bool setupSemantic(RenderPipeline& pipeline) noexcept;
 	bool setupDeferredMaterials(RenderPipeline& pipeline) noexcept;
+	bool setupClusteredLights(RenderPipeline& pipeline) noexcept;
 
 	bool setupMRSII(RenderPipeline& pipeline) noexcept;
 	bool setupMRSIIMaterials(RenderPipeline& pipeline) noexcept;
@@ -104,6 +111,7 @@ private:
 
 	void destroySemantic() noexcept;
 	void destroyDeferredMaterials() noexcept;
+	void destroyClusteredLights() noexcept;
 
 	void destroyMRSIIMaterials() noexcept;
 	void destroyMRSIITextures() noexcept;
@@ -123,6 +131,7 @@ private:
 	std::uint32_t _mrsiiDerivMipCount;
 
 	bool _enabledMRSSI;
+	bool _enabledClusteredLighting;
 
 	MaterialPtr _mrsii;
 	MaterialTechPtr _mrsiiRsm2VPLsSpot;
@@ -186,6 +195,7 @@ private:
 	MaterialTechPtr _deferredSpotLight;
 	MaterialTechPtr _deferredSpotLightShadow;
 	MaterialTechPtr _deferredPointLight;
+	MaterialTechPtr _deferredClusteredLights;
 	MaterialTechPtr _deferredAmbientLight;
 	MaterialTechPtr _deferredEnvironmentLighting;
 	MaterialTechPtr _deferredShadingOpaques;
@@ -211,6 +221,7 @@ private:
 	MaterialParamPtr _shadowFactor;
 	MaterialParamPtr _shadowView2LightView;
 	MaterialParamPtr _shadowView2LightViewProject;
+	MaterialParamPtr _shadowCascadeRange;
 
 	MaterialParamPtr _lightColor;
 	MaterialParamPtr _lightEyePosition;
@@ -218,6 +229,19 @@ private:
 	MaterialParamPtr _lightAttenuation;
 	MaterialParamPtr _lightOuterInner;
 
+	MaterialParamPtr _clusterSize;
+	MaterialParamPtr _clusterDepthFactor;
+	MaterialParamPtr _clusterLights;
+	MaterialParamPtr _clusterGrid;
+	MaterialParamPtr _clusterIndices;
+
+	GraphicsDataPtr _clusterLightData;
+	GraphicsDataPtr _clusterGridData;
+	GraphicsDataPtr _clusterIndexData;
+
+	LightCluster _lightCluster;
+	std::vector<const Light*> _clusteredLights;
+
 	MaterialParamPtr _envBoxMax;
 	MaterialParamPtr _envBoxMin;
 	MaterialParamPtr _envBoxCenter;
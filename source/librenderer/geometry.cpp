@@ -117,6 +117,9 @@ Geometry::setMaterial(const MaterialPtr& material) noexcept
 					continue;
 
 				_techniques[queue] = tech;
+
+				if (queue == RenderQueue::RenderQueueShadow)
+					_techniques[RenderQueue::RenderQueueStaticShadow] = tech;
 			}
 		}
 		else
@@ -135,6 +138,13 @@ Geometry::getMaterial() noexcept
 	return _material;
 }
 
+const MaterialTechPtr&
+Geometry::getMaterialTech(RenderQueue queue) const noexcept
+{
+	assert(queue >= RenderQueue::RenderQueueBeginRange && queue <= RenderQueue::RenderQueueEndRange);
+	return _techniques[queue];
+}
+
 void
 Geometry::setVertexBuffer(const GraphicsDataPtr& data, std::intptr_t offset) noexcept
 {
@@ -203,7 +213,7 @@ Geometry::onAddRenderData(RenderDataManager& manager) noexcept
 	if (this->getCastShadow())
 	{
 		if (_techniques[RenderQueue::RenderQueueShadow])
-			manager.addRenderData(RenderQueue::RenderQueueShadow, this);
+			manager.addRenderData(this->getStatic() ? RenderQueue::RenderQueueStaticShadow : RenderQueue::RenderQueueShadow, this);
 
 		if (_techniques[RenderQueue::RenderQueueReflectiveShadow])
 			manager.addRenderData(RenderQueue::RenderQueueReflectiveShadow, this);
@@ -211,7 +221,7 @@ Geometry::onAddRenderData(RenderDataManager& manager) noexcept
 
 	for (std::size_t i = 0; i < RenderQueue::RenderQueueRangeSize; i++)
 	{
-		if (i != RenderQueue::RenderQueueShadow && i != RenderQueue::RenderQueueReflectiveShadow)
+		if (i != RenderQueue::RenderQueueShadow && i != RenderQueue::RenderQueueStaticShadow && i != RenderQueue::RenderQueueReflectiveShadow)
 		{
 			if (_techniques[i])
 				manager.addRenderData((RenderQueue)i, this);
@@ -254,6 +264,58 @@ Geometry::onRenderObject(RenderPipeline& pipeline, RenderQueue queue, MaterialTe
 	}
 }
 
+bool
+Geometry::isInstancing(const Geometry& geometry, RenderQueue queue) const noexcept
+{
+	if (_vbo != geometry._vbo || _vertexOffset != geometry._vertexOffset)
+		return false;
+
+	if (_ibo != geometry._ibo || _indexOffset != geometry._indexOffset || _indexType != geometry._indexType)
+		return false;
+
+	if (_techniques[queue] != geometry._techniques[queue])
+		return false;
+
+	if (this->getLayer() != geometry.getLayer())
+		return false;
+
+	if (!_renderable || !geometry._renderable)
+		return false;
+
+	if (_renderable == geometry._renderable)
+		return _renderable->numInstances == 1;
+
+	return
+		_renderable->numIndices == geometry._renderable->numIndices &&
+		_renderable->startIndice == geometry._renderable->startIndice &&
+		_renderable->startVertice == geometry._renderable->startVertice &&
+		_renderable->numInstances == 1 &&
+		geometry._renderable->numInstances == 1;
+}
+
+void
+Geometry::onRenderObjectInstancing(RenderPipeline& pipeline, RenderQueue queue, MaterialTech* tech, std::uint32_t numInstances) noexcept
+{
+	if (!tech)
+		tech = _techniques[queue].get();
+
+	if (tech)
+	{
+		if (_vbo)
+			pipeline.setVertexBuffer(0, _vbo, _vertexOffset);
+
+		if (_ibo)
+			pipeline.setIndexBuffer(_ibo, _indexOffset, _indexType);
+
+		auto& passList = tech->getPassList();
+		for (auto& pass : passList)
+		{
+			pipeline.setMaterialPass(pass);
+			pipeline.drawIndexedLayer(_renderable->numIndices, numInstances, _renderable->startIndice, _renderable->startVertice, 0, this->getLayer());
+		}
+	}
+}
+
 RenderQueue
 Geometry::stringToRenderQueue(const std::string& techName) noexcept
 {
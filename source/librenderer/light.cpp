@@ -45,6 +45,10 @@ _NAME_BEGIN
 
 __ImplementSubClass(Light, RenderObject, "Light")
 
+// returned for a camera that has no cascades fitted yet
+static const Cameras ShadowCascadeCamerasEmpty;
+static const std::vector<float> ShadowCascadeSplitsEmpty;
+
 Light::Light() noexcept
 	: _lightType(LightType::LightTypePoint)
 	, _lightIntensity(1.0f)
@@ -58,6 +62,9 @@ Light::Light() noexcept
 	, _shadowMode(ShadowMode::ShadowModeNone)
 	, _shadowBias(0.1f)
 	, _shadowFactor(600.0f)
+	, _shadowCascades(LightShadowCascade::LightShadowCascadeMax)
+	, _shadowCascadeLambda(0.8f)
+	, _shadowCascadeEnable(false)
 {
 }
 
@@ -65,6 +72,7 @@ Light::~Light() noexcept
 {
 	this->destroyShadowMap();
 	this->destroyReflectiveShadowMap();
+	this->destroyShadowCascades();
 }
 
 void
@@ -72,6 +80,7 @@ Light::setLightType(LightType type) noexcept
 {
 	_lightType = type;
 	this->_updateBoundingBox();
+	this->setupShadowCascades();
 }
 
 void
@@ -173,6 +182,8 @@ Light::setShadowMode(ShadowMode shadowMode) noexcept
 			this->destroyReflectiveShadowMap();
 			this->setupReflectiveShadowMap();
 		}
+
+		this->setupShadowCascades();
 	}
 }
 
@@ -193,6 +204,8 @@ Light::setGlobalIllumination(bool enable) noexcept
 			this->destroyReflectiveShadowMap();
 
 		_enableGlobalIllumination = enable;
+
+		this->setupShadowCascades();
 	}
 }
 
@@ -208,6 +221,157 @@ Light::getCamera() const noexcept
 	return _shadowCamera;
 }
 
+void
+Light::setShadowCascades(std::uint8_t cascades) noexcept
+{
+	cascades = math::clamp<std::uint8_t>(cascades, LightShadowCascade::LightShadowCascadeMin, LightShadowCascade::LightShadowCascadeMax);
+	if (_shadowCascades != cascades)
+	{
+		_shadowCascades = cascades;
+		this->setupShadowCascades();
+	}
+}
+
+std::uint8_t
+Light::getShadowCascades() const noexcept
+{
+	return _shadowCascades;
+}
+
+void
+Light::setShadowCascadeLambda(float lambda) noexcept
+{
+	_shadowCascadeLambda = math::saturate(lambda);
+}
+
+float
+Light::getShadowCascadeLambda() const noexcept
+{
+	return _shadowCascadeLambda;
+}
+
+bool
+Light::getShadowCascadeEnable() const noexcept
+{
+	return _shadowCascadeEnable;
+}
+
+const Cameras&
+Light::getShadowCascadeCameras(const Camera& camera) const noexcept
+{
+	for (auto& it : _shadowCascadeSets)
+	{
+		if (it.camera == &camera)
+			return it.cameras;
+	}
+
+	return ShadowCascadeCamerasEmpty;
+}
+
+const std::vector<float>&
+Light::getShadowCascadeSplits(const Camera& camera) const noexcept
+{
+	for (auto& it : _shadowCascadeSets)
+	{
+		if (it.camera == &camera)
+			return it.splits;
+	}
+
+	return ShadowCascadeSplitsEmpty;
+}
+
+void
+Light::updateShadowCascades(const Camera& camera, const std::uint32_t shadowMapSize[]) noexcept
+{
+	if (!_shadowCascadeEnable)
+		return;
+
+	ShadowCascadeSet* cascadeSet = nullptr;
+	for (auto& it : _shadowCascadeSets)
+	{
+		if (it.camera == &camera)
+		{
+			cascadeSet = &it;
+			break;
+		}
+	}
+
+	if (!cascadeSet)
+	{
+		cascadeSet = this->createShadowCascades(camera);
+		if (!cascadeSet)
+			return;
+	}
+
+	auto& cameras = cascadeSet->cameras;
+	auto& splits = cascadeSet->splits;
+
+	std::size_t cascades = cameras.size();
+
+	float znear = camera.getNear();
+	float zfar = std::min(camera.getFar(), znear + _lightRange);
+
+	// practical split scheme, blends the logarithmic split with the uniform split by the lambda
+	splits.resize(cascades + 1);
+
+	for (std::size_t i = 0; i <= cascades; i++)
+	{
+		float p = (float)i / cascades;
+		float logSplit = znear * std::pow(zfar / znear, p);
+		float uniformSplit = znear + (zfar - znear) * p;
+		splits[i] = math::lerp(uniformSplit, logSplit, _shadowCascadeLambda);
+	}
+
+	float2 extent = float2::Zero;
+	if (camera.getCameraType() == CameraType::CameraTypePerspective)
+	{
+		extent.y = std::tan(math::deg2rad(camera.getAperture() * 0.5f));
+		extent.x = extent.y * camera.getRatio();
+	}
+
+	float2 orthoExtent = float2::Zero;
+	if (camera.getCameraType() == CameraType::CameraTypeOrtho)
+	{
+		auto& ortho = camera.getOrtho();
+		orthoExtent.x = (ortho.y - ortho.x) * 0.5f;
+		orthoExtent.y = (ortho.w - ortho.z) * 0.5f;
+	}
+
+	for (std::size_t i = 0; i < cascades; i++)
+	{
+		float n = splits[i];
+		float f = splits[i + 1];
+
+		float rn = math::length2(orthoExtent + extent * n);
+		float rf = math::length2(orthoExtent + extent * f);
+
+		// the sphere is centered on the view axis, so its radius only depends on the split and never changes when the camera rotates
+		float center = math::clamp((f * f - n * n + rf - rn) / (2.0f * (f - n)), n, f);
+		float radius = std::sqrt(std::max((center - n) * (center - n) + rn, (f - center) * (f - center) + rf));
+		radius = std::ceil(radius * 16.0f) / 16.0f;
+
+		float texelSize = radius * 2.0f / shadowMapSize[i];
+
+		// snap the cascade to whole texels in light space so the shadow edges do not shimmer while the camera moves
+		float3 position = camera.getTranslate() + camera.getForward() * center;
+		float x = std::floor(math::dot(position, this->getRight()) / texelSize) * texelSize;
+		float y = std::floor(math::dot(position, this->getUpVector()) / texelSize) * texelSize;
+		float z = std::floor(math::dot(position, this->getForward()) / texelSize) * texelSize;
+
+		float distance = radius + _lightRange;
+
+		float4x4 transform = this->getTransform();
+		transform.setTranslate(this->getRight() * x + this->getUpVector() * y + this->getForward() * (z - distance));
+
+		auto& cascade = cameras[i];
+		cascade->setOrtho(float4(-radius, radius, -radius, radius));
+		cascade->setFar(distance + radius);
+
+		if (cascade->getTransform() != transform)
+			cascade->setTransform(transform);
+	}
+}
+
 void
 Light::setShadowBias(float bias) noexcept
 {
@@ -309,6 +473,56 @@ Light::setupReflectiveShadowMap() noexcept
 	return true;
 }
 
+bool
+Light::setupShadowCascades() noexcept
+{
+	this->destroyShadowCascades();
+
+	if (_shadowMode == ShadowMode::ShadowModeNone || _enableGlobalIllumination)
+		return false;
+
+	if (_lightType != LightType::LightTypeSun && _lightType != LightType::LightTypeDirectional)
+		return false;
+
+	if (_shadowCascades <= LightShadowCascade::LightShadowCascadeMin)
+		return false;
+
+	// the cascade cameras are created once a main camera fits the cascades
+	_shadowCascadeEnable = true;
+	return true;
+}
+
+Light::ShadowCascadeSet*
+Light::createShadowCascades(const Camera& camera) noexcept
+{
+	ShadowCascadeSet cascadeSet;
+	cascadeSet.camera = &camera;
+
+	for (std::uint8_t i = 0; i < _shadowCascades; i++)
+	{
+		auto framebuffer = std::make_shared<ray::ShadowRenderFramebuffer>();
+		if (!framebuffer->setup())
+			return nullptr;
+
+		auto cascade = std::make_shared<Camera>();
+		cascade->setOwnerListener(this);
+		cascade->setCameraOrder(CameraOrder::CameraOrderShadow);
+		cascade->setCameraRenderFlags(CameraRenderFlagBits::CameraRenderTextureBit);
+		cascade->setCameraType(CameraType::CameraTypeOrtho);
+		cascade->setNear(0.1f);
+		cascade->setRatio(1.0f);
+		cascade->setRenderPipelineFramebuffer(framebuffer);
+
+		cascadeSet.cameras.push_back(cascade);
+	}
+
+	for (auto& cascade : cascadeSet.cameras)
+		cascade->setRenderScene(this->getRenderScene());
+
+	_shadowCascadeSets.push_back(std::move(cascadeSet));
+	return &_shadowCascadeSets.back();
+}
+
 void
 Light::destroyShadowMap() noexcept
 {
@@ -323,6 +537,19 @@ Light::destroyReflectiveShadowMap() noexcept
 		_shadowCamera->getRenderPipelineFramebuffer()->setFramebuffer(nullptr);
 }
 
+void
+Light::destroyShadowCascades() noexcept
+{
+	for (auto& cascadeSet : _shadowCascadeSets)
+	{
+		for (auto& camera : cascadeSet.cameras)
+			camera->setRenderScene(nullptr);
+	}
+
+	_shadowCascadeSets.clear();
+	_shadowCascadeEnable = false;
+}
+
 void
 Light::_updateTransform() noexcept
 {
@@ -414,6 +641,12 @@ Light::onSceneChangeBefore() noexcept
 	{
 		if (_shadowCamera)
 			_shadowCamera->setRenderScene(nullptr);
+
+		for (auto& cascadeSet : _shadowCascadeSets)
+		{
+			for (auto& camera : cascadeSet.cameras)
+				camera->setRenderScene(nullptr);
+		}
 	}
 }
 
@@ -425,6 +658,12 @@ Light::onSceneChangeAfter() noexcept
 	{
 		if (_shadowCamera)
 			_shadowCamera->setRenderScene(renderScene);
+
+		for (auto& cascadeSet : _shadowCascadeSets)
+		{
+			for (auto& camera : cascadeSet.cameras)
+				camera->setRenderScene(renderScene);
+		}
 	}
 }
 
@@ -472,6 +711,8 @@ Light::clone() const noexcept
 
 	light->_spotInnerCone = _spotInnerCone;
 	light->_spotOuterCone = _spotOuterCone;
+	light->_shadowCascades = _shadowCascades;
+	light->_shadowCascadeLambda = _shadowCascadeLambda;
 
 	return light;
 }
@@ -0,0 +1,471 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/light_cluster.h>
+#include <ray/thread.h>
+
+#if defined(__SSE__)
+#	include <xmmintrin.h>
+#endif
+
+_NAME_BEGIN
+
+// the view frustum is split into clusterX * clusterY screen tiles and clusterZ slices whose depth grows
+// logarithmically from the near plane, every cluster is bounded by the view-space AABB of its 8 corners.
+// padding clusters at the end of every slice keep the SoA rows a multiple of 4 and never pass a test.
+static const float ClusterPaddingBounds = 1e30f;
+
+LightCluster::LightCluster() noexcept
+	: _clusterX(0)
+	, _clusterY(0)
+	, _clusterZ(0)
+	, _sliceStride(0)
+	, _znear(0.0f)
+	, _zfar(0.0f)
+	, _depthSliceFactor(float2::Zero)
+	, _projectInverse(float4x4::One)
+	, _needUpdateBounds(true)
+{
+}
+
+LightCluster::~LightCluster() noexcept
+{
+}
+
+void
+LightCluster::setup(std::uint32_t clusterX, std::uint32_t clusterY, std::uint32_t clusterZ) noexcept
+{
+	assert(clusterX > 0 && clusterY > 0 && clusterZ > 0);
+
+	_clusterX = clusterX;
+	_clusterY = clusterY;
+	_clusterZ = clusterZ;
+	_sliceStride = (clusterX * clusterY + 3) & ~3;
+
+	std::size_t size = _sliceStride * clusterZ;
+	_minX.resize(size);
+	_minY.resize(size);
+	_minZ.resize(size);
+	_maxX.resize(size);
+	_maxY.resize(size);
+	_maxZ.resize(size);
+	_centerX.resize(size);
+	_centerY.resize(size);
+	_centerZ.resize(size);
+	_radius.resize(size);
+
+	_clusterOffsets.resize(this->getNumClusters());
+	_clusterCounts.resize(this->getNumClusters());
+	_sliceIndices.resize(clusterZ);
+
+	_needUpdateBounds = true;
+}
+
+std::uint32_t
+LightCluster::getClusterX() const noexcept
+{
+	return _clusterX;
+}
+
+std::uint32_t
+LightCluster::getClusterY() const noexcept
+{
+	return _clusterY;
+}
+
+std::uint32_t
+LightCluster::getClusterZ() const noexcept
+{
+	return _clusterZ;
+}
+
+std::uint32_t
+LightCluster::getNumClusters() const noexcept
+{
+	return _clusterX * _clusterY * _clusterZ;
+}
+
+void
+LightCluster::setProject(const float4x4& projectInverse, float znear, float zfar) noexcept
+{
+	assert(znear > 0.0f && zfar > znear);
+
+	if (_projectInverse != projectInverse || _znear != znear || _zfar != zfar)
+	{
+		_projectInverse = projectInverse;
+		_znear = znear;
+		_zfar = zfar;
+		_needUpdateBounds = true;
+	}
+}
+
+const float2&
+LightCluster::getDepthSliceFactor() const noexcept
+{
+	return _depthSliceFactor;
+}
+
+void
+LightCluster::clear() noexcept
+{
+	_lights.clear();
+}
+
+std::uint32_t
+LightCluster::addPointLight(const float3& eyePosition, float range) noexcept
+{
+	LightBounds light;
+	light.position = eyePosition;
+	light.direction = float3::Zero;
+	light.range = range;
+	light.cosOuter = 0.0f;
+	light.sinOuter = 0.0f;
+	light.isSpot = false;
+	light.sliceMin = 1;
+	light.sliceMax = 0;
+
+	_lights.push_back(light);
+	return static_cast<std::uint32_t>(_lights.size() - 1);
+}
+
+std::uint32_t
+LightCluster::addSpotLight(const float3& eyePosition, const float3& eyeDirection, float range, float cosOuter) noexcept
+{
+	LightBounds light;
+	light.position = eyePosition;
+	light.direction = eyeDirection;
+	light.range = range;
+	light.cosOuter = cosOuter;
+	light.sinOuter = std::sqrt(std::max(0.0f, 1.0f - cosOuter * cosOuter));
+	light.isSpot = true;
+	light.sliceMin = 1;
+	light.sliceMax = 0;
+
+	_lights.push_back(light);
+	return static_cast<std::uint32_t>(_lights.size() - 1);
+}
+
+std::uint32_t
+LightCluster::getNumLights() const noexcept
+{
+	return static_cast<std::uint32_t>(_lights.size());
+}
+
+void
+LightCluster::compute() noexcept
+{
+	assert(_clusterZ > 0);
+
+	if (_needUpdateBounds)
+		this->computeClusterBounds();
+
+	std::fill(_clusterCounts.begin(), _clusterCounts.end(), 0);
+	std::fill(_clusterOffsets.begin(), _clusterOffsets.end(), 0);
+
+	_lightIndices.clear();
+
+	if (_lights.empty())
+		return;
+
+	for (auto& light : _lights)
+	{
+		float zmin = light.position.z - light.range;
+		float zmax = light.position.z + light.range;
+		if (zmax < _znear || zmin > _zfar)
+		{
+			light.sliceMin = 1;
+			light.sliceMax = 0;
+		}
+		else
+		{
+			light.sliceMin = this->computeSliceIndex(zmin);
+			light.sliceMax = this->computeSliceIndex(zmax);
+		}
+	}
+
+	auto threadPool = ThreadPool::instance();
+
+	std::size_t jobs = std::min<std::size_t>(_clusterZ, threadPool->getThreadCount() + 1);
+	if (_sliceMasks.size() < jobs)
+		_sliceMasks.resize(jobs);
+
+	ThreadTaskGroup group;
+
+	threadPool->exce(group, jobs, [&](std::size_t i)
+	{
+		for (std::size_t j = i; j < _clusterZ; j += jobs)
+			this->computeSlice(static_cast<std::uint32_t>(j), _sliceMasks[i]);
+	});
+
+	threadPool->wait(group);
+
+	std::uint32_t offset = 0;
+	for (std::size_t i = 0; i < _clusterCounts.size(); i++)
+	{
+		_clusterOffsets[i] = offset;
+		offset += _clusterCounts[i];
+	}
+
+	_lightIndices.reserve(offset);
+
+	for (auto& it : _sliceIndices)
+		_lightIndices.insert(_lightIndices.end(), it.begin(), it.end());
+}
+
+AABB
+LightCluster::getClusterAABB(std::uint32_t index) const noexcept
+{
+	assert(index < this->getNumClusters());
+
+	std::uint32_t slice = index / (_clusterX * _clusterY);
+	std::uint32_t i = slice * _sliceStride + index % (_clusterX * _clusterY);
+
+	AABB aabb;
+	aabb.min.set(_minX[i], _minY[i], _minZ[i]);
+	aabb.max.set(_maxX[i], _maxY[i], _maxZ[i]);
+	return aabb;
+}
+
+const std::vector<std::uint32_t>&
+LightCluster::getClusterOffsets() const noexcept
+{
+	return _clusterOffsets;
+}
+
+const std::vector<std::uint32_t>&
+LightCluster::getClusterCounts() const noexcept
+{
+	return _clusterCounts;
+}
+
+const std::vector<std::uint32_t>&
+LightCluster::getLightIndices() const noexcept
+{
+	return _lightIndices;
+}
+
+void
+LightCluster::computeClusterBounds() noexcept
+{
+	float logDepth = std::log(_zfar / _znear);
+
+	_depthSliceFactor.x = _clusterZ / logDepth;
+	_depthSliceFactor.y = -std::log(_znear) * _depthSliceFactor.x;
+
+	std::vector<float3> rays((_clusterX + 1) * (_clusterY + 1));
+
+	for (std::uint32_t y = 0; y <= _clusterY; y++)
+	{
+		for (std::uint32_t x = 0; x <= _clusterX; x++)
+		{
+			float4 ndc(x * 2.0f / _clusterX - 1.0f, y * 2.0f / _clusterY - 1.0f, 1.0f, 1.0f);
+			float4 v = _projectInverse * ndc;
+			rays[y * (_clusterX + 1) + x] = float3(v.x, v.y, v.z) / v.z;
+		}
+	}
+
+	for (std::uint32_t z = 0; z < _clusterZ; z++)
+	{
+		float depthNear = _znear * std::exp(logDepth * z / _clusterZ);
+		float depthFar = _znear * std::exp(logDepth * (z + 1) / _clusterZ);
+
+		for (std::uint32_t i = 0; i < _sliceStride; i++)
+		{
+			std::size_t index = z * _sliceStride + i;
+
+			float3 minimum(ClusterPaddingBounds);
+			float3 maximum(ClusterPaddingBounds);
+
+			if (i < _clusterX * _clusterY)
+			{
+				std::uint32_t x = i % _clusterX;
+				std::uint32_t y = i / _clusterX;
+
+				minimum = float3(std::numeric_limits<float>::max());
+				maximum = float3(-std::numeric_limits<float>::max());
+
+				for (std::uint8_t j = 0; j < 4; j++)
+				{
+					auto& ray = rays[(y + (j >> 1)) * (_clusterX + 1) + x + (j & 1)];
+					minimum = math::min(minimum, math::min(ray * depthNear, ray * depthFar));
+					maximum = math::max(maximum, math::max(ray * depthNear, ray * depthFar));
+				}
+			}
+
+			_minX[index] = minimum.x;
+			_minY[index] = minimum.y;
+			_minZ[index] = minimum.z;
+			_maxX[index] = maximum.x;
+			_maxY[index] = maximum.y;
+			_maxZ[index] = maximum.z;
+			_centerX[index] = (minimum.x + maximum.x) * 0.5f;
+			_centerY[index] = (minimum.y + maximum.y) * 0.5f;
+			_centerZ[index] = (minimum.z + maximum.z) * 0.5f;
+			_radius[index] = math::length(maximum - minimum) * 0.5f;
+		}
+	}
+
+	_needUpdateBounds = false;
+}
+
+void
+LightCluster::computeSlice(std::uint32_t slice, std::vector<std::uint32_t>& masks) noexcept
+{
+	std::uint32_t numClusters = _clusterX * _clusterY;
+	std::uint32_t numWords = (static_cast<std::uint32_t>(_lights.size()) + 31) / 32;
+
+	masks.assign(_sliceStride * numWords, 0);
+
+	std::size_t base = slice * _sliceStride;
+
+	for (std::uint32_t l = 0; l < _lights.size(); l++)
+	{
+		auto& light = _lights[l];
+		if (slice < light.sliceMin || slice > light.sliceMax)
+			continue;
+
+		std::uint32_t word = l >> 5;
+		std::uint32_t bit = 1u << (l & 31);
+
+#if defined(__SSE__)
+		__m128 zero = _mm_setzero_ps();
+		__m128 px = _mm_set1_ps(light.position.x);
+		__m128 py = _mm_set1_ps(light.position.y);
+		__m128 pz = _mm_set1_ps(light.position.z);
+		__m128 dx = _mm_set1_ps(light.direction.x);
+		__m128 dy = _mm_set1_ps(light.direction.y);
+		__m128 dz = _mm_set1_ps(light.direction.z);
+		__m128 range = _mm_set1_ps(light.range);
+		__m128 range2 = _mm_set1_ps(light.range * light.range);
+		__m128 cosOuter = _mm_set1_ps(light.cosOuter);
+		__m128 sinOuter = _mm_set1_ps(light.sinOuter);
+
+		for (std::uint32_t c = 0; c < _sliceStride; c += 4)
+		{
+			std::size_t i = base + c;
+
+			__m128 distX = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&_minX[i]), px), _mm_sub_ps(px, _mm_loadu_ps(&_maxX[i]))));
+			__m128 distY = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&_minY[i]), py), _mm_sub_ps(py, _mm_loadu_ps(&_maxY[i]))));
+			__m128 distZ = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&_minZ[i]), pz), _mm_sub_ps(pz, _mm_loadu_ps(&_maxZ[i]))));
+			__m128 dist2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(distX, distX), _mm_mul_ps(distY, distY)), _mm_mul_ps(distZ, distZ));
+			__m128 visiable = _mm_cmple_ps(dist2, range2);
+
+			if (light.isSpot)
+			{
+				__m128 radius = _mm_loadu_ps(&_radius[i]);
+				__m128 vx = _mm_sub_ps(_mm_loadu_ps(&_centerX[i]), px);
+				__m128 vy = _mm_sub_ps(_mm_loadu_ps(&_centerY[i]), py);
+				__m128 vz = _mm_sub_ps(_mm_loadu_ps(&_centerZ[i]), pz);
+				__m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+				__m128 v1Len = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, dx), _mm_mul_ps(vy, dy)), _mm_mul_ps(vz, dz));
+				__m128 distClosest = _mm_sub_ps(_mm_mul_ps(cosOuter, _mm_sqrt_ps(_mm_max_ps(zero, _mm_sub_ps(lenSq, _mm_mul_ps(v1Len, v1Len))))), _mm_mul_ps(v1Len, sinOuter));
+
+				visiable = _mm_and_ps(visiable, _mm_cmple_ps(distClosest, radius));
+				visiable = _mm_and_ps(visiable, _mm_cmple_ps(v1Len, _mm_add_ps(radius, range)));
+				visiable = _mm_and_ps(visiable, _mm_cmpge_ps(v1Len, _mm_sub_ps(zero, radius)));
+			}
+
+			int result = _mm_movemask_ps(visiable);
+			if (result == 0)
+				continue;
+
+			for (std::uint32_t j = 0; j < 4; j++)
+			{
+				if (result & (1 << j))
+					masks[(c + j) * numWords + word] |= bit;
+			}
+		}
+#else
+		for (std::uint32_t c = 0; c < numClusters; c++)
+		{
+			std::size_t i = base + c;
+
+			float distX = std::max(0.0f, std::max(_minX[i] - light.position.x, light.position.x - _maxX[i]));
+			float distY = std::max(0.0f, std::max(_minY[i] - light.position.y, light.position.y - _maxY[i]));
+			float distZ = std::max(0.0f, std::max(_minZ[i] - light.position.z, light.position.z - _maxZ[i]));
+			if (distX * distX + distY * distY + distZ * distZ > light.range * light.range)
+				continue;
+
+			if (light.isSpot)
+			{
+				float3 v = float3(_centerX[i], _centerY[i], _centerZ[i]) - light.position;
+				float lenSq = math::dot(v, v);
+				float v1Len = math::dot(v, light.direction);
+				float distClosest = light.cosOuter * std::sqrt(std::max(0.0f, lenSq - v1Len * v1Len)) - v1Len * light.sinOuter;
+				if (distClosest > _radius[i] || v1Len > _radius[i] + light.range || v1Len < -_radius[i])
+					continue;
+			}
+
+			masks[c * numWords + word] |= bit;
+		}
+#endif
+	}
+
+	auto& indices = _sliceIndices[slice];
+	indices.clear();
+
+	for (std::uint32_t c = 0; c < numClusters; c++)
+	{
+		std::uint32_t count = 0;
+
+		for (std::uint32_t w = 0; w < numWords; w++)
+		{
+			std::uint32_t bits = masks[c * numWords + w];
+			for (std::uint32_t j = w * 32; bits; j++, bits >>= 1)
+			{
+				if (bits & 1)
+				{
+					indices.push_back(j);
+					count++;
+				}
+			}
+		}
+
+		_clusterCounts[slice * numClusters + c] = count;
+	}
+}
+
+std::uint32_t
+LightCluster::computeSliceIndex(float depth) const noexcept
+{
+	if (depth <= _znear)
+		return 0;
+
+	float slice = std::floor(std::log(depth) * _depthSliceFactor.x + _depthSliceFactor.y);
+	return std::min(static_cast<std::uint32_t>(std::max(0.0f, slice)), _clusterZ - 1);
+}
+
+_NAME_END
\ No newline at end of file
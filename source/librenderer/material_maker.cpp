@@ -106,6 +106,8 @@ MaterialMaker::instanceInputLayout(MaterialManager& manager, Material& material,
 	if (!reader.setToFirstChild())
 		throw failure(__TEXT("Empty child : ") + reader.getCurrentNodePath());
 
+	std::map<std::uint8_t, GraphicsVertexDivisor> divisors;
+
 	do
 	{
 		std::string name = reader.getCurrentNodeName();
@@ -130,11 +132,20 @@ MaterialMaker::instanceInputLayout(MaterialManager& manager, Material& material,
 			std::uint32_t offset = 0;
 			reader.getValue("offset", offset);
 
+			std::string divisor = reader.getValue<std::string>("divisor");
+			if (divisor == "instance")
+				divisors[slot] = GraphicsVertexDivisor::GraphicsVertexDivisorInstance;
+			else if (divisor.empty() || divisor == "vertex")
+				divisors.insert(std::make_pair(slot, GraphicsVertexDivisor::GraphicsVertexDivisorVertex));
+			else
+				throw failure(__TEXT("Unknown divisor : ") + reader.getCurrentNodePath());
+
 			inputLayoutDesc.addVertexLayout(GraphicsVertexLayout(slot, layoutName, index, format, offset));
 		}
 	} while (reader.setToNextChild());
 
-	inputLayoutDesc.addVertexBinding(GraphicsVertexBinding(0, inputLayoutDesc.getVertexSize(0)));
+	for (auto& it : divisors)
+		inputLayoutDesc.addVertexBinding(GraphicsVertexBinding(it.first, inputLayoutDesc.getVertexSize(it.first), it.second));
 	inputLayout = manager.createInputLayout(inputLayoutName, inputLayoutDesc);
 	if (!inputLayout)
 		throw failure(__TEXT("Can't create input layout") + reader.getCurrentNodeName());
@@ -232,7 +243,15 @@ MaterialMaker::instancePass(MaterialManager& manager, Material& material, Materi
 		else if (name == "fragment")
 			this->instanceShader(manager, material, programDesc, reader);
 		else if (name == "inputlayout")
-			inputLayout = manager.getInputLayout(reader.getValue<std::string>("value"));
+		{
+			std::string value = reader.getValue<std::string>("value");
+
+			auto macro = _macros.find(value);
+			if (macro != _macros.end())
+				value = (*macro).second;
+
+			inputLayout = manager.getInputLayout(value);
+		}
 		else if (name == "cullmode")
 		{
 			GraphicsCullMode cullMode;
@@ -584,6 +603,8 @@ MaterialMaker::instanceMacro(MaterialManager& manager, Material& material, ixmla
 		_hlslCodes += "#define " + name + " " + value + "\n";
 	}
 
+	_macros[name] = value;
+
 	if (!type.empty())
 	{
 		auto macro = std::make_shared<MaterialMacro>();
@@ -751,10 +772,37 @@ MaterialMaker::instanceBuffer(MaterialManager& manager, Material& material, ixml
 	if (!reader.getValue("name", name))
 		throw failure(__TEXT("Empty cbuffer name") + reader.getCurrentNodePath());
 
+	auto semantic = reader.getValue<std::string>("semantic");
+
+	// ES2 has no uniform blocks, declare the members as plain uniforms and bind them by their own semantics
+	if (manager.getDeviceType() == GraphicsDeviceType::GraphicsDeviceTypeOpenGLES2)
+	{
+		if (!reader.setToFirstChild())
+			throw failure(__TEXT("Empty child : ") + reader.getCurrentNodePath());
+
+		do
+		{
+			auto nodename = reader.getCurrentNodeName();
+			if (nodename == "parameter")
+				this->instanceBufferMember(manager, material, reader, !semantic.empty());
+		} while (reader.setToNextChild());
+
+		return;
+	}
+
 	auto buffer = std::make_shared<MaterialParam>();
 	buffer->setType(GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
 	buffer->setName(std::move(name));
 
+	if (!semantic.empty())
+	{
+		GlobalSemanticType materialType;
+		if (!GetSemanticType(semantic, materialType))
+			throw failure(__TEXT("Unknown semantic : ") + semantic);
+
+		buffer->setSemanticType(materialType);
+	}
+
 	if (!reader.setToFirstChild())
 		throw failure(__TEXT("Empty child : ") + reader.getCurrentNodePath());
 
@@ -793,6 +841,41 @@ MaterialMaker::instanceBuffer(MaterialManager& manager, Material& material, ixml
 	material.addParameter(std::move(buffer));
 }
 
+void
+MaterialMaker::instanceBufferMember(MaterialManager& manager, Material& material, ixmlarchive& reader, bool bindSemantic) except
+{
+	auto name = reader.getValue<std::string>("name");
+	auto type = reader.getValue<std::string>("type");
+
+	if (name.empty() || type.empty())
+		return;
+
+	GraphicsUniformType uniformType;
+	if (!GetUniformType(type, uniformType))
+		throw failure(__TEXT("Unknown parameter type : ") + type);
+
+	if (_isHlsl)
+	{
+		type = type.substr(0, type.find_first_of('['));
+		_hlslCodes += "uniform " + type + " " + name + ";\n";
+	}
+
+	auto pos = name.find_first_of('[');
+	if (pos != std::string::npos)
+		name = name.substr(0, pos);
+
+	auto param = std::make_shared<MaterialParam>();
+	param->setType(uniformType);
+
+	GlobalSemanticType materialType;
+	if (bindSemantic && GetSemanticType(name, materialType))
+		param->setSemanticType(materialType);
+
+	param->setName(std::move(name));
+
+	material.addParameter(std::move(param));
+}
+
 bool
 MaterialMaker::instanceInclude(MaterialManager& manager, Material& material, ixmlarchive& reader) except
 {
@@ -1345,6 +1428,7 @@ MaterialMaker::GetSemanticType(const std::string& string, GlobalSemanticType& ty
 	if (string == "matModelView") { type = GlobalSemanticType::GlobalSemanticTypeModelView; return true; }
 	if (string == "matModelViewProject") { type = GlobalSemanticType::GlobalSemanticTypeModelViewProject; return true; }
 	if (string == "matModelViewInverse") { type = GlobalSemanticType::GlobalSemanticTypeModelViewInverse; return true; }
+	if (string == "matModelBuffer") { type = GlobalSemanticType::GlobalSemanticTypeModelBuffer; return true; }
 	if (string == "CameraAperture") { type = GlobalSemanticType::GlobalSemanticTypeCameraAperture; return true; }
 	if (string == "CameraNear") { type = GlobalSemanticType::GlobalSemanticTypeCameraNear; return true; }
 	if (string == "CameraFar") { type = GlobalSemanticType::GlobalSemanticTypeCameraFar; return true; }
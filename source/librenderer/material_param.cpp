@@ -710,6 +710,12 @@ MaterialParam::value() const noexcept
 	return _variant;
 }
 
+std::uint32_t
+MaterialParam::getVersion() const noexcept
+{
+	return _variant.getVersion();
+}
+
 void
 MaterialParam::addParamListener(MaterialParamListener* listener) noexcept
 {
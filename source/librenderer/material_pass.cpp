@@ -441,6 +441,7 @@ MaterialParamBinding::uniformBuffer(GraphicsDataPtr ubo) noexcept
 
 MaterialSemanticBinding::MaterialSemanticBinding() noexcept
 	: _semanticType(GlobalSemanticType::GlobalSemanticTypeNone)
+	, _version(std::numeric_limits<std::uint32_t>::max())
 {
 }
 
@@ -472,6 +473,18 @@ MaterialSemanticBinding::getGraphicsUniformSet() const noexcept
 	return _uniformSet;
 }
 
+void
+MaterialSemanticBinding::setVersion(std::uint32_t version) noexcept
+{
+	_version = version;
+}
+
+std::uint32_t
+MaterialSemanticBinding::getVersion() const noexcept
+{
+	return _version;
+}
+
 MaterialPass::MaterialPass() noexcept
 {
 }
@@ -758,6 +771,18 @@ MaterialPass::clone() const noexcept
 	return pass;
 }
 
+bool
+MaterialPass::hasSemantic(GlobalSemanticType semanticType) const noexcept
+{
+	for (auto& it : _bindingSemantics)
+	{
+		if (it.getSemanticType() == semanticType)
+			return true;
+	}
+
+	return false;
+}
+
 void
 MaterialPass::update(const MaterialSemanticManager& semanticManager) noexcept
 {
@@ -765,8 +790,13 @@ MaterialPass::update(const MaterialSemanticManager& semanticManager) noexcept
 	{
 		auto semanticType = it.getSemanticType();
 		auto& semantic = semanticManager.getSemantic(semanticType);
+		if (it.getVersion() == semantic->getVersion())
+			continue;
+
 		auto& uniform = it.getGraphicsUniformSet();
 		this->updateSemantic(*uniform, *semantic);
+
+		it.setVersion(semantic->getVersion());
 	}
 }
 
@@ -892,7 +922,7 @@ MaterialPass::updateSemantic(GraphicsUniformSet& uniform, const MaterialSemantic
 		uniform.uniformBuffer(semantic.getBuffer());
 		break;
 	case GraphicsUniformType::GraphicsUniformTypeUniformBuffer:
-		uniform.uniformBuffer(semantic.getBuffer());
+		uniform.uniformBuffer(semantic.getBuffer(), semantic.getBufferOffset(), semantic.getBufferSize());
 		break;
 	case GraphicsUniformType::GraphicsUniformTypeUniformBufferDynamic:
 		uniform.uniformBuffer(semantic.getBuffer());
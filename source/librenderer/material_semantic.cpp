@@ -448,6 +448,12 @@ MaterialSemantic::uniformBuffer(GraphicsDataPtr ubo) noexcept
 	_variant.uniformBuffer(ubo);
 }
 
+void
+MaterialSemantic::uniformBuffer(GraphicsDataPtr ubo, std::uint32_t offset, std::uint32_t size) noexcept
+{
+	_variant.uniformBuffer(ubo, offset, size);
+}
+
 bool
 MaterialSemantic::getBool() const noexcept
 {
@@ -652,6 +658,24 @@ MaterialSemantic::getBuffer() const noexcept
 	return _variant.getBuffer();
 }
 
+std::uint32_t
+MaterialSemantic::getBufferOffset() const noexcept
+{
+	return _variant.getBufferOffset();
+}
+
+std::uint32_t
+MaterialSemantic::getBufferSize() const noexcept
+{
+	return _variant.getBufferSize();
+}
+
+std::uint32_t
+MaterialSemantic::getVersion() const noexcept
+{
+	return _variant.getVersion();
+}
+
 MaterialSemanticManager::MaterialSemanticManager() noexcept
 {
 }
@@ -675,6 +699,7 @@ MaterialSemanticManager::setup() noexcept
 	_parametes[GlobalSemanticType::GlobalSemanticTypeModelView] = std::make_shared<MaterialSemantic>("matModelView", GraphicsUniformType::GraphicsUniformTypeFloat4x4);
 	_parametes[GlobalSemanticType::GlobalSemanticTypeModelViewProject] = std::make_shared<MaterialSemantic>("matModelViewProject", GraphicsUniformType::GraphicsUniformTypeFloat4x4);
 	_parametes[GlobalSemanticType::GlobalSemanticTypeModelViewInverse] = std::make_shared<MaterialSemantic>("matModelViewInverse", GraphicsUniformType::GraphicsUniformTypeFloat4x4);
+	_parametes[GlobalSemanticType::GlobalSemanticTypeModelBuffer] = std::make_shared<MaterialSemantic>("matModelBuffer", GraphicsUniformType::GraphicsUniformTypeUniformBuffer);
 
 	_parametes[GlobalSemanticType::GlobalSemanticTypeCameraAperture] = std::make_shared<MaterialSemantic>("CameraAperture", GraphicsUniformType::GraphicsUniformTypeFloat);
 	_parametes[GlobalSemanticType::GlobalSemanticTypeCameraNear] = std::make_shared<MaterialSemantic>("CameraNear", GraphicsUniformType::GraphicsUniformTypeFloat);
@@ -0,0 +1,466 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/occlusion_buffer.h>
+#include <ray/thread.h>
+
+#if defined(__SSE__)
+#	include <xmmintrin.h>
+#endif
+
+_NAME_BEGIN
+
+// the depth buffer stores the nearest occluder depth (z / w) per pixel, every 8x8 tile keeps
+// the farthest of its pixels so that most occludees are rejected without touching the pixels.
+static const std::uint32_t OcclusionTileSize = 8;
+static const float OcclusionClearDepth = std::numeric_limits<float>::max();
+static const float OcclusionMinW = 1e-5f;
+
+OcclusionHull::OcclusionHull() noexcept
+{
+}
+
+OcclusionHull::OcclusionHull(const float3* vertices, std::size_t numVertices, const std::uint32_t* indices, std::size_t numIndices) noexcept
+	: _vertices(vertices, vertices + numVertices)
+	, _indices(indices, indices + numIndices)
+{
+}
+
+OcclusionHull::~OcclusionHull() noexcept
+{
+}
+
+void
+OcclusionHull::setVertices(std::vector<float3>&& vertices) noexcept
+{
+	_vertices = std::move(vertices);
+}
+
+void
+OcclusionHull::setIndices(std::vector<std::uint32_t>&& indices) noexcept
+{
+	_indices = std::move(indices);
+}
+
+const std::vector<float3>&
+OcclusionHull::getVertices() const noexcept
+{
+	return _vertices;
+}
+
+const std::vector<std::uint32_t>&
+OcclusionHull::getIndices() const noexcept
+{
+	return _indices;
+}
+
+std::size_t
+OcclusionHull::getNumTriangles() const noexcept
+{
+	return _indices.size() / 3;
+}
+
+OcclusionBuffer::OcclusionBuffer() noexcept
+	: _width(0)
+	, _height(0)
+	, _tileCountX(0)
+	, _tileCountY(0)
+	, _numTriangles(0)
+	, _viewProject(float4x4::One)
+{
+}
+
+OcclusionBuffer::~OcclusionBuffer() noexcept
+{
+}
+
+void
+OcclusionBuffer::setup(std::uint32_t width, std::uint32_t height) noexcept
+{
+	assert(width > 0 && height > 0);
+
+	_tileCountX = (width + OcclusionTileSize - 1) / OcclusionTileSize;
+	_tileCountY = (height + OcclusionTileSize - 1) / OcclusionTileSize;
+
+	_width = _tileCountX * OcclusionTileSize;
+	_height = _tileCountY * OcclusionTileSize;
+
+	_depth.resize(_width * _height);
+	_depthTiles.resize(_tileCountX * _tileCountY);
+}
+
+std::uint32_t
+OcclusionBuffer::getWidth() const noexcept
+{
+	return _width;
+}
+
+std::uint32_t
+OcclusionBuffer::getHeight() const noexcept
+{
+	return _height;
+}
+
+void
+OcclusionBuffer::clear(const float4x4& viewProject) noexcept
+{
+	_viewProject = viewProject;
+	_numTriangles = 0;
+
+	_occluders.clear();
+
+	std::fill(_depth.begin(), _depth.end(), OcclusionClearDepth);
+	std::fill(_depthTiles.begin(), _depthTiles.end(), OcclusionClearDepth);
+}
+
+void
+OcclusionBuffer::addOccluder(const OcclusionHull& hull, const float4x4& transform) noexcept
+{
+	if (hull.getNumTriangles() == 0)
+		return;
+
+	_occluders.push_back({ &hull, transform });
+}
+
+void
+OcclusionBuffer::rasterize() noexcept
+{
+	assert(_width > 0 && _height > 0);
+
+	if (_occluders.empty())
+		return;
+
+	auto threadPool = ThreadPool::instance();
+
+	std::size_t jobs = std::min(_occluders.size(), threadPool->getThreadCount() + 1);
+	if (_triangles.size() < jobs)
+		_triangles.resize(jobs);
+
+	for (auto& it : _triangles)
+		it.clear();
+
+	ThreadTaskGroup group;
+
+	threadPool->exce(group, jobs, [&](std::size_t i)
+	{
+		for (std::size_t j = i; j < _occluders.size(); j += jobs)
+			this->setupTriangles(_occluders[j], _triangles[i]);
+	});
+
+	threadPool->wait(group);
+
+	_numTriangles = 0;
+	for (auto& it : _triangles)
+		_numTriangles += it.size();
+
+	if (_numTriangles == 0)
+		return;
+
+	threadPool->exce(group, _tileCountY, [this](std::size_t i) { this->rasterizeTile(static_cast<std::uint32_t>(i)); });
+	threadPool->wait(group);
+}
+
+bool
+OcclusionBuffer::isVisiable(const AABB& aabb) const noexcept
+{
+	if (_occluders.empty())
+		return true;
+
+	float minX = std::numeric_limits<float>::max();
+	float minY = std::numeric_limits<float>::max();
+	float minZ = std::numeric_limits<float>::max();
+	float maxX = -std::numeric_limits<float>::max();
+	float maxY = -std::numeric_limits<float>::max();
+
+	for (std::uint8_t i = 0; i < 8; i++)
+	{
+		float4 corner(
+			i & 1 ? aabb.max.x : aabb.min.x,
+			i & 2 ? aabb.max.y : aabb.min.y,
+			i & 4 ? aabb.max.z : aabb.min.z,
+			1.0f);
+
+		float4 v = _viewProject * corner;
+		if (v.w < OcclusionMinW)
+			return true;
+
+		float x = (v.x / v.w * 0.5f + 0.5f) * _width;
+		float y = (v.y / v.w * 0.5f + 0.5f) * _height;
+
+		minX = std::min(minX, x);
+		minY = std::min(minY, y);
+		maxX = std::max(maxX, x);
+		maxY = std::max(maxY, y);
+		minZ = std::min(minZ, v.z / v.w);
+	}
+
+	if (maxX < 0.0f || maxY < 0.0f || minX >= _width || minY >= _height)
+		return true;
+
+	std::int32_t x0 = std::max(0, static_cast<std::int32_t>(std::floor(minX)));
+	std::int32_t y0 = std::max(0, static_cast<std::int32_t>(std::floor(minY)));
+	std::int32_t x1 = std::min(static_cast<std::int32_t>(_width) - 1, static_cast<std::int32_t>(std::floor(maxX)));
+	std::int32_t y1 = std::min(static_cast<std::int32_t>(_height) - 1, static_cast<std::int32_t>(std::floor(maxY)));
+
+	for (std::int32_t tileY = y0 / OcclusionTileSize; tileY <= y1 / static_cast<std::int32_t>(OcclusionTileSize); tileY++)
+	{
+		for (std::int32_t tileX = x0 / OcclusionTileSize; tileX <= x1 / static_cast<std::int32_t>(OcclusionTileSize); tileX++)
+		{
+			if (_depthTiles[tileY * _tileCountX + tileX] < minZ)
+				continue;
+
+			std::int32_t beginX = std::max<std::int32_t>(x0, tileX * OcclusionTileSize);
+			std::int32_t beginY = std::max<std::int32_t>(y0, tileY * OcclusionTileSize);
+			std::int32_t endX = std::min<std::int32_t>(x1, tileX * OcclusionTileSize + OcclusionTileSize - 1);
+			std::int32_t endY = std::min<std::int32_t>(y1, tileY * OcclusionTileSize + OcclusionTileSize - 1);
+
+			for (std::int32_t y = beginY; y <= endY; y++)
+			{
+				const float* row = _depth.data() + y * _width;
+				for (std::int32_t x = beginX; x <= endX; x++)
+				{
+					if (row[x] >= minZ)
+						return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+std::size_t
+OcclusionBuffer::getNumOccluders() const noexcept
+{
+	return _occluders.size();
+}
+
+std::size_t
+OcclusionBuffer::getNumTriangles() const noexcept
+{
+	return _numTriangles;
+}
+
+const std::vector<float>&
+OcclusionBuffer::getDepthBuffer() const noexcept
+{
+	return _depth;
+}
+
+void
+OcclusionBuffer::setupTriangles(const Occluder& occluder, Triangles& triangles) const noexcept
+{
+	float4x4 transform = _viewProject * occluder.transform;
+
+	const auto& vertices = occluder.hull->getVertices();
+	const auto& indices = occluder.hull->getIndices();
+
+	std::vector<float4> clip(vertices.size());
+	for (std::size_t i = 0; i < vertices.size(); i++)
+		clip[i] = transform * float4(vertices[i], 1.0f);
+
+	for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+	{
+		const float4* v[3] = { &clip[indices[i]], &clip[indices[i + 1]], &clip[indices[i + 2]] };
+
+		// triangles crossing the near plane are dropped rather than clipped, which only
+		// makes the occluder smaller and keeps the result conservative.
+		if (v[0]->w < OcclusionMinW || v[1]->w < OcclusionMinW || v[2]->w < OcclusionMinW)
+			continue;
+
+		if ((v[0]->x > v[0]->w && v[1]->x > v[1]->w && v[2]->x > v[2]->w) ||
+			(v[0]->x < -v[0]->w && v[1]->x < -v[1]->w && v[2]->x < -v[2]->w) ||
+			(v[0]->y > v[0]->w && v[1]->y > v[1]->w && v[2]->y > v[2]->w) ||
+			(v[0]->y < -v[0]->w && v[1]->y < -v[1]->w && v[2]->y < -v[2]->w) ||
+			(v[0]->z > v[0]->w && v[1]->z > v[1]->w && v[2]->z > v[2]->w))
+			continue;
+
+		Triangle triangle;
+
+		for (std::uint8_t j = 0; j < 3; j++)
+		{
+			triangle.x[j] = (v[j]->x / v[j]->w * 0.5f + 0.5f) * _width;
+			triangle.y[j] = (v[j]->y / v[j]->w * 0.5f + 0.5f) * _height;
+			triangle.z[j] = v[j]->z / v[j]->w;
+		}
+
+		float area = (triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) - (triangle.x[2] - triangle.x[0]) * (triangle.y[1] - triangle.y[0]);
+		if (std::abs(area) < 1e-6f)
+			continue;
+
+		if (area < 0.0f)
+		{
+			std::swap(triangle.x[1], triangle.x[2]);
+			std::swap(triangle.y[1], triangle.y[2]);
+			std::swap(triangle.z[1], triangle.z[2]);
+		}
+
+		float minX = std::min(triangle.x[0], std::min(triangle.x[1], triangle.x[2]));
+		float minY = std::min(triangle.y[0], std::min(triangle.y[1], triangle.y[2]));
+		float maxX = std::max(triangle.x[0], std::max(triangle.x[1], triangle.x[2]));
+		float maxY = std::max(triangle.y[0], std::max(triangle.y[1], triangle.y[2]));
+
+		triangle.minX = std::max(0, static_cast<std::int32_t>(std::floor(minX)));
+		triangle.minY = std::max(0, static_cast<std::int32_t>(std::floor(minY)));
+		triangle.maxX = std::min(static_cast<std::int32_t>(_width) - 1, static_cast<std::int32_t>(std::floor(maxX)));
+		triangle.maxY = std::min(static_cast<std::int32_t>(_height) - 1, static_cast<std::int32_t>(std::floor(maxY)));
+
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+			continue;
+
+		triangles.push_back(triangle);
+	}
+}
+
+void
+OcclusionBuffer::rasterizeTile(std::uint32_t tileY) noexcept
+{
+	std::int32_t beginY = tileY * OcclusionTileSize;
+	std::int32_t endY = beginY + OcclusionTileSize - 1;
+
+	for (auto& triangles : _triangles)
+	{
+		for (auto& it : triangles)
+		{
+			if (it.maxY < beginY || it.minY > endY)
+				continue;
+
+			this->rasterizeTriangle(it, std::max(it.minY, beginY), std::min(it.maxY, endY));
+		}
+	}
+
+	for (std::uint32_t tileX = 0; tileX < _tileCountX; tileX++)
+	{
+		float depth = -std::numeric_limits<float>::max();
+
+		for (std::uint32_t y = 0; y < OcclusionTileSize; y++)
+		{
+			const float* row = _depth.data() + (beginY + y) * _width + tileX * OcclusionTileSize;
+			for (std::uint32_t x = 0; x < OcclusionTileSize; x++)
+				depth = std::max(depth, row[x]);
+		}
+
+		_depthTiles[tileY * _tileCountX + tileX] = depth;
+	}
+}
+
+void
+OcclusionBuffer::rasterizeTriangle(const Triangle& triangle, std::int32_t minY, std::int32_t maxY) noexcept
+{
+	// edge functions are positive inside the counter-clockwise triangle, pixels are sampled at their centers.
+	float a[3], b[3], c[3];
+	for (std::uint8_t i = 0; i < 3; i++)
+	{
+		std::uint8_t j = (i + 1) % 3;
+		a[i] = triangle.y[i] - triangle.y[j];
+		b[i] = triangle.x[j] - triangle.x[i];
+		c[i] = triangle.x[i] * triangle.y[j] - triangle.y[i] * triangle.x[j];
+	}
+
+	float x1 = triangle.x[1] - triangle.x[0];
+	float y1 = triangle.y[1] - triangle.y[0];
+	float x2 = triangle.x[2] - triangle.x[0];
+	float y2 = triangle.y[2] - triangle.y[0];
+	float z1 = triangle.z[1] - triangle.z[0];
+	float z2 = triangle.z[2] - triangle.z[0];
+
+	float area = x1 * y2 - x2 * y1;
+	float dzdx = (z1 * y2 - z2 * y1) / area;
+	float dzdy = (z2 * x1 - z1 * x2) / area;
+	float dz = triangle.z[0] - dzdx * triangle.x[0] - dzdy * triangle.y[0];
+
+	std::int32_t minX = triangle.minX & ~3;
+
+#if defined(__SSE__)
+	__m128 zero = _mm_setzero_ps();
+	__m128 offset = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+
+	__m128 a0 = _mm_set1_ps(a[0]);
+	__m128 a1 = _mm_set1_ps(a[1]);
+	__m128 a2 = _mm_set1_ps(a[2]);
+	__m128 zx = _mm_set1_ps(dzdx);
+
+	for (std::int32_t y = minY; y <= maxY; y++)
+	{
+		float py = y + 0.5f;
+
+		__m128 e0 = _mm_set1_ps(b[0] * py + c[0]);
+		__m128 e1 = _mm_set1_ps(b[1] * py + c[1]);
+		__m128 e2 = _mm_set1_ps(b[2] * py + c[2]);
+		__m128 zy = _mm_set1_ps(dzdy * py + dz);
+
+		float* row = _depth.data() + y * _width;
+
+		for (std::int32_t x = minX; x <= triangle.maxX; x += 4)
+		{
+			__m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), offset);
+
+			__m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a0, px), e0), zero);
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a1, px), e1), zero));
+			inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(a2, px), e2), zero));
+
+			if (_mm_movemask_ps(inside) == 0)
+				continue;
+
+			__m128 depth = _mm_loadu_ps(row + x);
+			__m128 z = _mm_min_ps(depth, _mm_add_ps(_mm_mul_ps(zx, px), zy));
+
+			_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, z), _mm_andnot_ps(inside, depth)));
+		}
+	}
+#else
+	for (std::int32_t y = minY; y <= maxY; y++)
+	{
+		float py = y + 0.5f;
+
+		float* row = _depth.data() + y * _width;
+
+		for (std::int32_t x = minX; x <= triangle.maxX; x++)
+		{
+			float px = x + 0.5f;
+
+			if (a[0] * px + b[0] * py + c[0] < 0.0f ||
+				a[1] * px + b[1] * py + c[1] < 0.0f ||
+				a[2] * px + b[2] * py + c[2] < 0.0f)
+				continue;
+
+			row[x] = std::min(row[x], dzdx * px + dzdy * py + dz);
+		}
+	}
+#endif
+}
+
+_NAME_END
\ No newline at end of file
@@ -51,12 +51,15 @@ RenderListener::~RenderListener() noexcept
 
 RenderObject::RenderObject() noexcept
 	: _visible(true)
+	, _static(false)
 	, _layer(0)
 	, _boundingBox(Vector3::Zero, Vector3::Zero)
 	, _worldBoundingxBox(Vector3::Zero, Vector3::Zero)
 	, _transform(float4x4::One)
 	, _transformInverse(float4x4::One)
 	, _renderListener(nullptr)
+	, _renderSceneProxy(-1)
+	, _renderSceneIndex(-1)
 {
 }
 
@@ -80,7 +83,13 @@ RenderObject::getLayer() const noexcept
 void
 RenderObject::setVisible(bool enable) noexcept
 {
-	_visible = enable;
+	if (_visible != enable)
+	{
+		if (_static && _renderScene)
+			_renderScene->addStaticChange(this->getBoundingBoxInWorld().aabb());
+
+		_visible = enable;
+	}
 }
 
 bool
@@ -89,11 +98,32 @@ RenderObject::getVisible() const noexcept
 	return _visible;
 }
 
+void
+RenderObject::setStatic(bool enable) noexcept
+{
+	if (_static != enable)
+	{
+		if (_renderScene)
+			_renderScene->addStaticChange(this->getBoundingBoxInWorld().aabb());
+
+		_static = enable;
+	}
+}
+
+bool
+RenderObject::getStatic() const noexcept
+{
+	return _static;
+}
+
 void
 RenderObject::setBoundingBox(const BoundingBox& bound) noexcept
 {
 	_worldBoundingxBox = _boundingBox = bound;
 	_worldBoundingxBox.transform(_transform);
+
+	if (_renderScene)
+		_renderScene->moveRenderObject(this);
 }
 
 const BoundingBox&
@@ -108,6 +138,18 @@ RenderObject::getBoundingBoxInWorld() const noexcept
 	return _worldBoundingxBox;
 }
 
+void
+RenderObject::setOcclusionHull(const OcclusionHullPtr& hull) noexcept
+{
+	_occlusionHull = hull;
+}
+
+const OcclusionHullPtr&
+RenderObject::getOcclusionHull() const noexcept
+{
+	return _occlusionHull;
+}
+
 void
 RenderObject::setOwnerListener(RenderListener* listener) noexcept
 {
@@ -163,6 +205,9 @@ RenderObject::setTransform(const float4x4& transform, const float4x4& transformI
 	_worldBoundingxBox.transform(_transform);
 
 	this->onMoveAfter();
+
+	if (_renderScene)
+		_renderScene->moveRenderObject(this);
 }
 
 const Vector3&
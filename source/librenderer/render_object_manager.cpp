@@ -39,10 +39,52 @@
 #include <ray/light.h>
 #include <ray/geometry.h>
 #include <ray/material.h>
+#include <ray/thread.h>
+#include <ray/radix_sort.h>
+
+#include <cstring>
+#include <chrono>
 
 _NAME_BEGIN
 
+// occluders are picked per frame by their squared bounding size over squared distance, largest first,
+// until the triangle budget of the low resolution occlusion buffer is spent.
+static const float OccluderMinScreenSize = 0.01f;
+static const std::size_t OccluderMaxTriangles = 16384;
+static const std::uint32_t OcclusionBufferWidth = 256;
+static const std::size_t OccludeeChunkSize = 256;
+
+static std::uint64_t
+hashRenderKey(const void* ptr) noexcept
+{
+	auto value = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr));
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	return value & 0xFFFF;
+}
+
+static std::uint32_t
+depthRenderKey(float depth) noexcept
+{
+	std::uint32_t bits;
+	std::memcpy(&bits, &depth, sizeof(bits));
+	return bits & 0x7FFFFFFF;
+}
+
+static bool
+isTransparentQueue(RenderQueue queue) noexcept
+{
+	return queue >= RenderQueue::RenderQueueTransparentBack && queue <= RenderQueue::RenderQueueTransparentShadingFront;
+}
+
 DefaultRenderDataManager::DefaultRenderDataManager() noexcept
+	: _visiableDepth(0.0f)
+	, _numOccluders(0)
+	, _numOccluderTriangles(0)
+	, _numOccludees(0)
+	, _numOccluded(0)
+	, _occlusionTime(0.0)
 {
 }
 
@@ -55,7 +97,7 @@ DefaultRenderDataManager::addRenderData(RenderQueue queue, RenderObject* object)
 {
 	assert(object);
 	assert(queue >= RenderQueue::RenderQueueBeginRange && queue <= RenderQueue::RenderQueueEndRange);
-	_renderQueue[queue].push_back(object);
+	_renderKeys[queue].push_back({ this->makeRenderKey(queue, object), object });
 }
 
 const RenderObjectRaws&
@@ -69,9 +111,19 @@ void
 DefaultRenderDataManager::assginVisiable(const Camera& camera) noexcept
 {
 	_visiable.clear();
+	_visiableDepth = 0.0f;
+
+	_numOccluders = 0;
+	_numOccluderTriangles = 0;
+	_numOccludees = 0;
+	_numOccluded = 0;
+	_occlusionTime = 0.0;
 
-	for (std::size_t i = RenderQueue::RenderQueueBeginRange; i < RenderQueue::RenderQueueEndRange; i++)
+	for (std::size_t i = 0; i < RenderQueue::RenderQueueRangeSize; i++)
+	{
 		_renderQueue[i].clear();
+		_renderKeys[i].clear();
+	}
 
 	auto cameraOrder = camera.getCameraOrder();
 	if (cameraOrder == CameraOrder::CameraOrder3D ||
@@ -80,78 +132,189 @@ DefaultRenderDataManager::assginVisiable(const Camera& camera) noexcept
 	{
 		auto scene = camera.getRenderScene();
 		assert(scene);
-		scene->computVisiable(camera, _visiable);
 
-		this->sortDistance(_visiable);
+		if (camera.getCameraType() == CameraType::CameraTypeCube)
+		{
+			scene->computVisiable(camera, _visiable);
+		}
+		else
+		{
+			Frustum fru(camera.getViewProject());
+
+			scene->computVisiableMask(fru, _visiableMask);
+
+			const auto& objects = scene->getRenderObjectList();
+
+			for (std::size_t i = 0; i < _visiableMask.size(); i++)
+			{
+				std::size_t index = i << 5;
+
+				for (std::uint32_t bits = _visiableMask[i]; bits; bits >>= 1, index++)
+				{
+					if (!(bits & 1))
+						continue;
+
+					auto object = objects[index];
+					if (!object->getVisible())
+						continue;
+
+					if (object->onVisiableTest(camera, fru))
+						_visiable.insert(object, math::sqrDistance(camera.getTranslate(), object->getTranslate()));
+				}
+			}
+
+			if (cameraOrder == CameraOrder::CameraOrder3D && camera.getOcclusionCull())
+				this->computeOcclusion(camera);
+		}
 
 		for (auto& it : _visiable.iter())
 		{
+			_visiableDepth = it.getDistanceSqrt();
+
 			auto object = it.getOcclusionCullNode();
 			object->onAddRenderData(*this);
 		}
+
+		for (std::size_t i = 0; i < RenderQueue::RenderQueueRangeSize; i++)
+		{
+			auto& keys = _renderKeys[i];
+			if (keys.empty())
+				continue;
+
+			radixSort64(keys, _renderKeysTemp);
+
+			auto& queue = _renderQueue[i];
+			queue.resize(keys.size());
+
+			for (std::size_t j = 0; j < keys.size(); j++)
+				queue[j] = keys[j].object;
+		}
 	}
 }
 
 void
-DefaultRenderDataManager::sortMaterial(RenderObjectRaws& list) noexcept
+DefaultRenderDataManager::computeOcclusion(const Camera& camera) noexcept
 {
-	std::sort(list.begin(), list.end(),
-		[](RenderObject* lh, RenderObject* rh)
+	auto begin = std::chrono::high_resolution_clock::now();
+
+	_occluders.clear();
+
+	for (auto& it : _visiable.iter())
 	{
-		MaterialPtr m1, m2;
-		if (lh->isInstanceOf<Geometry>())
-			m1 = lh->downcast<Geometry>()->getMaterial();
+		auto object = it.getOcclusionCullNode();
+		if (!object->getOcclusionHull())
+			continue;
 
-		if (rh->isInstanceOf<Geometry>())
-			m1 = rh->downcast<Geometry>()->getMaterial();
+		auto size = object->getBoundingBoxInWorld().aabb().size();
+		auto screenSize = math::length2(size) / std::max(it.getDistanceSqrt(), 1e-4f);
+		if (screenSize >= OccluderMinScreenSize)
+			_occluders.push_back(std::make_pair(screenSize, object));
+	}
 
-		return m1 < m2;
-	});
-}
+	if (_occluders.empty())
+		return;
 
-void
-DefaultRenderDataManager::sortMaterialDistance(RenderObjectRaws& objects) noexcept
-{
-	auto it1 = objects.begin();
-	auto it2 = ++objects.begin();
+	std::sort(_occluders.begin(), _occluders.end(), [](const std::pair<float, RenderObject*>& a, const std::pair<float, RenderObject*>& b) { return a.first > b.first; });
+
+	float ratio = camera.getRatio() > 0.0f ? camera.getRatio() : 1.0f;
+	float height = std::min(std::max(OcclusionBufferWidth / ratio, 32.0f), static_cast<float>(OcclusionBufferWidth));
 
-	auto end = objects.end();
+	_occlusionBuffer.setup(OcclusionBufferWidth, static_cast<std::uint32_t>(height));
+	_occlusionBuffer.clear(camera.getViewProject());
 
-	while (it2 != end)
+	std::size_t numTriangles = 0;
+
+	for (auto& it : _occluders)
 	{
-		MaterialPtr m1, m2;
+		const auto& hull = *it.second->getOcclusionHull();
+		if (numTriangles + hull.getNumTriangles() > OccluderMaxTriangles)
+			continue;
+
+		numTriangles += hull.getNumTriangles();
+		_occlusionBuffer.addOccluder(hull, it.second->getTransform());
+	}
 
-		if ((*it1)->isInstanceOf<Geometry>())
-			m1 = (*it1)->downcast<Geometry>()->getMaterial();
+	_occlusionBuffer.rasterize();
 
-		if ((*it2)->isInstanceOf<Geometry>())
-			m2 = (*it2)->downcast<Geometry>()->getMaterial();
+	auto& nodes = _visiable.iter();
+	_occludedMask.resize(nodes.size());
 
-		while (m1 == m2)
+	ThreadTaskGroup group;
+	ThreadPool::instance()->exce(group, (nodes.size() + OccludeeChunkSize - 1) / OccludeeChunkSize, [&](std::size_t i)
+	{
+		std::size_t end = std::min(nodes.size(), (i + 1) * OccludeeChunkSize);
+		for (std::size_t j = i * OccludeeChunkSize; j < end; j++)
 		{
-			if ((++it2) == end)
-				break;
+			auto object = nodes[j].getOcclusionCullNode();
+			if (object->isInstanceOf<Geometry>())
+				_occludedMask[j] = _occlusionBuffer.isVisiable(object->getBoundingBoxInWorld().aabb()) ? 1 : 2;
+			else
+				_occludedMask[j] = 0;
+		}
+	});
+	ThreadPool::instance()->wait(group);
 
-			m2 = (*it2)->downcast<Geometry>()->getMaterial();
-		};
+	std::size_t count = 0;
+	for (std::size_t i = 0; i < nodes.size(); i++)
+	{
+		if (_occludedMask[i])
+			_numOccludees++;
+
+		if (_occludedMask[i] == 2)
+			_numOccluded++;
+		else
+			nodes[count++] = nodes[i];
+	}
+
+	nodes.resize(count);
+
+	_numOccluders = static_cast<std::uint32_t>(_occlusionBuffer.getNumOccluders());
+	_numOccluderTriangles = static_cast<std::uint32_t>(_occlusionBuffer.getNumTriangles());
+	_occlusionTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+}
+
+std::uint64_t
+DefaultRenderDataManager::makeRenderKey(RenderQueue queue, RenderObject* object) const noexcept
+{
+	// key layout, most significant first:
+	//   opaque       | pipeline:16 | material:16 | vertex buffer:16 | depth:16 |  front-to-back
+	//   transparent  | inverse depth:32 | pipeline:16 | material:16 |             back-to-front
+	//   others       | depth:32 | 0:32 |                                          front-to-back
+	std::uint32_t depth = depthRenderKey(_visiableDepth);
 
-		std::size_t count = it2 - it1;
-		if (count > 1)
-			std::sort(it1, it2);
+	if (!object->isInstanceOf<Geometry>())
+		return static_cast<std::uint64_t>(depth) << 32;
 
-		if (it2 != end)
-			it1 = it2++;
+	auto geometry = object->downcast<Geometry>();
+
+	const GraphicsPipeline* pipeline = nullptr;
+
+	const auto& tech = geometry->getMaterialTech(queue);
+	if (tech)
+	{
+		const auto& passList = tech->getPassList();
+		if (!passList.empty())
+			pipeline = passList.front()->getRenderPipeline().get();
 	}
+
+	std::uint64_t pipelineKey = hashRenderKey(pipeline);
+	std::uint64_t materialKey = hashRenderKey(geometry->getMaterial().get());
+
+	if (isTransparentQueue(queue))
+		return static_cast<std::uint64_t>(0x7FFFFFFF - depth) << 32 | pipelineKey << 16 | materialKey;
+
+	std::uint64_t vertexKey = hashRenderKey(geometry->getVertexBuffer().get());
+	return pipelineKey << 48 | materialKey << 32 | vertexKey << 16 | depth >> 15;
 }
 
 void
-DefaultRenderDataManager::sortDistance(OcclusionCullList& objects) noexcept
+DefaultRenderDataManager::collectStatistics(RenderStatistics& statistics) const noexcept
 {
-	std::sort(objects.iter().begin(), objects.iter().end(),
-		[](const OcclusionCullNode& lh, const OcclusionCullNode& rh)
-	{
-		return lh.getDistanceSqrt() < rh.getDistanceSqrt();
-	});
+	statistics.occlusionTime += _occlusionTime;
+	statistics.numOccluders += _numOccluders;
+	statistics.numOccluderTriangles += _numOccluderTriangles;
+	statistics.numOccludees += _numOccludees;
+	statistics.numOccluded += _numOccluded;
 }
 
 void
@@ -46,4 +46,9 @@ RenderDataManager::~RenderDataManager() noexcept
 {
 }
 
+void
+RenderDataManager::collectStatistics(RenderStatistics&) const noexcept
+{
+}
+
 _NAME_END
\ No newline at end of file
@@ -46,6 +46,8 @@
 #include <ray/graphics_swapchain.h>
 #include <ray/graphics_texture.h>
 #include <ray/graphics_framebuffer.h>
+#include <ray/graphics_pipeline.h>
+#include <ray/graphics_input_layout.h>
 
 #include <ray/camera.h>
 #include <ray/geometry.h>
@@ -54,6 +56,8 @@
 #include <ray/render_object_manager.h>
 
 #include <ray/material.h>
+#include <ray/material_pass.h>
+#include <ray/material_tech.h>
 #include <ray/material_semantic.h>
 #include <ray/material_manager.h>
 
@@ -63,6 +67,29 @@ __ImplementSubClass(RenderPipeline, rtti::Interface, "RenderPipeline")
 
 static float4x4 adjustProject = (float4x4().makeScale(1.0, 1.0, 2.0).setTranslate(0, 0, -1));
 
+static bool
+isInstancingTech(const MaterialTech& tech) noexcept
+{
+	auto& passList = tech.getPassList();
+	if (passList.empty())
+		return false;
+
+	for (auto& pass : passList)
+	{
+		auto& bindings = pass->getRenderPipeline()->getGraphicsPipelineDesc().getGraphicsInputLayout()->getGraphicsInputLayoutDesc().getVertexBindings();
+
+		auto it = std::find_if(bindings.begin(), bindings.end(), [](const GraphicsVertexBinding& binding)
+		{
+			return binding.getVertexSlot() == 1 && binding.getVertexDivisor() == GraphicsVertexDivisor::GraphicsVertexDivisorInstance;
+		});
+
+		if (it == bindings.end())
+			return false;
+	}
+
+	return true;
+}
+
 RenderPipeline::RenderPipeline() noexcept
 	: _width(0)
 	, _height(0)
@@ -75,6 +102,10 @@ RenderPipeline::RenderPipeline() noexcept
 	, _planeIndexType(GraphicsIndexType::GraphicsIndexTypeUInt16)
 	, _coneIndexType(GraphicsIndexType::GraphicsIndexTypeUInt16)
 	, _sphereIndexType(GraphicsIndexType::GraphicsIndexTypeUInt16)
+	, _drawCalls(0)
+	, _drawInstances(0)
+	, _instanceOffset(0)
+	, _modelDataDirty(true)
 {
 }
 
@@ -114,6 +145,8 @@ RenderPipeline::close() noexcept
 	this->destroyBaseMeshes();
 	this->destroyMaterialSemantic();
 	this->destroyDataManager();
+	this->destroyInstanceData();
+	this->destroyModelData();
 }
 
 void
@@ -145,6 +178,8 @@ RenderPipeline::setTransform(const float4x4& transform) noexcept
 	_semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelView)->uniform4fmat(modelView);
 	_semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelViewProject)->uniform4fmat(viewProject * transform);
 	_semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelViewInverse)->uniform4fmat(modelViewInverse);
+
+	_modelDataDirty = true;
 }
 
 void
@@ -152,6 +187,7 @@ RenderPipeline::setTransformInverse(const float4x4& transform) noexcept
 {
 	assert(_semanticsManager);
 	_semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelInverse)->uniform4fmat(transform);
+	_modelDataDirty = true;
 }
 
 const MaterialSemanticPtr&
@@ -221,6 +257,10 @@ RenderPipeline::renderBegin() noexcept
 {
 	assert(_graphicsContext);
 	_graphicsContext->renderBegin();
+
+	_drawCalls = 0;
+	_drawInstances = 0;
+	_instanceOffset = 0;
 }
 
 void
@@ -325,6 +365,9 @@ RenderPipeline::discardFramebuffer(std::uint32_t i) noexcept
 void
 RenderPipeline::setMaterialPass(const MaterialPassPtr& pass) noexcept
 {
+	if (_modelDataDirty && pass->hasSemantic(GlobalSemanticType::GlobalSemanticTypeModelBuffer))
+		this->updateModelData();
+
 	pass->update(*_semanticsManager);
 	_graphicsContext->setRenderPipeline(pass->getRenderPipeline());
 	_graphicsContext->setDescriptorSet(pass->getDescriptorSet());
@@ -418,12 +461,16 @@ RenderPipeline::drawScreenQuadLayer(const MaterialTech& tech, std::uint32_t laye
 void
 RenderPipeline::draw(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t startVertice, std::uint32_t startInstances) noexcept
 {
+	_drawCalls++;
+	_drawInstances += numInstances;
 	_graphicsContext->draw(numVertices, numInstances, startVertice, startInstances);
 }
 
 void
 RenderPipeline::drawIndexed(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t startIndice, std::uint32_t startVertice, std::uint32_t startInstances) noexcept
 {
+	_drawCalls++;
+	_drawInstances += numInstances;
 	_graphicsContext->drawIndexed(numIndices, numInstances, startIndice, startVertice, startInstances);
 }
 
@@ -431,34 +478,202 @@ void
 RenderPipeline::drawLayer(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t startVertice, std::uint32_t startInstances, std::uint32_t layer) noexcept
 {
 	_graphicsContext->setStencilReference(GraphicsStencilFaceFlagBits::GraphicsStencilFaceAllBit, 1 << layer);
-	_graphicsContext->draw(numVertices, numInstances, startVertice, startInstances);
+	this->draw(numVertices, numInstances, startVertice, startInstances);
 }
 
 void
 RenderPipeline::drawIndexedLayer(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t startIndice, std::uint32_t startVertice, std::uint32_t startInstances, std::uint32_t layer) noexcept
 {
 	_graphicsContext->setStencilReference(GraphicsStencilFaceFlagBits::GraphicsStencilFaceAllBit, 1 << layer);
-	_graphicsContext->drawIndexed(numIndices, numInstances, startIndice, startVertice, startInstances);
+	this->drawIndexed(numIndices, numInstances, startIndice, startVertice, startInstances);
 }
 
 void
 RenderPipeline::drawRenderQueue(RenderQueue queue) noexcept
 {
-	assert(_camera);
-
-	auto& renderable = _camera->getRenderDataManager()->getRenderData(queue);
-	for (auto& it : renderable)
-		it->onRenderObject(*this, queue, nullptr);
+	this->drawRenderObjects(queue, nullptr);
 }
 
 void
 RenderPipeline::drawRenderQueue(RenderQueue queue, const MaterialTechPtr& tech) noexcept
+{
+	this->drawRenderObjects(queue, tech.get());
+}
+
+void
+RenderPipeline::drawRenderObjects(RenderQueue queue, MaterialTech* tech) noexcept
 {
 	assert(_camera);
 
 	auto& renderable = _camera->getRenderDataManager()->getRenderData(queue);
-	for (auto& it : renderable)
-		it->onRenderObject(*this, queue, tech.get());
+
+	_instanceBatchs.clear();
+	_instanceTransforms.clear();
+
+	for (std::size_t i = 0; i < renderable.size();)
+	{
+		InstanceBatch batch;
+		batch.first = i++;
+		batch.count = 1;
+		batch.offset = 0;
+		batch.tech = nullptr;
+
+		auto object = renderable[batch.first];
+		if (object->isInstanceOf<Geometry>())
+		{
+			auto geometry = object->downcast<Geometry>();
+			auto instanceTech = tech ? tech : geometry->getMaterialTech(queue).get();
+			if (instanceTech && isInstancingTech(*instanceTech))
+			{
+				batch.tech = instanceTech;
+				batch.offset = _instanceTransforms.size() * sizeof(float4x4);
+
+				_instanceTransforms.push_back(geometry->getTransform());
+
+				for (; i < renderable.size(); i++, batch.count++)
+				{
+					auto next = renderable[i];
+					if (!next->isInstanceOf<Geometry>() || !geometry->isInstancing(*next->downcast<Geometry>(), queue))
+						break;
+
+					_instanceTransforms.push_back(next->getTransform());
+				}
+			}
+		}
+
+		_instanceBatchs.push_back(batch);
+	}
+
+	std::intptr_t offset = 0;
+	bool instancing = _instanceTransforms.empty() ? false : this->updateInstanceData(offset);
+
+	for (auto& batch : _instanceBatchs)
+	{
+		if (batch.tech)
+		{
+			// without instance data the batch is still drawn, one object at a time
+			if (!instancing)
+			{
+				for (std::size_t i = batch.first; i < batch.first + batch.count; i++)
+					renderable[i]->onRenderObject(*this, queue, tech);
+				continue;
+			}
+
+			this->setVertexBuffer(1, _instanceData, offset + batch.offset);
+
+			auto geometry = renderable[batch.first]->downcast<Geometry>();
+			geometry->onRenderObjectInstancing(*this, queue, tech, static_cast<std::uint32_t>(batch.count));
+		}
+		else
+		{
+			renderable[batch.first]->onRenderObject(*this, queue, tech);
+		}
+	}
+}
+
+bool
+RenderPipeline::updateInstanceData(std::intptr_t& offset) noexcept
+{
+	std::size_t size = _instanceTransforms.size() * sizeof(float4x4);
+	std::size_t capacity = _instanceData ? _instanceData->getGraphicsDataDesc().getStreamSize() : 0;
+
+	if (_instanceOffset + size > capacity)
+	{
+		capacity = std::max<std::size_t>(capacity * 2, sizeof(float4x4) * 4096);
+		while (capacity < size)
+			capacity *= 2;
+
+		GraphicsDataDesc instanceDesc;
+		instanceDesc.setType(GraphicsDataType::GraphicsDataTypeStorageVertexBuffer);
+		instanceDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit);
+		instanceDesc.setStreamSize(capacity);
+
+		_instanceData = this->createGraphicsData(instanceDesc);
+		_instanceOffset = 0;
+
+		if (!_instanceData)
+			return false;
+	}
+
+	void* data = nullptr;
+	if (!_instanceData->map(_instanceOffset, size, &data))
+		return false;
+
+	std::memcpy(data, _instanceTransforms.data(), size);
+	_instanceData->unmap();
+
+	offset = _instanceOffset;
+	_instanceOffset += size;
+
+	return true;
+}
+
+bool
+RenderPipeline::updateModelData() noexcept
+{
+	float4x4 model[5];
+	model[0] = _semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModel)->getFloat4x4();
+	model[1] = _semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelInverse)->getFloat4x4();
+	model[2] = _semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelView)->getFloat4x4();
+	model[3] = _semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelViewProject)->getFloat4x4();
+	model[4] = _semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelViewInverse)->getFloat4x4();
+
+	auto& semantic = _semanticsManager->getSemantic(GlobalSemanticType::GlobalSemanticTypeModelBuffer);
+
+	std::uint32_t offset = 0;
+	if (_graphicsContext->uploadUniformStreamData(model, sizeof(model), offset))
+	{
+		semantic->uniformBuffer(_graphicsContext->getUniformStreamData(), offset, sizeof(model));
+		_modelDataDirty = false;
+		return true;
+	}
+
+	if (!_modelData)
+	{
+		GraphicsDataDesc modelDesc;
+		modelDesc.setType(GraphicsDataType::GraphicsDataTypeUniformBuffer);
+		modelDesc.setUsage(GraphicsUsageFlagBits::GraphicsUsageFlagWriteBit);
+		modelDesc.setStreamSize(sizeof(model));
+
+		_modelData = this->createGraphicsData(modelDesc);
+		if (!_modelData)
+			return false;
+	}
+
+	void* data = nullptr;
+	if (!_modelData->map(0, sizeof(model), &data))
+		return false;
+
+	std::memcpy(data, model, sizeof(model));
+	_modelData->unmap();
+
+	semantic->uniformBuffer(_modelData);
+	_modelDataDirty = false;
+	return true;
+}
+
+std::uint32_t
+RenderPipeline::getDrawCallCount() const noexcept
+{
+	return _drawCalls;
+}
+
+std::uint32_t
+RenderPipeline::getDrawInstanceCount() const noexcept
+{
+	return _drawInstances;
+}
+
+std::uint32_t
+RenderPipeline::getUniformUploadBytes() const noexcept
+{
+	return _graphicsContext->getUniformUploadBytes();
+}
+
+std::uint32_t
+RenderPipeline::getUniformUploadSkips() const noexcept
+{
+	return _graphicsContext->getUniformUploadSkips();
 }
 
 void
@@ -901,6 +1116,21 @@ RenderPipeline::destroyBaseMeshes() noexcept
 	_coneIbo.reset();
 }
 
+void
+RenderPipeline::destroyInstanceData() noexcept
+{
+	_instanceData.reset();
+	_instanceTransforms.clear();
+	_instanceBatchs.clear();
+}
+
+void
+RenderPipeline::destroyModelData() noexcept
+{
+	_modelData.reset();
+	_modelDataDirty = true;
+}
+
 void
 RenderPipeline::destroyDataManager() noexcept
 {
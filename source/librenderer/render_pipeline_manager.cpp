@@ -39,8 +39,14 @@
 #include <ray/render_pipeline.h>
 #include <ray/render_scene.h>
 #include <ray/camera.h>
+#include <ray/light.h>
+#include <ray/light_probe.h>
+#include <ray/render_object_manager_base.h>
 #include <ray/deferred_lighting_framebuffers.h>
 #include <ray/except.h>
+#include <ray/thread.h>
+
+#include <chrono>
 
 #include "deferred_lighting_pipeline.h"
 #include "forward_render_pipeline.h"
@@ -61,6 +67,12 @@ _NAME_BEGIN
 
 __ImplementSubClass(RenderPipelineManager, rtti::Interface, "RenderPipelineManager")
 
+static double
+elapsedMilliseconds(const std::chrono::high_resolution_clock::time_point& begin) noexcept
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+}
+
 RenderPipelineManager::RenderPipelineManager() noexcept
 {
 	std::memset(&_setting, 0, sizeof(_setting));
@@ -80,7 +92,7 @@ RenderPipelineManager::~RenderPipelineManager() noexcept
 void
 RenderPipelineManager::setup(const RenderSetting& setting) except
 {
-	assert(setting.window);
+	assert(setting.window || setting.deviceType == GraphicsDeviceType::GraphicsDeviceTypeNull);
 	assert(setting.width > 0 && setting.height > 0);
 	assert(setting.dpi_w > 0 && setting.dpi_h > 0);
 
@@ -164,6 +176,8 @@ bool
 RenderPipelineManager::setRenderSetting(const RenderSetting& setting) noexcept
 {
 	_setting.enableGlobalIllumination = setting.enableGlobalIllumination;
+	_setting.enableClusteredLighting = setting.enableClusteredLighting;
+	_setting.enableInstancing = setting.enableInstancing;
 
 	if (_setting.enableAtmospheric != setting.enableAtmospheric)
 	{
@@ -311,7 +325,7 @@ RenderPipelineManager::setRenderSetting(const RenderSetting& setting) noexcept
 	if (setting.pipelineType == RenderPipelineType::RenderPipelineTypeDeferredLighting)
 	{
 		auto deferredLighting = std::make_shared<DeferredLightingPipeline>();
-		if (!deferredLighting->setup(_pipeline, _setting.enableGlobalIllumination))
+		if (!deferredLighting->setup(_pipeline, _setting.enableGlobalIllumination, _setting.enableClusteredLighting))
 			return false;
 
 		_deferredLighting = deferredLighting;
@@ -329,6 +343,12 @@ RenderPipelineManager::getRenderSetting() const noexcept
 	return _setting;
 }
 
+const RenderStatistics&
+RenderPipelineManager::getRenderStatistics() const noexcept
+{
+	return _statistics;
+}
+
 void
 RenderPipelineManager::setWindowResolution(std::uint32_t width, std::uint32_t height) noexcept
 {
@@ -430,6 +450,11 @@ RenderPipelineManager::renderBegin() noexcept
 {
 	assert(_pipeline);
 	_pipeline->renderBegin();
+
+	if (_shadowMapGen)
+		_shadowMapGen->downcast<ShadowRenderPipeline>()->renderBegin();
+
+	_statistics = RenderStatistics();
 }
 
 void
@@ -437,6 +462,10 @@ RenderPipelineManager::render(const RenderScene& scene) noexcept
 {
 	assert(_pipeline);
 
+	auto visiableBegin = std::chrono::high_resolution_clock::now();
+	this->assginVisiable(scene);
+	_statistics.visiableTime += elapsedMilliseconds(visiableBegin);
+
 	auto& cameras = scene.getCameraList();
 	for (auto& camera : cameras)
 	{
@@ -446,15 +475,19 @@ RenderPipelineManager::render(const RenderScene& scene) noexcept
 		if (!camera->getRenderDataManager())
 			continue;
 
+		_statistics.numCameras++;
+
 		switch (camera->getCameraOrder())
 		{
 		case CameraOrder::CameraOrder2D:
 		{
 			camera->onRenderBefore(*camera);
 
+			auto forwardBegin = std::chrono::high_resolution_clock::now();
 			_forward->onRenderBefore();
 			_forward->onRenderPipeline(camera);
 			_forward->onRenderAfter();
+			_statistics.forwardTime += elapsedMilliseconds(forwardBegin);
 
 			camera->onRenderAfter(*camera);
 		}
@@ -465,32 +498,42 @@ RenderPipelineManager::render(const RenderScene& scene) noexcept
 
 			if (_shadowMapGen)
 			{
+				auto shadowBegin = std::chrono::high_resolution_clock::now();
+				auto shadowDrawCalls = _pipeline->getDrawCallCount();
 				_shadowMapGen->onRenderBefore();
 				_shadowMapGen->onRenderPipeline(camera);
 				_shadowMapGen->onRenderAfter();
+				_statistics.shadowTime += elapsedMilliseconds(shadowBegin);
+				_statistics.shadowDrawCalls += _pipeline->getDrawCallCount() - shadowDrawCalls;
 			}
 
 			if (_lightProbeGen)
 			{
+				auto lightProbeBegin = std::chrono::high_resolution_clock::now();
 				_lightProbeGen->onRenderBefore();
 				_lightProbeGen->onRenderPipeline(camera);
 				_lightProbeGen->onRenderAfter();
+				_statistics.lightProbeTime += elapsedMilliseconds(lightProbeBegin);
 			}
 
 			if (camera->getRenderPipelineFramebuffer()->isInstanceOf<DeferredLightingFramebuffers>())
 			{
 				if (_setting.pipelineType == RenderPipelineType::RenderPipelineTypeDeferredLighting)
 				{
+					auto deferredBegin = std::chrono::high_resolution_clock::now();
 					_deferredLighting->onRenderBefore();
 					_deferredLighting->onRenderPipeline(camera);
 					_deferredLighting->onRenderAfter();
+					_statistics.deferredTime += elapsedMilliseconds(deferredBegin);
 				}
 			}
 			else
 			{
+				auto forwardBegin = std::chrono::high_resolution_clock::now();
 				_forward->onRenderBefore();
 				_forward->onRenderPipeline(camera);
 				_forward->onRenderAfter();
+				_statistics.forwardTime += elapsedMilliseconds(forwardBegin);
 			}
 
 			camera->onRenderAfter(*camera);
@@ -500,11 +543,115 @@ RenderPipelineManager::render(const RenderScene& scene) noexcept
 	}
 }
 
+void
+RenderPipelineManager::assginVisiable(const RenderScene& scene) noexcept
+{
+	_visiableCameras.clear();
+
+	for (auto& camera : scene.getCameraList())
+	{
+		if (camera->getCameraOrder() != CameraOrder::CameraOrder3D)
+			continue;
+
+		if (!camera->getRenderPipelineFramebuffer() || !camera->getRenderDataManager())
+			continue;
+
+		_visiableCameras.push_back(camera);
+	}
+
+	this->assginVisiable(_visiableCameras);
+
+	CameraRaws mainCameras;
+	mainCameras.swap(_visiableCameras);
+
+	for (auto& camera : mainCameras)
+	{
+		auto& dataManager = camera->getRenderDataManager();
+		dataManager->collectStatistics(_statistics);
+
+		if (_shadowMapGen)
+		{
+			auto shadowMapGen = _shadowMapGen->downcast<ShadowRenderPipeline>();
+			shadowMapGen->prepareShadowMaps(*camera);
+
+			for (auto& it : dataManager->getRenderData(RenderQueue::RenderQueueLights))
+			{
+				auto light = it->downcast<Light>();
+				if (light->getShadowMode() == ShadowMode::ShadowModeNone)
+					continue;
+
+				if (light->getLightType() == LightType::LightTypeAmbient ||
+					light->getLightType() == LightType::LightTypeEnvironment)
+					continue;
+
+				if (!shadowMapGen->needUpdateShadowMap(*light))
+					continue;
+
+				auto& shadowCamera = light->getCamera();
+				if (shadowCamera && shadowCamera->getRenderScene())
+					_visiableCameras.push_back(shadowCamera.get());
+			}
+		}
+
+		if (_lightProbeGen)
+		{
+			for (auto& it : dataManager->getRenderData(RenderQueue::RenderQueueLightProbes))
+			{
+				auto lightProbe = it->downcast<LightProbe>();
+				if (!lightProbe->needUpdateProbeMap())
+					continue;
+
+				auto& probeCamera = lightProbe->getCamera();
+				if (probeCamera && probeCamera->getRenderScene() && probeCamera->getRenderPipelineFramebuffer())
+					_visiableCameras.push_back(probeCamera.get());
+			}
+		}
+	}
+
+	std::sort(_visiableCameras.begin(), _visiableCameras.end());
+	_visiableCameras.erase(std::unique(_visiableCameras.begin(), _visiableCameras.end()), _visiableCameras.end());
+
+	this->assginVisiable(_visiableCameras);
+
+	if (_shadowMapGen)
+		_shadowMapGen->downcast<ShadowRenderPipeline>()->assginShadowCascades();
+}
+
+void
+RenderPipelineManager::assginVisiable(const CameraRaws& cameras) noexcept
+{
+	if (cameras.empty())
+		return;
+
+	for (auto& camera : cameras)
+		camera->getViewProject();
+
+	if (cameras.size() == 1)
+	{
+		cameras.front()->assginVisiable();
+		return;
+	}
+
+	ThreadTaskGroup group;
+	ThreadPool::instance()->exce(group, cameras.size(), [&](std::size_t i) { cameras[i]->assginVisiable(); });
+	ThreadPool::instance()->wait(group);
+}
+
 void
 RenderPipelineManager::renderEnd() noexcept
 {
+	auto presentBegin = std::chrono::high_resolution_clock::now();
 	_pipeline->present();
 	_pipeline->renderEnd();
+	_statistics.presentTime += elapsedMilliseconds(presentBegin);
+
+	_statistics.drawCalls = _pipeline->getDrawCallCount();
+	_statistics.drawInstances = _pipeline->getDrawInstanceCount();
+	_statistics.uniformUploadBytes = _pipeline->getUniformUploadBytes();
+	_statistics.uniformUploadSkips = _pipeline->getUniformUploadSkips();
+
+	if (_shadowMapGen)
+		_shadowMapGen->downcast<ShadowRenderPipeline>()->collectStatistics(_statistics);
 }
 
 _NAME_END
\ No newline at end of file
@@ -39,12 +39,30 @@
 #include <ray/light.h>
 #include <ray/geometry.h>
 
+#if defined(__AVX__)
+#	include <immintrin.h>
+#elif defined(__SSE__)
+#	include <xmmintrin.h>
+#endif
+
 _NAME_BEGIN
 
 __ImplementSubClass(RenderScene, rtti::Interface, "RenderScene")
 
 RenderScenes RenderScene::_sceneList;
 
+// bounds of the last changes made to static objects, shadow caches older than this history are always rebuilt
+static const std::uint32_t StaticChangeHistory = 64;
+
+// candidates of the tree query, gathered into SoA bounds for the SIMD test, one set per culling thread
+struct RenderSceneCandidates
+{
+	std::vector<std::uint32_t> index;
+	std::vector<float> bounds[6];
+};
+
+static thread_local RenderSceneCandidates VisiableCandidates;
+
 OcclusionCullNode::OcclusionCullNode() noexcept
 	: _distanceSqrt(0)
 	, _item(nullptr)
@@ -136,7 +154,10 @@ OcclusionCullList::sort(iterator begin, iterator end) noexcept
 
 RenderScene::RenderScene() except
 	: _visible(true)
+	, _staticVersion(0)
 {
+	_staticChanges.resize(StaticChangeHistory);
+
 	this->addRenderScene(this);
 }
 
@@ -208,9 +229,34 @@ RenderScene::addRenderObject(RenderObject* object) except
 	assert(!object->getRenderScene());
 
 	if (object->isInstanceOf<Camera>())
+	{
 		this->addCamera(object->downcast<Camera>());
+	}
 	else
+	{
+		object->_renderSceneIndex = (std::int32_t)_renderObjectList.size();
+
 		_renderObjectList.push_back(object);
+
+		if (_renderObjectList.size() > _boundsCenter[0].size())
+		{
+			for (std::uint8_t i = 0; i < 3; i++)
+			{
+				_boundsCenter[i].resize(_boundsCenter[i].size() + 8, 0.0f);
+				_boundsExtent[i].resize(_boundsExtent[i].size() + 8, 0.0f);
+			}
+		}
+
+		this->updateBoundsCache(object->_renderSceneIndex, object->getBoundingBoxInWorld().aabb());
+
+		if (object->getStatic())
+			this->addStaticChange(object->getBoundingBoxInWorld().aabb());
+
+		if (object->isInstanceOf<Light>())
+			object->_renderSceneProxy = _lightTree.createProxy(computeProxyBound(*object), object);
+		else
+			object->_renderSceneProxy = _renderObjectTree.createProxy(computeProxyBound(*object), object);
+	}
 }
 
 void
@@ -227,10 +273,111 @@ RenderScene::removeRenderObject(RenderObject* object) noexcept
 	}
 	else
 	{
-		auto it = std::find(_renderObjectList.begin(), _renderObjectList.end(), object);
-		if (it != _renderObjectList.end())
-			_renderObjectList.erase(it);
+		if (object->getStatic())
+			this->addStaticChange(object->getBoundingBoxInWorld().aabb());
+
+		if (object->_renderSceneIndex >= 0)
+		{
+			std::size_t index = object->_renderSceneIndex;
+			std::size_t last = _renderObjectList.size() - 1;
+
+			if (index != last)
+			{
+				_renderObjectList[index] = _renderObjectList[last];
+				_renderObjectList[index]->_renderSceneIndex = (std::int32_t)index;
+
+				for (std::uint8_t i = 0; i < 3; i++)
+				{
+					_boundsCenter[i][index] = _boundsCenter[i][last];
+					_boundsExtent[i][index] = _boundsExtent[i][last];
+				}
+			}
+
+			_renderObjectList.pop_back();
+
+			object->_renderSceneIndex = -1;
+		}
+
+		if (object->_renderSceneProxy != AABBTree<RenderObject*>::nullnode)
+		{
+			if (object->isInstanceOf<Light>())
+				_lightTree.destroyProxy(object->_renderSceneProxy);
+			else
+				_renderObjectTree.destroyProxy(object->_renderSceneProxy);
+
+			object->_renderSceneProxy = AABBTree<RenderObject*>::nullnode;
+		}
+	}
+}
+
+void
+RenderScene::moveRenderObject(RenderObject* object) noexcept
+{
+	assert(object);
+
+	if (object->_renderSceneProxy == AABBTree<RenderObject*>::nullnode)
+		return;
+
+	auto& aabb = object->getBoundingBoxInWorld().aabb();
+
+	if (object->getStatic())
+	{
+		std::size_t index = object->_renderSceneIndex;
+
+		float3 center(_boundsCenter[0][index], _boundsCenter[1][index], _boundsCenter[2][index]);
+		float3 extent(_boundsExtent[0][index], _boundsExtent[1][index], _boundsExtent[2][index]);
+
+		AABB last(center - extent, center + extent);
+		if (last.min != aabb.min || last.max != aabb.max)
+		{
+			this->addStaticChange(last);
+			this->addStaticChange(aabb);
+		}
+	}
+
+	this->updateBoundsCache(object->_renderSceneIndex, aabb);
+
+	if (object->isInstanceOf<Light>())
+		_lightTree.moveProxy(object->_renderSceneProxy, computeProxyBound(*object));
+	else
+		_renderObjectTree.moveProxy(object->_renderSceneProxy, computeProxyBound(*object));
+}
+
+const RenderObjectRaws&
+RenderScene::getRenderObjectList() const noexcept
+{
+	return _renderObjectList;
+}
+
+void
+RenderScene::addStaticChange(const AABB& aabb) noexcept
+{
+	_staticChanges[_staticVersion % StaticChangeHistory] = aabb;
+	_staticVersion++;
+}
+
+std::uint32_t
+RenderScene::getStaticVersion() const noexcept
+{
+	return _staticVersion;
+}
+
+bool
+RenderScene::isStaticChanged(const AABB& aabb, std::uint32_t version) const noexcept
+{
+	if (version == _staticVersion)
+		return false;
+
+	if (_staticVersion - version > StaticChangeHistory)
+		return true;
+
+	for (std::uint32_t i = version; i != _staticVersion; i++)
+	{
+		if (aabb.intersects(_staticChanges[i % StaticChangeHistory]))
+			return true;
 	}
+
+	return false;
 }
 
 void
@@ -238,14 +385,21 @@ RenderScene::computVisiable(const Camera& camera, OcclusionCullList& list) excep
 {
 	Frustum fru(camera.getViewProject());
 
-	for (auto& it : _renderObjectList)
+	auto visiable = [&](RenderObject* it)
 	{
 		if (!it->getVisible())
-			continue;
+			return;
 
 		if (it->onVisiableTest(camera, fru))
 			list.insert(it, math::sqrDistance(camera.getTranslate(), it->getTransform().getTranslate()));
-	}
+	};
+
+	if (camera.getCameraType() == CameraType::CameraTypeCube)
+		_renderObjectTree.query(camera.getTranslate(), camera.getFar(), visiable);
+	else
+		_renderObjectTree.query(fru, visiable);
+
+	_lightTree.query(fru, visiable);
 }
 
 void
@@ -253,19 +407,186 @@ RenderScene::computVisiableLight(const Camera& camera, OcclusionCullList& list)
 {
 	Frustum fru(camera.getViewProject());
 
-	for (auto& it : _renderObjectList)
+	_lightTree.query(fru, [&](RenderObject* it)
 	{
-		if (!it->isInstanceOf<Light>())
-			continue;
-
 		if (!it->getVisible())
-			continue;
+			return;
 
 		if (it->onVisiableTest(camera, fru))
 			list.insert(it, math::sqrDistance(camera.getTranslate(), it->getTransform().getTranslate()));
+	});
+}
+
+void
+RenderScene::computVisiableMask(const Frustum& fru, RenderObjectMasks& masks) const noexcept
+{
+	masks.resize((_renderObjectList.size() + 31) / 32);
+	std::fill(masks.begin(), masks.end(), 0);
+
+	if (_renderObjectList.empty())
+		return;
+
+	// the trees only reject whole branches by their fattened bounds, the leaves they return are tested again
+	// against the exact bounds of the cache
+	auto& candidates = VisiableCandidates;
+	candidates.index.clear();
+
+	auto gather = [&](RenderObject* it) { candidates.index.push_back(it->_renderSceneIndex); };
+	_renderObjectTree.query(fru, gather);
+	_lightTree.query(fru, gather);
+
+	std::size_t count = candidates.index.size();
+	if (count == 0)
+		return;
+
+	std::size_t size = (count + 7) & ~std::size_t(7);
+	if (candidates.bounds[0].size() < size)
+	{
+		for (auto& it : candidates.bounds)
+			it.resize(size, 0.0f);
+	}
+
+	for (std::size_t j = 0; j < count; j++)
+	{
+		std::uint32_t index = candidates.index[j];
+
+		for (std::uint8_t k = 0; k < 3; k++)
+		{
+			candidates.bounds[k][j] = _boundsCenter[k][index];
+			candidates.bounds[k + 3][j] = _boundsExtent[k][index];
+		}
+	}
+
+	auto assign = [&](std::size_t first, std::uint32_t bits)
+	{
+		for (std::size_t j = first; bits && j < count; j++, bits >>= 1)
+		{
+			if (!(bits & 1))
+				continue;
+
+			std::uint32_t index = candidates.index[j];
+			masks[index >> 5] |= 1u << (index & 31);
+		}
+	};
+
+	const Plane3* planes[] =
+	{
+		&fru.getLeftPlane(), &fru.getRightPlane(),
+		&fru.getTopPlane(), &fru.getBottomPlane(),
+		&fru.getNearPlane(), &fru.getFarPlane()
+	};
+
+	const float* cx = candidates.bounds[0].data();
+	const float* cy = candidates.bounds[1].data();
+	const float* cz = candidates.bounds[2].data();
+	const float* ex = candidates.bounds[3].data();
+	const float* ey = candidates.bounds[4].data();
+	const float* ez = candidates.bounds[5].data();
+
+	std::size_t i = 0;
+
+#if defined(__AVX__)
+	__m256 zero = _mm256_setzero_ps();
+
+	for (; i < count; i += 8)
+	{
+		__m256 x = _mm256_loadu_ps(cx + i);
+		__m256 y = _mm256_loadu_ps(cy + i);
+		__m256 z = _mm256_loadu_ps(cz + i);
+		__m256 w = _mm256_loadu_ps(ex + i);
+		__m256 h = _mm256_loadu_ps(ey + i);
+		__m256 d = _mm256_loadu_ps(ez + i);
+
+		__m256 outside = zero;
+
+		for (auto& plane : planes)
+		{
+			__m256 dist = _mm256_set1_ps(plane->distance);
+			dist = _mm256_add_ps(dist, _mm256_mul_ps(_mm256_set1_ps(plane->normal.x), x));
+			dist = _mm256_add_ps(dist, _mm256_mul_ps(_mm256_set1_ps(plane->normal.y), y));
+			dist = _mm256_add_ps(dist, _mm256_mul_ps(_mm256_set1_ps(plane->normal.z), z));
+			dist = _mm256_add_ps(dist, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane->normal.x)), w));
+			dist = _mm256_add_ps(dist, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane->normal.y)), h));
+			dist = _mm256_add_ps(dist, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane->normal.z)), d));
+
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(dist, zero, _CMP_LT_OQ));
+		}
+
+		assign(i, ~(std::uint32_t)_mm256_movemask_ps(outside) & 0xFF);
+	}
+#elif defined(__SSE__)
+	__m128 zero = _mm_setzero_ps();
+
+	for (; i < count; i += 4)
+	{
+		__m128 x = _mm_loadu_ps(cx + i);
+		__m128 y = _mm_loadu_ps(cy + i);
+		__m128 z = _mm_loadu_ps(cz + i);
+		__m128 w = _mm_loadu_ps(ex + i);
+		__m128 h = _mm_loadu_ps(ey + i);
+		__m128 d = _mm_loadu_ps(ez + i);
+
+		__m128 outside = zero;
+
+		for (auto& plane : planes)
+		{
+			__m128 dist = _mm_set1_ps(plane->distance);
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(plane->normal.x), x));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(plane->normal.y), y));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(plane->normal.z), z));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(std::abs(plane->normal.x)), w));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(std::abs(plane->normal.y)), h));
+			dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(std::abs(plane->normal.z)), d));
+
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, zero));
+		}
+
+		assign(i, ~(std::uint32_t)_mm_movemask_ps(outside) & 0xF);
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		bool visiable = true;
+
+		for (auto& plane : planes)
+		{
+			float dist = plane->distance;
+			dist += plane->normal.x * cx[i] + plane->normal.y * cy[i] + plane->normal.z * cz[i];
+			dist += std::abs(plane->normal.x) * ex[i] + std::abs(plane->normal.y) * ey[i] + std::abs(plane->normal.z) * ez[i];
+
+			if (dist < 0.0f)
+			{
+				visiable = false;
+				break;
+			}
+		}
+
+		if (visiable)
+			assign(i, 1);
+	}
+}
+
+void
+RenderScene::updateBoundsCache(std::size_t index, const AABB& aabb) noexcept
+{
+	assert(index < _renderObjectList.size());
+
+	for (std::uint8_t i = 0; i < 3; i++)
+	{
+		_boundsCenter[i][index] = (aabb.min[i] + aabb.max[i]) * 0.5f;
+		_boundsExtent[i][index] = (aabb.max[i] - aabb.min[i]) * 0.5f;
 	}
 }
 
+AABB
+RenderScene::computeProxyBound(const RenderObject& object) noexcept
+{
+	AABB aabb = object.getBoundingBoxInWorld().aabb();
+	aabb.encapsulate(object.getTranslate());
+	return aabb;
+}
+
 const RenderScenes&
 RenderScene::getSceneAll() noexcept
 {
@@ -307,6 +628,10 @@ RenderScene::onRenderBefore() except
 void
 RenderScene::onRenderAfter() except
 {
+	// cameras culled this frame but never rendered must not keep their visiable set for the next frame
+	for (auto& camera : _cameraList)
+		camera->resetVisiable();
+
 	if (!_cameraWillAddList.empty())
 	{
 		_cameraList.insert(_cameraList.begin(), _cameraWillAddList.begin(), _cameraWillAddList.end());
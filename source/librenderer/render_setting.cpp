@@ -81,6 +81,8 @@ RenderSetting::RenderSetting() noexcept
 	, enableColorGrading(false)
 	, enableFXAA(true)
 	, enableGlobalIllumination(false)
+	, enableClusteredLighting(true)
+	, enableInstancing(true)
 	, earthRadius(6360000.f, 6440000.f)
 	, earthScaleHeight(7994.f, 2000.f)
 	, minElevation(0.0f)
@@ -95,4 +97,29 @@ RenderSetting::RenderSetting() noexcept
 	computeScatteringCoefficients();
 }
 
+RenderStatistics::RenderStatistics() noexcept
+	: visiableTime(0.0)
+	, shadowTime(0.0)
+	, lightProbeTime(0.0)
+	, deferredTime(0.0)
+	, forwardTime(0.0)
+	, presentTime(0.0)
+	, occlusionTime(0.0)
+	, shadowCascadeCullTime()
+	, shadowCascadeDrawTime()
+	, numCameras(0)
+	, drawCalls(0)
+	, drawInstances(0)
+	, uniformUploadBytes(0)
+	, uniformUploadSkips(0)
+	, numOccluders(0)
+	, numOccluderTriangles(0)
+	, numOccludees(0)
+	, numOccluded(0)
+	, shadowDrawCalls(0)
+	, numShadowUpdates(0)
+	, numShadowCached(0)
+{
+}
+
 _NAME_END
\ No newline at end of file
@@ -100,6 +100,13 @@ RenderSystem::getRenderSetting() const noexcept
 	return _pipelineManager->getRenderSetting();
 }
 
+const RenderStatistics&
+RenderSystem::getRenderStatistics() const noexcept
+{
+	assert(_pipelineManager);
+	return _pipelineManager->getRenderStatistics();
+}
+
 bool
 RenderSystem::setWindowResolution(std::uint32_t w, std::uint32_t h) noexcept
 {
@@ -304,6 +311,17 @@ RenderSystem::isShaderSupport(GraphicsShaderStageFlagBits stage) noexcept
 	return _pipelineManager->getRenderPipeline()->isShaderSupport(stage);
 }
 
+bool
+RenderSystem::isInstancingSupport() noexcept
+{
+	assert(_pipelineManager);
+	if (!_pipelineManager->getRenderSetting().enableInstancing)
+		return false;
+
+	// ES2 has no vertex attribute divisor, so per-instance streams can not be bound
+	return _pipelineManager->getRenderPipeline()->getDeviceType() != GraphicsDeviceType::GraphicsDeviceTypeOpenGLES2;
+}
+
 GraphicsTexturePtr
 RenderSystem::createTexture(const GraphicsTextureDesc& desc) noexcept
 {
@@ -0,0 +1,351 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <ray/shadow_atlas.h>
+
+_NAME_BEGIN
+
+ShadowAtlasTile::ShadowAtlasTile() noexcept
+	: owner(0)
+	, lastUsed(0)
+	, lastUpdate(0)
+	, staticVersion(0)
+	, valid(false)
+	, staticValid(false)
+	, dynamicCasters(false)
+	, viewProject(float4x4::One)
+{
+}
+
+ShadowAtlas::ShadowAtlas() noexcept
+	: _atlasSize(0)
+	, _tileSize(0)
+	, _minTileSize(0)
+{
+}
+
+ShadowAtlas::~ShadowAtlas() noexcept
+{
+}
+
+void
+ShadowAtlas::setup(std::uint32_t atlasSize, std::uint32_t tileSize, std::uint32_t minTileSize) noexcept
+{
+	assert(minTileSize > 0 && tileSize >= minTileSize && atlasSize >= tileSize);
+
+	_atlasSize = atlasSize;
+	_tileSize = tileSize;
+	_minTileSize = minTileSize;
+
+	_nodes.clear();
+	_tiles.clear();
+
+	std::uint32_t tilesPerRow = atlasSize / tileSize;
+
+	for (std::uint32_t y = 0; y < tilesPerRow; y++)
+	{
+		for (std::uint32_t x = 0; x < tilesPerRow; x++)
+		{
+			ShadowAtlasNode node;
+			node.x = x * tileSize;
+			node.y = y * tileSize;
+			node.size = tileSize;
+			node.parent = -1;
+			node.child = -1;
+			node.split = false;
+
+			_nodes.push_back(node);
+		}
+	}
+
+	// the four children of a tile are stored next to each other, so a tile only needs the index of the first one
+	for (std::size_t i = 0; i < _nodes.size(); i++)
+	{
+		std::uint32_t size = _nodes[i].size >> 1;
+		if (size < minTileSize)
+			continue;
+
+		_nodes[i].child = (std::int32_t)_nodes.size();
+
+		for (std::uint32_t j = 0; j < 4; j++)
+		{
+			ShadowAtlasNode node;
+			node.x = _nodes[i].x + (j & 1) * size;
+			node.y = _nodes[i].y + (j >> 1) * size;
+			node.size = size;
+			node.parent = (std::int32_t)i;
+			node.child = -1;
+			node.split = false;
+
+			_nodes.push_back(node);
+		}
+	}
+
+	_tiles.resize(_nodes.size());
+}
+
+void
+ShadowAtlas::close() noexcept
+{
+	_atlasSize = 0;
+	_tileSize = 0;
+	_minTileSize = 0;
+
+	_nodes.clear();
+	_tiles.clear();
+}
+
+std::uint32_t
+ShadowAtlas::getAtlasSize() const noexcept
+{
+	return _atlasSize;
+}
+
+std::uint32_t
+ShadowAtlas::getTileSize() const noexcept
+{
+	return _tileSize;
+}
+
+std::uint32_t
+ShadowAtlas::getMinTileSize() const noexcept
+{
+	return _minTileSize;
+}
+
+std::uint32_t
+ShadowAtlas::getNumTiles() const noexcept
+{
+	return (std::uint32_t)_tiles.size();
+}
+
+std::int32_t
+ShadowAtlas::acquire(std::uint64_t owner, std::int32_t hint, std::uint32_t frame, std::uint32_t size, bool& allocated) noexcept
+{
+	assert(owner != 0);
+
+	allocated = false;
+
+	size = std::max(std::min(size, _tileSize), _minTileSize);
+
+	// tiles nobody used in the last frame are taken first, tiles of lights that are probably still visible only when nothing else fits
+	const std::uint32_t before[] = { frame > 0 ? frame - 1 : 0, frame };
+
+	if (hint >= 0 && (std::size_t)hint < _tiles.size() && _tiles[hint].owner == owner)
+	{
+		_tiles[hint].lastUsed = frame;
+
+		// a tile up to one level larger than asked for is kept, so a light moving around a threshold doesn't reallocate every frame
+		if (_nodes[hint].size >= size && _nodes[hint].size <= size * 2)
+			return hint;
+
+		// a smaller tile is kept until a tile of the asked size gets free
+		if (_nodes[hint].size < size)
+		{
+			auto index = this->allocate(size, before[0]);
+			if (index < 0)
+				return hint;
+
+			_tiles[index].owner = owner;
+			_tiles[index].lastUsed = frame;
+
+			this->release(hint);
+
+			allocated = true;
+			return index;
+		}
+
+		this->release(hint);
+	}
+
+	// without room for the asked size the light falls back to smaller tiles instead of losing its shadow
+	for (auto lastUsed : before)
+	{
+		for (std::uint32_t tileSize = size; tileSize >= _minTileSize; tileSize >>= 1)
+		{
+			auto index = this->allocate(tileSize, lastUsed);
+			if (index < 0)
+				continue;
+
+			_tiles[index].owner = owner;
+			_tiles[index].lastUsed = frame;
+
+			allocated = true;
+			return index;
+		}
+	}
+
+	return -1;
+}
+
+void
+ShadowAtlas::release(std::int32_t index) noexcept
+{
+	assert(index >= 0 && (std::size_t)index < _tiles.size());
+	_tiles[index] = ShadowAtlasTile();
+
+	this->merge(_nodes[index].parent);
+}
+
+ShadowAtlasTile&
+ShadowAtlas::getTile(std::int32_t index) noexcept
+{
+	assert(index >= 0 && (std::size_t)index < _tiles.size());
+	return _tiles[index];
+}
+
+const ShadowAtlasTile&
+ShadowAtlas::getTile(std::int32_t index) const noexcept
+{
+	assert(index >= 0 && (std::size_t)index < _tiles.size());
+	return _tiles[index];
+}
+
+std::uint32_t
+ShadowAtlas::getTileSize(std::int32_t index) const noexcept
+{
+	assert(index >= 0 && (std::size_t)index < _nodes.size());
+	return _nodes[index].size;
+}
+
+uint4
+ShadowAtlas::getTileViewport(std::int32_t index) const noexcept
+{
+	assert(index >= 0 && (std::size_t)index < _nodes.size());
+
+	auto& node = _nodes[index];
+	return uint4(node.x, node.y, node.size, node.size);
+}
+
+float4
+ShadowAtlas::getTileCoord(std::int32_t index) const noexcept
+{
+	auto viewport = this->getTileViewport(index);
+
+	float scale = (float)viewport.z / _atlasSize;
+	return float4(scale, scale, (float)viewport.x / _atlasSize, (float)viewport.y / _atlasSize);
+}
+
+std::int32_t
+ShadowAtlas::allocate(std::uint32_t size, std::uint32_t before) noexcept
+{
+	// the smallest free tile that fits is split down to the asked size
+	std::int32_t index = -1;
+
+	for (std::size_t i = 0; i < _nodes.size(); i++)
+	{
+		if (_nodes[i].size < size || !this->isFree((std::int32_t)i))
+			continue;
+
+		if (index < 0 || _nodes[i].size < _nodes[index].size)
+		{
+			index = (std::int32_t)i;
+			if (_nodes[i].size == size)
+				break;
+		}
+	}
+
+	// otherwise the least recently used tile that fits, as long as it wasn't used since the given frame
+	if (index < 0)
+	{
+		for (std::size_t i = 0; i < _nodes.size(); i++)
+		{
+			if (_nodes[i].size < size || _nodes[i].split || !this->isActive((std::int32_t)i))
+				continue;
+
+			auto& tile = _tiles[i];
+			if (tile.owner == 0 || tile.lastUsed >= before)
+				continue;
+
+			if (index < 0 || tile.lastUsed < _tiles[index].lastUsed ||
+				(tile.lastUsed == _tiles[index].lastUsed && _nodes[i].size < _nodes[index].size))
+				index = (std::int32_t)i;
+		}
+
+		if (index < 0)
+			return -1;
+
+		_tiles[index] = ShadowAtlasTile();
+	}
+
+	return this->split(index, size);
+}
+
+std::int32_t
+ShadowAtlas::split(std::int32_t index, std::uint32_t size) noexcept
+{
+	while (_nodes[index].child >= 0 && (_nodes[index].size >> 1) >= size)
+	{
+		_nodes[index].split = true;
+		index = _nodes[index].child;
+	}
+
+	return index;
+}
+
+void
+ShadowAtlas::merge(std::int32_t index) noexcept
+{
+	// a split tile becomes one tile again once all of its four children are free
+	while (index >= 0)
+	{
+		auto child = _nodes[index].child;
+
+		for (std::int32_t i = child; i < child + 4; i++)
+		{
+			if (_nodes[i].split || _tiles[i].owner != 0)
+				return;
+		}
+
+		_nodes[index].split = false;
+		index = _nodes[index].parent;
+	}
+}
+
+bool
+ShadowAtlas::isActive(std::int32_t index) const noexcept
+{
+	auto parent = _nodes[index].parent;
+	return parent < 0 || _nodes[parent].split;
+}
+
+bool
+ShadowAtlas::isFree(std::int32_t index) const noexcept
+{
+	return this->isActive(index) && !_nodes[index].split && _tiles[index].owner == 0;
+}
+
+_NAME_END
\ No newline at end of file
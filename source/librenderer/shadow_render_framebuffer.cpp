@@ -36,14 +36,23 @@
 // +----------------------------------------------------------------------
 #include <ray/shadow_render_framebuffer.h>
 #include <ray/render_system.h>
-#include <ray/graphics_texture.h>
-#include <ray/graphics_framebuffer.h>
+
+#include <atomic>
 
 _NAME_BEGIN
 
 __ImplementSubInterface(ShadowRenderFramebuffer, RenderPipelineFramebuffer, "ShadowRenderFramebuffer")
 
+// every shadow map owns its atlas tile through an id that is never reused, so a tile left behind by a
+// destroyed light can not be mistaken for the tile of a light that was later created at the same address.
+static std::atomic<std::uint64_t> ShadowAtlasOwners(0);
+
 ShadowRenderFramebuffer::ShadowRenderFramebuffer() noexcept
+	: _atlasOwner(++ShadowAtlasOwners)
+	, _atlasTile(-1)
+	, _atlasViewport(0, 0, 0, 0)
+	, _atlasCoord(1.0f, 1.0f, 0.0f, 0.0f)
+	, _shadowUpdate(false)
 {
 }
 
@@ -54,55 +63,57 @@ ShadowRenderFramebuffer::~ShadowRenderFramebuffer() noexcept
 bool
 ShadowRenderFramebuffer::setup()
 {
-	std::uint32_t shadowMapSize = 0;
-
 	ShadowQuality shadowQuality = RenderSystem::instance()->getRenderSetting().shadowQuality;
-	if (shadowQuality == ShadowQuality::ShadowQualityLow)
-		shadowMapSize = LightShadowSize::LightShadowSizeLow;
-	else if (shadowQuality == ShadowQuality::ShadowQualityMedium)
-		shadowMapSize = LightShadowSize::LightShadowSizeMedium;
-	else if (shadowQuality == ShadowQuality::ShadowQualityHigh)
-		shadowMapSize = LightShadowSize::LightShadowSizeHigh;
-	else if (shadowQuality == ShadowQuality::ShadowQualityVeryHigh)
-		shadowMapSize = LightShadowSize::LightShadowSizeVeryHigh;
-	else
+	if (shadowQuality == ShadowQuality::ShadowQualityNone)
 		return false;
 
-	GraphicsFormat depthLinearFormat;
-	if (RenderSystem::instance()->isTextureSupport(GraphicsFormat::GraphicsFormatR32SFloat))
-		depthLinearFormat = GraphicsFormat::GraphicsFormatR32SFloat;
-	else if (RenderSystem::instance()->isTextureSupport(GraphicsFormat::GraphicsFormatR8G8B8A8UNorm))
-		depthLinearFormat = GraphicsFormat::GraphicsFormatR8G8B8A8UNorm;
-	else
-		return false;
+	this->setAtlasTile(-1, uint4(0, 0, 0, 0), float4(1.0f, 1.0f, 0.0f, 0.0f));
+	this->setFramebuffer(nullptr);
+	return true;
+}
 
-	GraphicsTextureDesc depthLinearDesc;
-	depthLinearDesc.setWidth(shadowMapSize);
-	depthLinearDesc.setHeight(shadowMapSize);
-	depthLinearDesc.setTexDim(GraphicsTextureDim::GraphicsTextureDim2D);
-	depthLinearDesc.setTexFormat(depthLinearFormat);
-	depthLinearDesc.setSamplerWrap(GraphicsSamplerWrap::GraphicsSamplerWrapClampToEdge);
-	_shadowDepthLinearMap = RenderSystem::instance()->createTexture(depthLinearDesc);
-	if (!_shadowDepthLinearMap)
-		return false;
+std::uint64_t
+ShadowRenderFramebuffer::getAtlasOwner() const noexcept
+{
+	return _atlasOwner;
+}
 
-	GraphicsFramebufferLayoutDesc shaodwMapLayoutDesc;
-	shaodwMapLayoutDesc.addComponent(GraphicsAttachmentLayout(0, GraphicsImageLayout::GraphicsImageLayoutColorAttachmentOptimal, depthLinearFormat));
-	_shadowDepthLinearViewLayout = RenderSystem::instance()->createFramebufferLayout(shaodwMapLayoutDesc);
-	if (!_shadowDepthLinearViewLayout)
-		return false;
+void
+ShadowRenderFramebuffer::setAtlasTile(std::int32_t tile, const uint4& viewport, const float4& coord) noexcept
+{
+	_atlasTile = tile;
+	_atlasViewport = viewport;
+	_atlasCoord = coord;
+}
 
-	GraphicsFramebufferDesc shadowViewDesc;
-	shadowViewDesc.setWidth(shadowMapSize);
-	shadowViewDesc.setHeight(shadowMapSize);
-	shadowViewDesc.addColorAttachment(GraphicsAttachmentBinding(_shadowDepthLinearMap, 0, 0));
-	shadowViewDesc.setGraphicsFramebufferLayout(_shadowDepthLinearViewLayout);
-	_shadowDepthLinearView = RenderSystem::instance()->createFramebuffer(shadowViewDesc);
-	if (!_shadowDepthLinearView)
-		return false;
+std::int32_t
+ShadowRenderFramebuffer::getAtlasTile() const noexcept
+{
+	return _atlasTile;
+}
 
-	this->setFramebuffer(_shadowDepthLinearView);
-	return true;
+const uint4&
+ShadowRenderFramebuffer::getAtlasViewport() const noexcept
+{
+	return _atlasViewport;
+}
+
+const float4&
+ShadowRenderFramebuffer::getAtlasCoord() const noexcept
+{
+	return _atlasCoord;
+}
+
+void
+ShadowRenderFramebuffer::setShadowUpdate(bool update) noexcept
+{
+	_shadowUpdate = update;
+}
+
+bool
+ShadowRenderFramebuffer::getShadowUpdate() const noexcept
+{
+	return _shadowUpdate;
 }
 
 void
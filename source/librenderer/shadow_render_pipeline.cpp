@@ -39,6 +39,7 @@
 #include <ray/render_pipeline.h>
 #include <ray/render_pipeline_framebuffer.h>
 #include <ray/render_object_manager.h>
+#include <ray/render_scene.h>
 
 #include <ray/camera.h>
 #include <ray/light.h>
@@ -47,15 +48,35 @@
 #include <ray/graphics_texture.h>
 #include <ray/graphics_framebuffer.h>
 
+#include <ray/thread.h>
+
+#include <chrono>
+
 _NAME_BEGIN
 
 __ImplementSubClass(ShadowRenderPipeline, RenderPipelineController, "ShadowRenderPipeline")
 
+// every shadow map is a tile of one shared atlas, the atlas holds up to 8x8 tiles but never grows beyond 4096,
+// a tile splits into smaller tiles down to ShadowAtlasLevels - 1 levels below the size of the shadow quality
+static const std::uint32_t ShadowAtlasTilesPerRow = 8;
+static const std::uint32_t ShadowAtlasMaxSize = 4096;
+static const std::uint8_t ShadowAtlasLevels = 4;
+
+// lights covering less of the screen height than ShadowUpdateScreenSize[i] take a tile of level i and refresh it every ShadowUpdateInterval[i] frames
+static const float ShadowUpdateScreenSize[ShadowAtlasLevels] = { 0.5f, 0.25f, 0.1f, 0.0f };
+static const std::uint32_t ShadowUpdateInterval[ShadowAtlasLevels] = { 1, 2, 4, 8 };
+
 ShadowRenderPipeline::ShadowRenderPipeline() noexcept
 	: _shadowMode(ShadowMode::ShadowModeSoft)
 	, _shadowQuality(ShadowQuality::ShadowQualityMedium)
 	, _shadowDepthFormat(GraphicsFormat::GraphicsFormatD16UNorm)
 	, _shadowDepthLinearFormat(GraphicsFormat::GraphicsFormatR32SFloat)
+	, _shadowCascadeLevel(0)
+	, _frame(0)
+	, _numShadowUpdates(0)
+	, _numShadowCached(0)
+	, _shadowCascadeCullTime()
+	, _shadowCascadeDrawTime()
 {
 }
 
@@ -75,6 +96,9 @@ ShadowRenderPipeline::setup(RenderPipelinePtr pipeline) noexcept
 		if (!setupShadowMaps(*pipeline))
 			return false;
 
+		if (!setupShadowAtlas(*pipeline))
+			return false;
+
 		if (_shadowMode == ShadowMode::ShadowModeSoft)
 		{
 			if (!setupShadowSoftMaps(*pipeline))
@@ -89,6 +113,7 @@ ShadowRenderPipeline::setup(RenderPipelinePtr pipeline) noexcept
 void
 ShadowRenderPipeline::close() noexcept
 {
+	this->destroyShadowAtlas();
 	this->destroyShadowMaps();
 	this->destroyShadowMaterial();
 	_pipeline.reset();
@@ -118,6 +143,165 @@ ShadowRenderPipeline::getShadowQuality() const noexcept
 	return _shadowQuality;
 }
 
+void
+ShadowRenderPipeline::renderBegin() noexcept
+{
+	_frame++;
+}
+
+void
+ShadowRenderPipeline::prepareShadowMaps(const Camera& mainCamera) noexcept
+{
+	if (_shadowQuality == ShadowQuality::ShadowQualityNone)
+		return;
+
+	const auto& lights = mainCamera.getRenderDataManager()->getRenderData(RenderQueue::RenderQueueLights);
+	for (auto& it : lights)
+	{
+		auto light = it->downcast<Light>();
+		if (light->getShadowMode() == ShadowMode::ShadowModeNone)
+			continue;
+
+		if (light->getLightType() == LightType::LightTypeAmbient ||
+			light->getLightType() == LightType::LightTypeEnvironment)
+			continue;
+
+		if (light->getShadowCascadeEnable())
+		{
+			std::uint32_t shadowMapSize[LightShadowCascade::LightShadowCascadeMax];
+			for (std::uint8_t i = 0; i < LightShadowCascade::LightShadowCascadeMax; i++)
+				shadowMapSize[i] = _shadowAtlas.getTileSize() >> (i > 0 ? _shadowCascadeLevel : 0);
+
+			light->updateShadowCascades(mainCamera, shadowMapSize);
+
+			auto& cascades = light->getShadowCascadeCameras(mainCamera);
+			for (std::uint8_t i = 0; i < cascades.size(); i++)
+			{
+				if (this->prepareShadowAtlas(*light, *cascades[i], shadowMapSize[i], 1))
+					_shadowCascadeJobs.push_back(ShadowCascadeJob{ cascades[i].get(), i, 0.0 });
+			}
+		}
+		else
+		{
+			auto& camera = light->getCamera();
+			if (camera)
+			{
+				auto level = this->computeShadowLevel(mainCamera, *light);
+				this->prepareShadowAtlas(*light, *camera, _shadowAtlas.getTileSize() >> level, ShadowUpdateInterval[level]);
+			}
+		}
+	}
+}
+
+void
+ShadowRenderPipeline::assginShadowCascades() noexcept
+{
+	if (_shadowCascadeJobs.empty())
+		return;
+
+	for (auto& job : _shadowCascadeJobs)
+		job.camera->getViewProject();
+
+	// every cascade builds its own render queues, so the culling of the cascades runs as independent jobs
+	ThreadTaskGroup group;
+	ThreadPool::instance()->exce(group, _shadowCascadeJobs.size(), [&](std::size_t i)
+	{
+		auto begin = std::chrono::high_resolution_clock::now();
+		_shadowCascadeJobs[i].camera->assginVisiable();
+		_shadowCascadeJobs[i].time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+	});
+	ThreadPool::instance()->wait(group);
+
+	for (auto& job : _shadowCascadeJobs)
+		_shadowCascadeCullTime[job.cascade] += job.time;
+
+	_shadowCascadeJobs.clear();
+}
+
+bool
+ShadowRenderPipeline::needUpdateShadowMap(const Light& light) const noexcept
+{
+	if (light.getShadowCascadeEnable())
+		return false;
+
+	auto& camera = light.getCamera();
+	if (!camera)
+		return false;
+
+	auto& framebuffer = camera->getRenderPipelineFramebuffer();
+	if (framebuffer && framebuffer->isInstanceOf<ShadowRenderFramebuffer>())
+		return framebuffer->downcast<ShadowRenderFramebuffer>()->getShadowUpdate();
+
+	return true;
+}
+
+void
+ShadowRenderPipeline::collectStatistics(RenderStatistics& statistics) noexcept
+{
+	statistics.numShadowUpdates += _numShadowUpdates;
+	statistics.numShadowCached += _numShadowCached;
+
+	for (std::size_t i = 0; i < LightShadowCascade::LightShadowCascadeMax; i++)
+	{
+		statistics.shadowCascadeCullTime[i] += _shadowCascadeCullTime[i];
+		statistics.shadowCascadeDrawTime[i] += _shadowCascadeDrawTime[i];
+
+		_shadowCascadeCullTime[i] = 0.0;
+		_shadowCascadeDrawTime[i] = 0.0;
+	}
+
+	_numShadowUpdates = 0;
+	_numShadowCached = 0;
+}
+
+bool
+ShadowRenderPipeline::prepareShadowAtlas(const Light& light, Camera& camera, std::uint32_t size, std::uint32_t interval) noexcept
+{
+	if (!camera.getRenderScene())
+		return false;
+
+	auto& renderFramebuffer = camera.getRenderPipelineFramebuffer();
+	if (!renderFramebuffer || !renderFramebuffer->isInstanceOf<ShadowRenderFramebuffer>())
+		return false;
+
+	auto framebuffer = renderFramebuffer->downcast<ShadowRenderFramebuffer>();
+
+	bool allocated = false;
+	auto index = _shadowAtlas.acquire(framebuffer->getAtlasOwner(), framebuffer->getAtlasTile(), _frame, size, allocated);
+	if (index < 0)
+	{
+		framebuffer->setAtlasTile(-1, uint4(0, 0, 0, 0), float4(1.0f, 1.0f, 0.0f, 0.0f));
+		framebuffer->setFramebuffer(nullptr);
+		framebuffer->setShadowUpdate(false);
+		return false;
+	}
+
+	framebuffer->setAtlasTile(index, _shadowAtlas.getTileViewport(index), _shadowAtlas.getTileCoord(index));
+	framebuffer->setFramebuffer(_shadowAtlasView);
+
+	auto& tile = _shadowAtlas.getTile(index);
+	auto& scene = camera.getRenderScene();
+
+	bool invalidated = allocated ||
+		tile.viewProject != camera.getViewProject() ||
+		scene->isStaticChanged(light.getBoundingBoxInWorld().aabb(), tile.staticVersion);
+
+	if (invalidated)
+	{
+		tile.valid = false;
+		tile.staticValid = false;
+	}
+
+	tile.viewProject = camera.getViewProject();
+	tile.staticVersion = scene->getStaticVersion();
+
+	// an invalidated tile is drawn right away, the interval only throttles how often dynamic casters are refreshed
+	if (invalidated || _frame - tile.lastUpdate >= interval)
+		framebuffer->setShadowUpdate(true);
+
+	return framebuffer->getShadowUpdate();
+}
+
 void
 ShadowRenderPipeline::renderShadowMaps(const Camera* mainCamera) noexcept
 {
@@ -136,10 +320,50 @@ ShadowRenderPipeline::renderShadowMaps(const Camera* mainCamera) noexcept
 			light->getLightType() == LightType::LightTypeEnvironment)
 			continue;
 
-		if (!light->getGlobalIllumination())
-			this->renderShadowMap(*light, RenderQueue::RenderQueueShadow);
-		else
+		if (light->getGlobalIllumination())
+		{
 			this->renderShadowMap(*light, RenderQueue::RenderQueueReflectiveShadow);
+			continue;
+		}
+
+		if (light->getShadowCascadeEnable())
+		{
+			auto& cascades = light->getShadowCascadeCameras(*mainCamera);
+			for (std::size_t i = 0; i < cascades.size(); i++)
+			{
+				auto begin = std::chrono::high_resolution_clock::now();
+				this->renderShadowAtlas(*light, *cascades[i]);
+				_shadowCascadeDrawTime[i] += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+			}
+		}
+		else
+		{
+			auto& camera = light->getCamera();
+			if (camera)
+				this->renderShadowAtlas(*light, *camera);
+		}
+	}
+}
+
+void
+ShadowRenderPipeline::renderShadowAtlas(const Light& light, Camera& camera) noexcept
+{
+	auto& renderFramebuffer = camera.getRenderPipelineFramebuffer();
+	if (!renderFramebuffer || !renderFramebuffer->isInstanceOf<ShadowRenderFramebuffer>())
+		return;
+
+	auto framebuffer = renderFramebuffer->downcast<ShadowRenderFramebuffer>();
+	if (framebuffer->getAtlasTile() < 0)
+		return;
+
+	if (framebuffer->getShadowUpdate())
+	{
+		this->renderShadowAtlas(light, camera, *framebuffer);
+		framebuffer->setShadowUpdate(false);
+	}
+	else
+	{
+		_numShadowCached++;
 	}
 }
 
@@ -200,12 +424,118 @@ ShadowRenderPipeline::renderShadowMap(const Light& light, RenderQueue queue) noe
 	}
 }
 
+void
+ShadowRenderPipeline::renderShadowAtlas(const Light& light, Camera& camera, ShadowRenderFramebuffer& framebuffer) noexcept
+{
+	auto& tile = _shadowAtlas.getTile(framebuffer.getAtlasTile());
+	auto& viewport = framebuffer.getAtlasViewport();
+
+	tile.lastUpdate = _frame;
+
+	auto& dynamicCasters = camera.getRenderDataManager()->getRenderData(RenderQueue::RenderQueueShadow);
+	if (tile.valid && !tile.dynamicCasters && dynamicCasters.empty())
+	{
+		_numShadowCached++;
+		return;
+	}
+
+	camera.onRenderBefore(camera);
+
+	_pipeline->setCamera(&camera);
+	_pipeline->setFramebuffer(_shadowShadowDepthViewTemp);
+
+	if (tile.staticValid)
+	{
+		_shadowShadowSource->uniformTexture(_shadowStaticDepthMap);
+		_shadowShadowSourceRect->uniform4f(framebuffer.getAtlasCoord());
+
+		_pipeline->drawScreenQuad(*_shadowCopyDepth);
+	}
+	else
+	{
+		_pipeline->clearFramebuffer(0, GraphicsClearFlagBits::GraphicsClearFlagDepthBit, float4::Zero, 1.0, 0);
+		_pipeline->drawRenderQueue(RenderQueue::RenderQueueStaticShadow, nullptr);
+
+		if (_shadowStaticDepthView)
+		{
+			_shadowShadowSource->uniformTexture(_shadowShadowDepthMapTemp);
+			_shadowShadowSourceRect->uniform4f(float4(1.0f, 1.0f, 0.0f, 0.0f));
+
+			_pipeline->setFramebuffer(_shadowStaticDepthView);
+			_pipeline->setViewport(0, Viewport(viewport.x, viewport.y, viewport.z, viewport.w));
+			_pipeline->drawScreenQuad(*_shadowCopyDepth);
+
+			_pipeline->setFramebuffer(_shadowShadowDepthViewTemp);
+
+			tile.staticValid = true;
+		}
+	}
+
+	_pipeline->drawRenderQueue(RenderQueue::RenderQueueShadow, nullptr);
+
+	_shadowShadowSource->uniformTexture(_shadowShadowDepthMapTemp);
+	_shadowClipConstant->uniform4f(float4(camera.getClipConstant().xy(), 1.0f, 1.0f));
+
+	if (_shadowMode == ShadowMode::ShadowModeSoft && light.getShadowMode() == ShadowMode::ShadowModeSoft)
+	{
+		_pipeline->setFramebuffer(_shadowShadowDepthLinearViewTemp);
+		_pipeline->discardFramebuffer(0);
+		_pipeline->drawScreenQuad(*_shadowBlurShadowX[(std::uint8_t)light.getLightType()]);
+
+		_shadowShadowSource->uniformTexture(_shadowShadowDepthLinearMapTemp);
+
+		_pipeline->setFramebuffer(_shadowAtlasView);
+		_pipeline->setViewport(0, Viewport(viewport.x, viewport.y, viewport.z, viewport.w));
+		_pipeline->drawScreenQuad(*_shadowBlurShadowY);
+	}
+	else
+	{
+		_pipeline->setFramebuffer(_shadowAtlasView);
+		_pipeline->setViewport(0, Viewport(viewport.x, viewport.y, viewport.z, viewport.w));
+		_pipeline->drawScreenQuad(*_shadowBlurShadowX[(std::uint8_t)light.getLightType()]);
+	}
+
+	tile.valid = true;
+	tile.dynamicCasters = !dynamicCasters.empty();
+
+	_numShadowUpdates++;
+
+	camera.onRenderAfter(camera);
+}
+
+std::uint8_t
+ShadowRenderPipeline::computeShadowLevel(const Camera& mainCamera, const Light& light) const noexcept
+{
+	if (light.getLightType() == LightType::LightTypeSun ||
+		light.getLightType() == LightType::LightTypeDirectional)
+		return 0;
+
+	if (mainCamera.getCameraType() != CameraType::CameraTypePerspective)
+		return 0;
+
+	auto& aabb = light.getBoundingBoxInWorld().aabb();
+
+	float radius = math::length(aabb.extents());
+	float distance = math::distance(mainCamera.getTranslate(), aabb.center());
+	if (distance <= radius)
+		return 0;
+
+	float screenSize = radius / (distance * std::tan(math::deg2rad(mainCamera.getAperture() * 0.5f)));
+
+	std::uint8_t level = 0;
+	while (screenSize < ShadowUpdateScreenSize[level])
+		level++;
+
+	return level;
+}
+
 bool
 ShadowRenderPipeline::setupShadowMaterial(RenderPipeline& pipeline) noexcept
 {
 	_shadowRender = pipeline.createMaterial("sys:fx/shadowmap.fxml"); if (!_shadowRender) return false;
 	_shadowConvOrthoLinearDepth = _shadowRender->getTech("ConvOrthoLinearDepth"); if (!_shadowConvOrthoLinearDepth) return false;
 	_shadowConvPerspectiveFovLinearDepth = _shadowRender->getTech("ConvPerspectiveFovLinearDepth"); if (!_shadowConvPerspectiveFovLinearDepth) return false;
+	_shadowCopyDepth = _shadowRender->getTech("CopyDepth"); if (!_shadowCopyDepth) return false;
 	_shadowBlurOrthoShadowX = _shadowRender->getTech("ConvOrthoLinearDepthBlurX"); if (!_shadowBlurOrthoShadowX) return false;
 	_shadowBlurPerspectiveFovShadowX = _shadowRender->getTech("ConvPerspectiveFovLinearDepthBlurX"); if (!_shadowBlurPerspectiveFovShadowX) return false;
 	_shadowBlurShadowY = _shadowRender->getTech("BlurY"); if (!_shadowBlurShadowY) return false;
@@ -213,6 +543,7 @@ ShadowRenderPipeline::setupShadowMaterial(RenderPipeline& pipeline) noexcept
 	_shadowLogBlurShadowY = _shadowRender->getTech("LogBlurY"); if (!_shadowLogBlurShadowY) return false;
 	_shadowShadowSource = _shadowRender->getParameter("texSource"); if (!_shadowShadowSource) return false;
 	_shadowShadowSourceInv = _shadowRender->getParameter("texSourceSizeInv"); if (!_shadowShadowSourceInv) return false;
+	_shadowShadowSourceRect = _shadowRender->getParameter("texSourceRect"); if (!_shadowShadowSourceRect) return false;
 	_shadowClipConstant = _shadowRender->getParameter("clipConstant"); if (!_shadowClipConstant) return false;
 	_shadowOffset = _shadowRender->getParameter("offset"); if (!_shadowOffset) return false;
 	_shadowWeight = _shadowRender->getParameter("weight"); if (!_shadowWeight) return false;
@@ -326,11 +657,83 @@ ShadowRenderPipeline::setupShadowSoftMaps(RenderPipeline& pipeline) noexcept
 	return true;
 }
 
+bool
+ShadowRenderPipeline::setupShadowAtlas(RenderPipeline& pipeline) noexcept
+{
+	std::uint32_t shadowMapSize[(std::uint8_t)ShadowQuality::ShadowQualityRangeSize];
+	shadowMapSize[(std::uint8_t)ShadowQuality::ShadowQualityNone] = 0;
+	shadowMapSize[(std::uint8_t)ShadowQuality::ShadowQualityLow] = LightShadowSize::LightShadowSizeLow;
+	shadowMapSize[(std::uint8_t)ShadowQuality::ShadowQualityMedium] = LightShadowSize::LightShadowSizeMedium;
+	shadowMapSize[(std::uint8_t)ShadowQuality::ShadowQualityHigh] = LightShadowSize::LightShadowSizeHigh;
+	shadowMapSize[(std::uint8_t)ShadowQuality::ShadowQualityVeryHigh] = LightShadowSize::LightShadowSizeVeryHigh;
+
+	std::uint32_t tileSize = shadowMapSize[(std::uint8_t)_shadowQuality];
+	std::uint32_t atlasSize = std::min(tileSize * ShadowAtlasTilesPerRow, ShadowAtlasMaxSize);
+
+	GraphicsFormat atlasFormat;
+	if (pipeline.isTextureSupport(GraphicsFormat::GraphicsFormatR32SFloat))
+		atlasFormat = GraphicsFormat::GraphicsFormatR32SFloat;
+	else if (pipeline.isTextureSupport(GraphicsFormat::GraphicsFormatR8G8B8A8UNorm))
+		atlasFormat = GraphicsFormat::GraphicsFormatR8G8B8A8UNorm;
+	else
+		return false;
+
+	GraphicsFramebufferLayoutDesc shadowAtlasLayoutDesc;
+	shadowAtlasLayoutDesc.addComponent(GraphicsAttachmentLayout(0, GraphicsImageLayout::GraphicsImageLayoutColorAttachmentOptimal, atlasFormat));
+	_shadowAtlasImageLayout = pipeline.createFramebufferLayout(shadowAtlasLayoutDesc);
+	if (!_shadowAtlasImageLayout)
+		return false;
+
+	GraphicsTextureDesc shadowAtlasMapDesc;
+	shadowAtlasMapDesc.setWidth(atlasSize);
+	shadowAtlasMapDesc.setHeight(atlasSize);
+	shadowAtlasMapDesc.setTexDim(GraphicsTextureDim::GraphicsTextureDim2D);
+	shadowAtlasMapDesc.setTexFormat(atlasFormat);
+	shadowAtlasMapDesc.setSamplerWrap(GraphicsSamplerWrap::GraphicsSamplerWrapClampToEdge);
+	shadowAtlasMapDesc.setSamplerFilter(GraphicsSamplerFilter::GraphicsSamplerFilterLinear, GraphicsSamplerFilter::GraphicsSamplerFilterLinear);
+	_shadowAtlasMap = pipeline.createTexture(shadowAtlasMapDesc);
+	if (!_shadowAtlasMap)
+		return false;
+
+	GraphicsFramebufferDesc shadowAtlasViewDesc;
+	shadowAtlasViewDesc.setWidth(atlasSize);
+	shadowAtlasViewDesc.setHeight(atlasSize);
+	shadowAtlasViewDesc.addColorAttachment(GraphicsAttachmentBinding(_shadowAtlasMap, 0, 0));
+	shadowAtlasViewDesc.setGraphicsFramebufferLayout(_shadowAtlasImageLayout);
+	_shadowAtlasView = pipeline.createFramebuffer(shadowAtlasViewDesc);
+	if (!_shadowAtlasView)
+		return false;
+
+	// the depth of static casters is kept per tile, without it every update draws the static casters again
+	GraphicsTextureDesc shadowStaticDepthMapDesc;
+	shadowStaticDepthMapDesc.setWidth(atlasSize);
+	shadowStaticDepthMapDesc.setHeight(atlasSize);
+	shadowStaticDepthMapDesc.setTexFormat(_shadowDepthFormat);
+	shadowStaticDepthMapDesc.setSamplerFilter(GraphicsSamplerFilter::GraphicsSamplerFilterNearest, GraphicsSamplerFilter::GraphicsSamplerFilterNearest);
+	_shadowStaticDepthMap = pipeline.createTexture(shadowStaticDepthMapDesc);
+	if (_shadowStaticDepthMap)
+	{
+		GraphicsFramebufferDesc shadowStaticDepthViewDesc;
+		shadowStaticDepthViewDesc.setWidth(atlasSize);
+		shadowStaticDepthViewDesc.setHeight(atlasSize);
+		shadowStaticDepthViewDesc.setDepthStencilAttachment(GraphicsAttachmentBinding(_shadowStaticDepthMap, 0, 0));
+		shadowStaticDepthViewDesc.setGraphicsFramebufferLayout(_shadowShadowDepthImageLayout);
+		_shadowStaticDepthView = pipeline.createFramebuffer(shadowStaticDepthViewDesc);
+	}
+
+	// with fewer than 4x4 full tiles the far cascades take tiles of half the size, otherwise the cascades of one sun fill the whole atlas
+	_shadowCascadeLevel = (atlasSize / tileSize) < 4 ? 1 : 0;
+
+	_shadowAtlas.setup(atlasSize, tileSize, tileSize >> (ShadowAtlasLevels - 1));
+	return true;
+}
+
 void
 ShadowRenderPipeline::destroyShadowMaterial() noexcept
 {
 	_shadowShadowSource.reset();
 	_shadowShadowSourceInv.reset();
+	_shadowShadowSourceRect.reset();
 	_shadowClipConstant.reset();
 	_shadowOffset.reset();
 	_shadowWeight.reset();
@@ -342,6 +745,7 @@ ShadowRenderPipeline::destroyShadowMaterial() noexcept
 	_shadowLogBlurShadowY.reset();
 	_shadowConvOrthoLinearDepth.reset();
 	_shadowConvPerspectiveFovLinearDepth.reset();
+	_shadowCopyDepth.reset();
 
 	for (std::size_t i = 0; i < (std::uint8_t)LightType::LightTypeRangeSize; i++)
 		_shadowBlurShadowX[i].reset();
@@ -361,6 +765,19 @@ ShadowRenderPipeline::destroyShadowMaps() noexcept
 	_shadowShadowDepthLinearImageLayout.reset();
 }
 
+void
+ShadowRenderPipeline::destroyShadowAtlas() noexcept
+{
+	_shadowAtlas.close();
+
+	_shadowAtlasMap.reset();
+	_shadowAtlasView.reset();
+	_shadowAtlasImageLayout.reset();
+
+	_shadowStaticDepthMap.reset();
+	_shadowStaticDepthView.reset();
+}
+
 void
 ShadowRenderPipeline::onRenderPipeline(const Camera* camera) noexcept
 {
@@ -38,6 +38,9 @@
 #define _H_SHADOW_RENDER_PIPELINE_H_
 
 #include <ray/render_pipeline_controller.h>
+#include <ray/render_setting.h>
+#include <ray/shadow_render_framebuffer.h>
+#include <ray/shadow_atlas.h>
 
 _NAME_BEGIN
 
@@ -57,17 +60,34 @@ public:
 	void setShadowQuality(ShadowQuality quality) noexcept;
 	ShadowQuality getShadowQuality() const noexcept;
 
+	void renderBegin() noexcept;
+
+	void prepareShadowMaps(const Camera& mainCamera) noexcept;
+	bool needUpdateShadowMap(const Light& light) const noexcept;
+
+	void assginShadowCascades() noexcept;
+
+	void collectStatistics(RenderStatistics& statistics) noexcept;
+
 private:
 	void renderShadowMaps(const Camera* camera) noexcept;
 	void renderShadowMap(const Light& light, RenderQueue queue) noexcept;
+	void renderShadowAtlas(const Light& light, Camera& camera) noexcept;
+	void renderShadowAtlas(const Light& light, Camera& camera, ShadowRenderFramebuffer& framebuffer) noexcept;
+
+	bool prepareShadowAtlas(const Light& light, Camera& camera, std::uint32_t size, std::uint32_t interval) noexcept;
+
+	std::uint8_t computeShadowLevel(const Camera& mainCamera, const Light& light) const noexcept;
 
 private:
 	bool setupShadowMaterial(RenderPipeline& pipeline) noexcept;
 	bool setupShadowMaps(RenderPipeline& pipeline) noexcept;
 	bool setupShadowSoftMaps(RenderPipeline& pipeline) noexcept;
+	bool setupShadowAtlas(RenderPipeline& pipeline) noexcept;
 
 	void destroyShadowMaterial() noexcept;
 	void destroyShadowMaps() noexcept;
+	void destroyShadowAtlas() noexcept;
 
 private:
 	virtual void onRenderBefore() noexcept;
@@ -79,6 +99,13 @@ private:
 	ShadowRenderPipeline& operator=(const ShadowRenderPipeline&) = delete;
 
 private:
+	struct ShadowCascadeJob
+	{
+		Camera* camera;
+		std::uint8_t cascade;
+		double time;
+	};
+
 	ShadowMode _shadowMode;
 	ShadowQuality _shadowQuality;
 
@@ -91,7 +118,9 @@ private:
 	MaterialTechPtr _shadowLogBlurShadowY;
 	MaterialTechPtr _shadowConvOrthoLinearDepth;
 	MaterialTechPtr _shadowConvPerspectiveFovLinearDepth;
+	MaterialTechPtr _shadowCopyDepth;
 	MaterialParamPtr _shadowShadowSource;
+	MaterialParamPtr _shadowShadowSourceRect;
 	MaterialParamPtr _shadowShadowSourceInv;
 	MaterialParamPtr _shadowClipConstant;
 	MaterialParamPtr _shadowOffset;
@@ -106,9 +135,30 @@ private:
 	GraphicsFramebufferLayoutPtr _shadowShadowDepthImageLayout;
 	GraphicsFramebufferLayoutPtr _shadowShadowDepthLinearImageLayout;
 
+	GraphicsTexturePtr _shadowAtlasMap;
+	GraphicsTexturePtr _shadowStaticDepthMap;
+
+	GraphicsFramebufferPtr _shadowAtlasView;
+	GraphicsFramebufferPtr _shadowStaticDepthView;
+
+	GraphicsFramebufferLayoutPtr _shadowAtlasImageLayout;
+
 	GraphicsFormat _shadowDepthFormat;
 	GraphicsFormat _shadowDepthLinearFormat;
 
+	ShadowAtlas _shadowAtlas;
+
+	std::uint8_t _shadowCascadeLevel;
+
+	std::uint32_t _frame;
+	std::uint32_t _numShadowUpdates;
+	std::uint32_t _numShadowCached;
+
+	double _shadowCascadeCullTime[LightShadowCascade::LightShadowCascadeMax];
+	double _shadowCascadeDrawTime[LightShadowCascade::LightShadowCascadeMax];
+
+	std::vector<ShadowCascadeJob> _shadowCascadeJobs;
+
 	RenderPipelinePtr _pipeline;
 };
 
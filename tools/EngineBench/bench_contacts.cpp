@@ -0,0 +1,196 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/physics_system.h>
+#include <ray/physics_shape_box.h>
+
+using namespace ray;
+
+// two boxes per column on a static floor, one floor contact and one stacking contact per column
+static const std::size_t numStacks = 2;
+static const float spacing = 1.5f;
+
+class BenchContactListener final : public PhysicsBodyListener
+{
+public:
+	BenchContactListener() noexcept
+		: calls(0)
+		, contacts(0)
+		, impulse(0.0f)
+	{
+	}
+
+	void onFetchResult() noexcept
+	{
+	}
+
+	void onCollisionEnter(const PhysicsContact contacts[], std::size_t count) noexcept
+	{
+		this->onContacts(contacts, count);
+	}
+
+	void onCollisionStay(const PhysicsContact contacts[], std::size_t count) noexcept
+	{
+		this->onContacts(contacts, count);
+	}
+
+	void onCollisionExit(const PhysicsContact contacts[], std::size_t count) noexcept
+	{
+		this->onContacts(contacts, count);
+	}
+
+	std::size_t calls;
+	std::size_t contacts;
+	float impulse;
+
+private:
+	void onContacts(const PhysicsContact contact[], std::size_t count) noexcept
+	{
+		calls++;
+		contacts += count;
+
+		for (std::size_t i = 0; i < count; i++)
+			impulse += contact[i].impulse;
+	}
+};
+
+static std::unique_ptr<PhysicsBody>
+makeBox(PhysicsShapePtr shape, const float3& position, float mass) noexcept
+{
+	float4x4 transform;
+	transform.makeTranslate(position);
+
+	auto body = std::make_unique<PhysicsBody>();
+	body->setMass(mass);
+	body->setWorldTransform(transform);
+	body->setup(shape);
+	return body;
+}
+
+int
+benchContacts(const BenchArgs& args)
+{
+	std::size_t frames = benchArg(args, 0, 100);
+	std::size_t columns = benchArg(args, 1, 50);
+
+	PhysicsSystem::instance()->open();
+
+	auto scene = PhysicsSystem::instance()->getPhysicsScene();
+	scene->setAsync(true);
+
+	auto floorShape = std::make_shared<PhysicsShapeBox>();
+	floorShape->setSize(float3(columns * spacing, 0.5f, columns * spacing));
+	floorShape->setup();
+
+	auto boxShape = std::make_shared<PhysicsShapeBox>();
+	boxShape->setSize(float3(0.5f, 0.5f, 0.5f));
+	boxShape->setup();
+
+	auto floor = makeBox(floorShape, float3(0.0f, -0.5f, 0.0f), 0.0f);
+
+	std::vector<std::unique_ptr<PhysicsBody>> boxes;
+	std::vector<std::unique_ptr<BenchContactListener>> listeners;
+
+	for (std::size_t x = 0; x < columns; x++)
+	{
+		for (std::size_t z = 0; z < columns; z++)
+		{
+			for (std::size_t y = 0; y < numStacks; y++)
+			{
+				float3 position((x - columns * 0.5f) * spacing, 0.5f + y, (z - columns * 0.5f) * spacing);
+
+				auto listener = std::make_unique<BenchContactListener>();
+				auto box = makeBox(boxShape, position, 1.0f);
+				box->setRigidbodyListener(listener.get());
+
+				boxes.push_back(std::move(box));
+				listeners.push_back(std::move(listener));
+			}
+		}
+	}
+
+	// let the stacks settle so every frame carries the same resting contacts
+	for (std::size_t frame = 0; frame < 30; frame++)
+	{
+		scene->simulation(1.0f / 60.0f);
+		scene->fetchResult();
+	}
+
+	for (auto& it : listeners)
+		it->calls = it->contacts = 0;
+
+	double stepTime = 0.0;
+	double fetchTime = 0.0;
+
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		BenchTimer stepTimer;
+		scene->simulation(1.0f / 60.0f);
+		scene->wait();
+		stepTime += stepTimer.elapsed();
+
+		BenchTimer fetchTimer;
+		scene->fetchResult();
+		fetchTime += fetchTimer.elapsed();
+	}
+
+	std::size_t calls = 0;
+	std::size_t contacts = 0;
+	float impulse = 0.0f;
+
+	for (auto& it : listeners)
+	{
+		calls += it->calls;
+		contacts += it->contacts;
+		impulse += it->impulse;
+	}
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "contacts | " << boxes.size() << " boxes in " << columns * columns << " stacks of " << numStacks << ", " << frames << " frames" << std::endl;
+	std::cout << "step + contact update " << stepTime / frames << " ms/frame"
+		<< " | fetch + dispatch " << fetchTime / frames << " ms/frame"
+		<< " | " << calls / frames << " listener calls/frame"
+		<< " | " << contacts / frames << " contacts/frame"
+		<< (impulse > 0.0f ? "" : " (no impulse)") << std::endl;
+
+	boxes.clear();
+	floor.reset();
+
+	PhysicsSystem::instance()->close();
+
+	return 0;
+}
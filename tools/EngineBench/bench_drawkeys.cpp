@@ -0,0 +1,185 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/radix_sort.h>
+
+using namespace ray;
+
+// a frame of opaque draws: a few pipelines, more materials, many meshes, each mesh bound to one material
+static const std::size_t numPipelines = 24;
+static const std::size_t numMaterials = 400;
+static const std::size_t numMeshes = 1500;
+
+struct BenchDraw
+{
+	std::uint32_t pipeline;
+	std::uint32_t material;
+	std::uint32_t mesh;
+	float distanceSqrt;
+};
+
+struct BenchDrawKey
+{
+	std::uint64_t key;
+	const BenchDraw* draw;
+};
+
+// same packing as DefaultRenderDataManager::makeRenderKey for opaque queues
+static std::uint64_t
+hashDrawKey(std::uint64_t value) noexcept
+{
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	return value & 0xFFFF;
+}
+
+static std::uint64_t
+makeDrawKey(const BenchDraw& draw, const std::uint64_t* handles) noexcept
+{
+	std::uint32_t depth;
+	std::memcpy(&depth, &draw.distanceSqrt, sizeof(depth));
+	depth &= 0x7FFFFFFF;
+
+	std::uint64_t pipelineKey = hashDrawKey(handles[draw.pipeline]);
+	std::uint64_t materialKey = hashDrawKey(handles[numPipelines + draw.material]);
+	std::uint64_t vertexKey = hashDrawKey(handles[numPipelines + numMaterials + draw.mesh]);
+
+	return pipelineKey << 48 | materialKey << 32 | vertexKey << 16 | depth >> 15;
+}
+
+template<typename Iterator>
+static std::size_t
+countStateChanges(Iterator begin, Iterator end) noexcept
+{
+	std::size_t changes = 0;
+	const BenchDraw* last = nullptr;
+
+	for (auto it = begin; it != end; ++it)
+	{
+		const BenchDraw* draw = *it;
+		if (!last || last->pipeline != draw->pipeline) changes++;
+		if (!last || last->material != draw->material) changes++;
+		if (!last || last->mesh != draw->mesh) changes++;
+		last = draw;
+	}
+
+	return changes;
+}
+
+static void
+runDrawKeys(std::size_t numDraws, std::size_t frames) noexcept
+{
+	std::mt19937 rand(1);
+	std::uniform_int_distribution<std::uint32_t> mesh(0, numMeshes - 1);
+	std::uniform_real_distribution<float> distance(1.0f, 250.0f);
+
+	std::vector<std::uint64_t> handles(numPipelines + numMaterials + numMeshes);
+	for (auto& it : handles)
+		it = 0x10000000ULL + rand() * 64ULL;
+
+	std::vector<BenchDraw> draws(numDraws);
+	for (auto& it : draws)
+	{
+		it.mesh = mesh(rand);
+		it.material = it.mesh % numMaterials;
+		it.pipeline = it.material % numPipelines;
+		it.distanceSqrt = distance(rand) * distance(rand);
+	}
+
+	std::vector<std::pair<float, const BenchDraw*>> visiable(numDraws);
+	std::vector<const BenchDraw*> oldOrder(numDraws);
+
+	BenchTimer oldTimer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		for (std::size_t i = 0; i < numDraws; i++)
+			visiable[i] = std::make_pair(draws[i].distanceSqrt, &draws[i]);
+
+		std::sort(visiable.begin(), visiable.end(), [](const std::pair<float, const BenchDraw*>& a, const std::pair<float, const BenchDraw*>& b) { return a.first < b.first; });
+
+		for (std::size_t i = 0; i < numDraws; i++)
+			oldOrder[i] = visiable[i].second;
+	}
+	double oldTime = oldTimer.elapsed();
+
+	std::vector<BenchDrawKey> keys(numDraws);
+	std::vector<BenchDrawKey> temp;
+	std::vector<const BenchDraw*> newOrder(numDraws);
+
+	BenchTimer newTimer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		for (std::size_t i = 0; i < numDraws; i++)
+			keys[i] = { makeDrawKey(draws[i], handles.data()), &draws[i] };
+
+		radixSort64(keys, temp);
+
+		for (std::size_t i = 0; i < numDraws; i++)
+			newOrder[i] = keys[i].draw;
+	}
+	double newTime = newTimer.elapsed();
+
+	BenchTimer compareTimer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		for (std::size_t i = 0; i < numDraws; i++)
+			keys[i] = { makeDrawKey(draws[i], handles.data()), &draws[i] };
+
+		std::sort(keys.begin(), keys.end(), [](const BenchDrawKey& a, const BenchDrawKey& b) { return a.key < b.key; });
+	}
+	double compareTime = compareTimer.elapsed();
+
+	std::cout << std::setw(8) << numDraws
+		<< " | distance std::sort " << std::setw(8) << oldTime / frames << " ms " << std::setw(7) << countStateChanges(oldOrder.begin(), oldOrder.end()) << " changes"
+		<< " | key radix " << std::setw(8) << newTime / frames << " ms " << std::setw(7) << countStateChanges(newOrder.begin(), newOrder.end()) << " changes"
+		<< " | key std::sort " << std::setw(8) << compareTime / frames << " ms" << std::endl;
+}
+
+int
+benchDrawKeys(const BenchArgs& args)
+{
+	std::size_t frames = benchArg(args, 0, 100);
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "   draws | " << numPipelines << " pipelines, " << numMaterials << " materials, " << numMeshes << " meshes, " << frames << " frames" << std::endl;
+
+	for (std::size_t numDraws : { 2000, 20000, 100000 })
+		runDrawKeys(numDraws, frames);
+
+	return 0;
+}
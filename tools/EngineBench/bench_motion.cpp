@@ -0,0 +1,470 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/anim.h>
+#include <ray/anim_clip.h>
+#include <ray/thread.h>
+
+using namespace ray;
+
+// a long VMD dance: every bone keyed every few frames, smooth motion, a few dozen distinct bezier curves
+static const std::size_t numBones = 200;
+static const std::size_t numCurves = 32;
+static const std::int32_t keyInterval = 3;
+
+// chains of ten bones hanging off the first two chains, a PMX skeleton is about as deep
+static std::int16_t
+makeParent(std::size_t index, std::mt19937& rand) noexcept
+{
+	if (index == 0)
+		return -1;
+	if (index % 10 == 0)
+		return (std::int16_t)(rand() % std::min<std::size_t>(index, 20));
+	return (std::int16_t)(index - 1);
+}
+
+static void
+makeMotion(AnimationProperty& property, std::int32_t numFrames, std::mt19937& rand) noexcept
+{
+	std::uniform_real_distribution<float> phase(0.0f, 6.28f);
+	std::uniform_real_distribution<float> speed(0.02f, 0.2f);
+	std::uniform_int_distribution<int> control(0, 127);
+	std::uniform_int_distribution<int> jitter(0, keyInterval - 1);
+
+	Bones bones(numBones);
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		bones[i].setName("bone" + std::to_string(i));
+		bones[i].setParent(makeParent(i, rand));
+		bones[i].setPosition(float3(0.0f, (float)i * 0.1f, 0.0f));
+	}
+
+	std::vector<Interpolation> curves(numCurves);
+	for (auto& interp : curves)
+	{
+		for (auto curve : { interp.interpX, interp.interpY, interp.interpZ, interp.interpW })
+		{
+			curve[0] = control(rand);
+			curve[1] = control(rand);
+			curve[2] = 128 + control(rand);
+			curve[3] = 128 + control(rand);
+		}
+	}
+
+	std::vector<float3> phases(numBones);
+	std::vector<float3> speeds(numBones);
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		phases[i] = float3(phase(rand), phase(rand), phase(rand));
+		speeds[i] = float3(speed(rand), speed(rand), speed(rand));
+	}
+
+	// vmd files list keys frame by frame, not bone by bone
+	for (std::int32_t frame = 0; frame < numFrames; frame += keyInterval)
+	{
+		for (std::size_t i = 0; i < numBones; i++)
+		{
+			std::int32_t key = frame == 0 ? 0 : frame + jitter(rand);
+
+			float3 wave;
+			wave.x = std::sin(phases[i].x + speeds[i].x * key);
+			wave.y = std::sin(phases[i].y + speeds[i].y * key);
+			wave.z = std::sin(phases[i].z + speeds[i].z * key);
+
+			BoneAnimation anim;
+			anim.setName(bones[i].getName());
+			anim.setFrameNo(key);
+			anim.setPosition(i == 0 ? wave * 0.5f : Vector3::Zero);
+			anim.setRotation(Quaternion(wave * 0.5f));
+			anim.setInterpolation(curves[rand() % numCurves]);
+
+			property.addBoneAnimation(anim);
+		}
+	}
+
+	property.setBoneArray(bones);
+}
+
+// the lookup updateBoneMotion did before the tracks: per bone index lists into the BoneAnimation array,
+// a binary search per sample and the bisection in BezierEval, through the kept interpolateMotion
+static void
+bindMotion(const AnimationProperty& property, std::vector<std::vector<std::size_t>>& motions) noexcept
+{
+	std::map<std::string, std::size_t> bindBoneMaps;
+	for (std::size_t i = 0; i < property.getBoneArray().size(); i++)
+		bindBoneMaps[property.getBoneArray()[i].getName()] = i;
+
+	motions.resize(property.getBoneArray().size());
+	for (std::size_t i = 0; i < property.getNumBoneAnimation(); i++)
+		motions[bindBoneMaps[property.getBoneAnimation(i).getName()]].push_back(i);
+
+	for (auto& it : motions)
+		std::stable_sort(it.begin(), it.end(), [&](std::size_t a, std::size_t b) { return property.getBoneAnimation(a).getFrameNo() < property.getBoneAnimation(b).getFrameNo(); });
+}
+
+static float
+searchMotion(AnimationProperty& property, std::vector<std::vector<std::size_t>>& motions, std::size_t frame) noexcept
+{
+	auto& bones = property.getBoneArray();
+	auto& pose = property.getPose();
+
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		Vector3 position;
+		Quaternion rotation;
+		property.interpolateMotion(rotation, position, motions[i], frame);
+
+		if (bones[i].getParent() == -1)
+			pose->setLocalTransform(i, bones[i].getPosition() + position, rotation);
+		else
+			pose->setLocalTransform(i, bones[i].getPosition() + position - bones[bones[i].getParent()].getPosition(), rotation);
+	}
+
+	return pose->getLocalRotation(numBones - 1).w;
+}
+
+static float
+cursorMotion(AnimationProperty& property, std::size_t frame) noexcept
+{
+	property.setCurrentFrame(frame);
+	property.updateBoneMotion();
+	return property.getPose()->getLocalRotation(numBones - 1).w;
+}
+
+static void
+runMotion(std::int32_t numFrames, std::size_t seeks) noexcept
+{
+	std::mt19937 rand(1);
+
+	AnimationProperty property;
+	makeMotion(property, numFrames, rand);
+
+	std::vector<std::vector<std::size_t>> motions;
+	bindMotion(property, motions);
+
+	std::vector<std::size_t> seekFrames(seeks);
+	for (auto& it : seekFrames)
+		it = rand() % numFrames;
+
+	float checksum = 0.0f;
+
+	BenchTimer searchTimer;
+	for (std::int32_t frame = 0; frame < numFrames; frame++)
+		checksum += searchMotion(property, motions, frame);
+	double searchTime = searchTimer.elapsed();
+
+	BenchTimer cursorTimer;
+	for (std::int32_t frame = 0; frame < numFrames; frame++)
+		checksum += cursorMotion(property, frame);
+	double cursorTime = cursorTimer.elapsed();
+
+	BenchTimer searchSeekTimer;
+	for (auto frame : seekFrames)
+		checksum += searchMotion(property, motions, frame);
+	double searchSeekTime = searchSeekTimer.elapsed();
+
+	BenchTimer cursorSeekTimer;
+	for (auto frame : seekFrames)
+		checksum += cursorMotion(property, frame);
+	double cursorSeekTime = cursorSeekTimer.elapsed();
+
+	std::cout << std::setw(7) << numFrames << std::setw(9) << property.getNumBoneAnimation()
+		<< " | play: search " << std::setw(7) << searchTime * 1000.0 / numFrames << " us"
+		<< " cursor " << std::setw(7) << cursorTime * 1000.0 / numFrames << " us"
+		<< " | seek: search " << std::setw(7) << searchSeekTime * 1000.0 / seeks << " us"
+		<< " cursor " << std::setw(7) << cursorSeekTime * 1000.0 / seeks << " us"
+		<< (checksum == 0.0f ? " (no work)" : "") << std::endl;
+}
+
+static void
+samplePose(AnimationProperty& property, std::int32_t frame, std::vector<float3>& translates, std::vector<Quaternion>& rotations) noexcept
+{
+	property.setCurrentFrame(frame);
+	property.updateBoneMotion();
+
+	auto& pose = property.getPose();
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		translates[i] = pose->getLocalTranslate(i);
+		rotations[i] = pose->getLocalRotation(i);
+	}
+}
+
+static void
+runClip(std::int32_t numFrames, std::size_t seeks) noexcept
+{
+	std::mt19937 rand(1);
+
+	AnimationProperty property;
+	makeMotion(property, numFrames, rand);
+
+	BenchTimer buildTimer;
+	auto clip = std::make_shared<AnimationClip>();
+	clip->build(property);
+	double buildTime = buildTimer.elapsed();
+
+	AnimationProperty clipProperty;
+	clipProperty.setBoneArray(property.getBoneArray());
+	clipProperty.setClip(clip);
+
+	// what stays resident for the raw path: the loaded BoneAnimation array plus the MotionKey tracks bound from it
+	float duration = numFrames / 30.0f;
+	std::size_t rawSize = property.getNumBoneAnimation() * (sizeof(BoneAnimation) + sizeof(MotionKey));
+	float rawBytes = rawSize / (numBones * duration);
+
+	std::vector<std::size_t> seekFrames(seeks);
+	for (auto& it : seekFrames)
+		it = rand() % numFrames;
+
+	std::vector<float3> rawTranslates(numBones), clipTranslates(numBones);
+	std::vector<Quaternion> rawRotations(numBones), clipRotations(numBones);
+
+	float positionError = 0.0f;
+	float rotationError = 0.0f;
+
+	for (std::int32_t frame = 0; frame < numFrames; frame++)
+	{
+		samplePose(property, frame, rawTranslates, rawRotations);
+		samplePose(clipProperty, frame, clipTranslates, clipRotations);
+
+		for (std::size_t i = 0; i < numBones; i++)
+		{
+			positionError = std::max(positionError, math::distance(rawTranslates[i], clipTranslates[i]));
+			rotationError = std::max(rotationError, 1.0f - std::fabs(math::dot(rawRotations[i], clipRotations[i])));
+		}
+	}
+
+	float checksum = 0.0f;
+
+	BenchTimer rawTimer;
+	for (std::int32_t frame = 0; frame < numFrames; frame++)
+		checksum += cursorMotion(property, frame);
+	double rawTime = rawTimer.elapsed();
+
+	BenchTimer rawSeekTimer;
+	for (auto frame : seekFrames)
+		checksum += cursorMotion(property, frame);
+	double rawSeekTime = rawSeekTimer.elapsed();
+
+	BenchTimer clipTimer;
+	for (std::int32_t frame = 0; frame < numFrames; frame++)
+		checksum += cursorMotion(clipProperty, frame);
+	double clipTime = clipTimer.elapsed();
+
+	BenchTimer clipSeekTimer;
+	for (auto frame : seekFrames)
+		checksum += cursorMotion(clipProperty, frame);
+	double clipSeekTime = clipSeekTimer.elapsed();
+
+	std::cout << std::setw(7) << numFrames
+		<< " | keys " << std::setw(8) << property.getNumBoneAnimation() << " -> " << std::setw(7) << clip->getNumKeys()
+		<< " | bytes/bone-s " << std::setw(7) << rawBytes << " -> " << std::setw(6) << clip->getBytesPerBoneSecond()
+		<< " | play " << std::setw(6) << rawTime * 1000.0 / numFrames << " -> " << std::setw(6) << clipTime * 1000.0 / numFrames << " us"
+		<< " | seek " << std::setw(6) << rawSeekTime * 1000.0 / seeks << " -> " << std::setw(6) << clipSeekTime * 1000.0 / seeks << " us"
+		<< " | build " << std::setw(7) << buildTime << " ms"
+		<< std::scientific << " | error " << positionError << " " << rotationError << std::fixed
+		<< (checksum == 0.0f ? " (no work)" : "") << std::endl;
+}
+
+// leg style ik: the end of one chain reaching for the end of another through the two bones above it
+static void
+makeIK(InverseKinematics& iks) noexcept
+{
+	for (std::size_t i = 0; i < 4; i++)
+	{
+		IKAttr ik;
+		ik.boneIndex = (std::uint16_t)(10 * (i + 6) + 9);
+		ik.targetBoneIndex = (std::uint16_t)(10 * (i + 2) + 9);
+		ik.iterations = 40;
+		ik.chainLength = 2;
+
+		for (std::size_t j = 1; j <= ik.chainLength; j++)
+		{
+			IKChild child;
+			child.boneIndex = ik.targetBoneIndex - j;
+			child.rotateLimited = 0;
+			child.angleWeight = 0.5f;
+			child.minimumDegrees = float3::Zero;
+			child.maximumDegrees = float3::Zero;
+			ik.child.push_back(child);
+		}
+
+		iks.push_back(ik);
+	}
+}
+
+struct BenchAnimation
+{
+	AnimationProperty property;
+	std::vector<float4x4> bindposes;
+	std::vector<float4x4> palette;
+	AABB aabb;
+};
+
+// what AnimationManager hands each worker: advance and sample the clip, solve ik, then build the skinning palette
+static void
+updateAnimation(BenchAnimation& animation) noexcept
+{
+	animation.property.updateFrame(1.0f / 30.0f);
+	animation.property.updateMotion();
+
+	auto& transforms = animation.property.getPose()->getWorldTransforms();
+
+	AABB aabb;
+	for (std::size_t i = 0; i < transforms.size(); i++)
+	{
+		animation.palette[i] = math::transformMultiply(transforms[i], animation.bindposes[i]);
+		aabb.encapsulate(transforms[i].getTranslate());
+	}
+
+	animation.aabb = aabb;
+}
+
+static void
+runAnimThreads(std::size_t numCharacters, std::size_t threads, std::size_t frames, double& serialTime) noexcept
+{
+	std::mt19937 rand(1);
+
+	AnimationProperty source;
+	makeMotion(source, 1800, rand);
+
+	auto clip = std::make_shared<AnimationClip>();
+	clip->build(source);
+
+	InverseKinematics iks;
+	makeIK(iks);
+
+	std::vector<std::unique_ptr<BenchAnimation>> animations;
+	for (std::size_t i = 0; i < numCharacters; i++)
+	{
+		auto animation = std::make_unique<BenchAnimation>();
+		animation->property.setBoneArray(source.getBoneArray());
+		animation->property.setIKArray(iks);
+		animation->property.setClip(clip);
+		animation->property.setCurrentFrame(rand() % 1800);
+
+		animation->bindposes.resize(numBones);
+		for (std::size_t j = 0; j < numBones; j++)
+			animation->bindposes[j].makeTranslate(-source.getBoneArray()[j].getPosition());
+
+		animation->palette.resize(numBones);
+		animations.push_back(std::move(animation));
+	}
+
+	ThreadPool::instance()->stop();
+	if (threads > 1)
+		ThreadPool::instance()->start(threads - 1);
+
+	ThreadTaskGroup group;
+
+	BenchTimer timer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		if (threads > 1)
+		{
+			ThreadPool::instance()->exce(group, animations.size(), [&](std::size_t i) { updateAnimation(*animations[i]); });
+			ThreadPool::instance()->wait(group);
+		}
+		else
+		{
+			for (auto& it : animations)
+				updateAnimation(*it);
+		}
+	}
+	double time = timer.elapsed();
+
+	ThreadPool::instance()->stop();
+
+	if (threads == 1)
+		serialTime = time;
+
+	bool empty = false;
+	for (auto& it : animations)
+		empty |= it->aabb.empty();
+
+	std::cout << std::setw(7) << threads
+		<< " | " << std::setw(7) << time / frames << " ms/frame"
+		<< " | " << std::setw(7) << numCharacters * frames / time << " chars/ms"
+		<< " | speedup " << std::setw(5) << serialTime / time
+		<< (empty ? " (no work)" : "") << std::endl;
+}
+
+int
+benchMotion(const BenchArgs& args)
+{
+	std::size_t seeks = benchArg(args, 0, 1000);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << " frames     keys | updateBoneMotion per frame, " << numBones << " bones, " << seeks << " random seeks" << std::endl;
+
+	for (std::int32_t numFrames : { 1800, 9000, 27000 })
+		runMotion(numFrames, seeks);
+
+	return 0;
+}
+
+int
+benchClips(const BenchArgs& args)
+{
+	std::size_t seeks = benchArg(args, 0, 1000);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << " frames | raw AnimationProperty -> AnimationClip, " << numBones << " bones at 30 fps, updateBoneMotion per frame, " << seeks << " random seeks" << std::endl;
+
+	for (std::int32_t numFrames : { 1800, 9000, 27000 })
+		runClip(numFrames, seeks);
+
+	return 0;
+}
+
+int
+benchAnimThreads(const BenchArgs& args)
+{
+	std::size_t frames = benchArg(args, 0, 100);
+	std::size_t maxThreads = benchArg(args, 1, std::max(4u, std::thread::hardware_concurrency()));
+	std::size_t numCharacters = 100;
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "threads | " << numCharacters << " characters, " << numBones << " bones, 4 ik chains, clip sampling + ik + palette, "
+		<< frames << " frames, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+	double serialTime = 0.0;
+	for (std::size_t threads = 1; threads <= maxThreads; threads++)
+		runAnimThreads(numCharacters, threads, frames, serialTime);
+
+	return 0;
+}
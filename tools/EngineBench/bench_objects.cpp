@@ -0,0 +1,175 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/game_object.h>
+#include <ray/game_object_manager.h>
+#include <ray/mesh_component.h>
+
+using namespace ray;
+
+class BenchTagComponent final : public GameComponent
+{
+	__DeclareSubClass(BenchTagComponent, GameComponent)
+public:
+	GameComponentPtr clone() const noexcept
+	{
+		return std::make_shared<BenchTagComponent>();
+	}
+};
+
+__ImplementSubClass(BenchTagComponent, GameComponent, "BenchTag")
+
+// every object is tagged, one in sixteen also carries a mesh
+static const std::size_t meshInterval = 16;
+
+// GameObjectManager::findObject before the name index
+static GameObject*
+scanObject(const std::vector<GameObject*>& instances, const util::string& name) noexcept
+{
+	for (auto& it : instances)
+	{
+		if (!it)
+			continue;
+
+		if (it->getName() == name)
+			return it;
+	}
+
+	return nullptr;
+}
+
+// gathering a type before the component index meant walking every object
+static void
+scanComponents(const std::vector<GameObject*>& instances, const rtti::Rtti& type, std::vector<GameComponent*>& components) noexcept
+{
+	for (auto& it : instances)
+	{
+		if (!it)
+			continue;
+
+		for (auto& component : it->getComponents())
+		{
+			if (component->isA(type))
+				components.push_back(component.get());
+		}
+	}
+}
+
+static void
+runObjects(std::size_t numObjects, std::size_t lookups) noexcept
+{
+	std::mt19937 rand(1);
+
+	GameObjects objects;
+	std::vector<GameObject*> instances;
+
+	for (std::size_t i = 0; i < numObjects; i++)
+	{
+		auto object = std::make_shared<GameObject>();
+		object->setName("object" + std::to_string(i));
+		object->addComponent(std::make_shared<BenchTagComponent>());
+
+		if (i % meshInterval == 0)
+			object->addComponent(std::make_shared<MeshComponent>());
+
+		instances.push_back(object.get());
+		objects.push_back(std::move(object));
+	}
+
+	// one in ten names misses, which is the worst case for the scan
+	std::vector<util::string> names(lookups);
+	for (auto& it : names)
+		it = "object" + std::to_string(rand() % (numObjects + numObjects / 9));
+
+	std::size_t found = 0;
+
+	BenchTimer scanTimer;
+	for (auto& it : names)
+		found += scanObject(instances, it) ? 1 : 0;
+	double scanTime = scanTimer.elapsed();
+
+	BenchTimer indexTimer;
+	for (auto& it : names)
+		found += GameObjectManager::instance()->findObject(it) ? 1 : 0;
+	double indexTime = indexTimer.elapsed();
+
+	std::size_t queries = std::max<std::size_t>(1, lookups / 100);
+	std::vector<GameComponent*> components;
+	std::vector<MeshComponent*> meshes;
+
+	BenchTimer scanTypeTimer;
+	for (std::size_t i = 0; i < queries; i++)
+	{
+		components.clear();
+		scanComponents(instances, MeshComponent::RTTI, components);
+	}
+	double scanTypeTime = scanTypeTimer.elapsed();
+
+	BenchTimer indexTypeTimer;
+	for (std::size_t i = 0; i < queries; i++)
+	{
+		meshes.clear();
+		GameObjectManager::instance()->getComponents(meshes);
+	}
+	double indexTypeTime = indexTypeTimer.elapsed();
+
+	BenchTimer exactTypeTimer;
+	for (std::size_t i = 0; i < queries; i++)
+		found += GameObjectManager::instance()->getComponentsExact(MeshComponent::RTTI).size();
+	double exactTypeTime = exactTypeTimer.elapsed();
+
+	std::cout << std::setw(7) << numObjects
+		<< " | names " << std::setw(10) << lookups / scanTime << " -> " << std::setw(10) << lookups / indexTime << " /ms"
+		<< " | types " << std::setw(8) << queries / scanTypeTime << " -> " << std::setw(8) << queries / indexTypeTime
+		<< " (exact " << std::setw(9) << queries / exactTypeTime << ") /ms"
+		<< " | found " << found + components.size() + meshes.size() << std::endl;
+}
+
+int
+benchObjects(const BenchArgs& args)
+{
+	std::size_t lookups = benchArg(args, 0, 2000);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "objects | findObject scan -> name index, " << lookups << " lookups"
+		<< " | MeshComponent gather scan -> type index, " << std::max<std::size_t>(1, lookups / 100) << " queries" << std::endl;
+
+	for (std::size_t numObjects : { 1000, 10000, 100000 })
+		runObjects(numObjects, lookups);
+
+	return 0;
+}
@@ -0,0 +1,236 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/anim_pose.h>
+#include <ray/game_object.h>
+
+using namespace ray;
+
+// a PMX sized skeleton: mostly chains, with some branches off earlier bones
+static const std::size_t numBones = 200;
+
+struct BenchCharacter
+{
+	Bones bones;
+	GameObjects transforms;
+	AnimationPose pose;
+	std::vector<float4x4> bindposes;
+	std::vector<float4x4> palette;
+};
+
+static void
+makeCharacter(BenchCharacter& character, std::mt19937& rand) noexcept
+{
+	std::uniform_real_distribution<float> offset(-0.5f, 0.5f);
+	std::uniform_real_distribution<float> branch(0.0f, 1.0f);
+
+	character.bones.resize(numBones);
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		std::int16_t parent = -1;
+		if (i > 0)
+			parent = branch(rand) < 0.8f ? (std::int16_t)(i - 1) : (std::int16_t)(rand() % i);
+
+		float3 position(offset(rand), offset(rand) + 1.0f, offset(rand));
+		if (parent != -1)
+			position += character.bones[parent].getPosition();
+
+		character.bones[i].setParent(parent);
+		character.bones[i].setPosition(position);
+	}
+
+	for (auto& it : character.bones)
+	{
+		auto bone = std::make_shared<GameObject>();
+		bone->setWorldTranslate(it.getPosition());
+		bone->setActive(true);
+		character.transforms.push_back(std::move(bone));
+	}
+
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		if (character.bones[i].getParent() != -1)
+			character.transforms[i]->setParent(character.transforms[character.bones[i].getParent()]);
+	}
+
+	character.pose.setBoneArray(character.bones);
+
+	character.bindposes.resize(numBones);
+	for (std::size_t i = 0; i < numBones; i++)
+		character.bindposes[i].makeTranslate(-character.bones[i].getPosition());
+
+	character.palette.resize(numBones);
+}
+
+static float3
+getLocalTranslate(const Bones& bones, std::size_t index) noexcept
+{
+	auto& bone = bones[index];
+	if (bone.getParent() == -1)
+		return bone.getPosition();
+	return bone.getPosition() - bones[bone.getParent()].getPosition();
+}
+
+// the path the pose buffer replaced: local matrices on each Bone, a world pass over the Bone array,
+// one setWorldTransformOnlyRotate per bone GameObject, and the renderer reading the GameObjects back
+static void
+animateBones(BenchCharacter& character, const std::vector<Quaternion>& rotations, AABB& aabb) noexcept
+{
+	auto& bones = character.bones;
+
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		float4x4 transform;
+		transform.makeRotate(rotations[i]);
+		transform.setTranslate(getLocalTranslate(bones, i));
+
+		bones[i].setRotation(rotations[i]);
+		bones[i].setLocalTransform(transform);
+	}
+
+	for (std::size_t i = 0; i < numBones; i++)
+	{
+		std::int16_t parent = bones[i].getParent();
+		if (parent == -1)
+			bones[i].setTransform(bones[i].getLocalTransform());
+		else
+			bones[i].setTransform(math::transformMultiply(bones[parent].getTransform(), bones[i].getLocalTransform()));
+	}
+
+	for (std::size_t i = 0; i < numBones; i++)
+		character.transforms[i]->setWorldTransformOnlyRotate(bones[i].getTransform());
+
+	for (std::size_t i = 0; i < numBones; i++)
+		character.palette[i] = math::transformMultiply(character.transforms[i]->getWorldTransform(), character.bindposes[i]);
+
+	for (auto& it : character.transforms)
+		aabb.encapsulate(it->getWorldTranslate());
+}
+
+static void
+animatePose(BenchCharacter& character, const std::vector<Quaternion>& rotations, AABB& aabb, bool sync) noexcept
+{
+	auto& pose = character.pose;
+
+	for (std::size_t i = 0; i < numBones; i++)
+		pose.setLocalTransform(i, getLocalTranslate(character.bones, i), rotations[i]);
+
+	pose.updateWorldTransforms();
+
+	auto& transforms = pose.getWorldTransforms();
+	for (std::size_t i = 0; i < numBones; i++)
+		character.palette[i] = math::transformMultiply(transforms[i], character.bindposes[i]);
+
+	for (auto& it : transforms)
+		aabb.encapsulate(it.getTranslate());
+
+	if (sync)
+	{
+		for (std::size_t i = 0; i < numBones; i++)
+			character.transforms[i]->setWorldTransformOnlyRotate(transforms[i]);
+	}
+}
+
+static void
+runPoses(std::size_t numCharacters, std::size_t frames) noexcept
+{
+	std::mt19937 rand(1);
+	std::uniform_real_distribution<float> angle(-0.3f, 0.3f);
+
+	std::vector<std::unique_ptr<BenchCharacter>> characters;
+	for (std::size_t i = 0; i < numCharacters; i++)
+	{
+		characters.push_back(std::make_unique<BenchCharacter>());
+		makeCharacter(*characters.back(), rand);
+	}
+
+	// keyframe sampling is the same on both paths, so every frame reuses a precomputed set of rotations
+	std::vector<std::vector<Quaternion>> rotations(8, std::vector<Quaternion>(numBones));
+	for (auto& frame : rotations)
+	{
+		for (auto& it : frame)
+			it.makeRotate(float3(angle(rand), angle(rand), angle(rand)));
+	}
+
+	AABB boneAABB, poseAABB, syncAABB;
+
+	BenchTimer boneTimer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		for (auto& it : characters)
+			animateBones(*it, rotations[frame & 7], boneAABB);
+	}
+	double boneTime = boneTimer.elapsed();
+
+	BenchTimer poseTimer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		for (auto& it : characters)
+			animatePose(*it, rotations[frame & 7], poseAABB, false);
+	}
+	double poseTime = poseTimer.elapsed();
+
+	BenchTimer syncTimer;
+	for (std::size_t frame = 0; frame < frames; frame++)
+	{
+		for (auto& it : characters)
+			animatePose(*it, rotations[frame & 7], syncAABB, true);
+	}
+	double syncTime = syncTimer.elapsed();
+
+	std::size_t updates = numCharacters * frames;
+
+	std::cout << std::setw(10) << numCharacters
+		<< " | bone objects " << std::setw(8) << updates / boneTime << " chars/ms"
+		<< " | pose " << std::setw(8) << updates / poseTime << " chars/ms"
+		<< " | pose + proxy sync " << std::setw(8) << updates / syncTime << " chars/ms"
+		<< (boneAABB.empty() || poseAABB.empty() || syncAABB.empty() ? " (no work)" : "") << std::endl;
+}
+
+int
+benchPoses(const BenchArgs& args)
+{
+	std::size_t frames = benchArg(args, 0, 100);
+
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "characters | " << numBones << " bones each, " << frames << " frames" << std::endl;
+
+	for (std::size_t numCharacters : { 10, 40, 160 })
+		runPoses(numCharacters, frames);
+
+	return 0;
+}
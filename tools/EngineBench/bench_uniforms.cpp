@@ -0,0 +1,149 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/graphics_variant.h>
+#include <ray/material_param.h>
+
+using namespace ray;
+
+// the old heap backed variants are gone from the tree, so this mode only times the current classes;
+// build it at the parent of the inline storage change to get the before numbers
+static const std::size_t rounds = 5;
+
+template<typename T>
+static double
+runSteady(std::vector<T>& variants, std::size_t frames, const float4x4& value) noexcept
+{
+	double best = 0.0;
+
+	for (std::size_t round = 0; round < rounds; round++)
+	{
+		BenchTimer timer;
+		for (std::size_t frame = 0; frame < frames; frame++)
+		{
+			for (auto& it : variants)
+				it.uniform4fmat(value);
+		}
+
+		double time = timer.elapsed();
+		if (round == 0 || time < best)
+			best = time;
+	}
+
+	return best;
+}
+
+template<typename T>
+static double
+runRetype(std::vector<T>& variants, std::size_t frames, const float4x4& value) noexcept
+{
+	double best = 0.0;
+
+	for (std::size_t round = 0; round < rounds; round++)
+	{
+		BenchTimer timer;
+		for (std::size_t frame = 0; frame < frames; frame++)
+		{
+			for (auto& it : variants)
+			{
+				it.setType(GraphicsUniformType::GraphicsUniformTypeFloat4);
+				it.uniform4f(float4(value.a1, value.a2, value.a3, value.a4));
+				it.setType(GraphicsUniformType::GraphicsUniformTypeFloat4x4);
+				it.uniform4fmat(value);
+			}
+		}
+
+		double time = timer.elapsed();
+		if (round == 0 || time < best)
+			best = time;
+	}
+
+	return best;
+}
+
+static void
+printRate(const char* name, std::size_t updates, double time) noexcept
+{
+	std::cout << " | " << name << " " << std::setw(7) << updates / (time * 1000.0) << " M/s";
+}
+
+static void
+runUniforms(std::size_t numParams, std::size_t frames) noexcept
+{
+	float4x4 value;
+	value.makeTranslate(0.5f, 1.0f, 2.0f);
+
+	std::vector<GraphicsVariant> variants(numParams);
+	for (auto& it : variants)
+		it.setType(GraphicsUniformType::GraphicsUniformTypeFloat4x4);
+
+	std::vector<MaterialParam> params(numParams);
+	for (auto& it : params)
+		it.setType(GraphicsUniformType::GraphicsUniformTypeFloat4x4);
+
+	double variantTime = runSteady(variants, frames, value);
+	double paramTime = runSteady(params, frames, value);
+	double variantRetypeTime = runRetype(variants, frames, value);
+	double paramRetypeTime = runRetype(params, frames, value);
+
+	float checksum = 0.0f;
+	for (auto& it : variants)
+		checksum += it.getFloat4x4().d1;
+
+	std::size_t updates = numParams * frames;
+
+	std::cout << std::setw(8) << numParams;
+	printRate("GraphicsVariant", updates, variantTime);
+	printRate("MaterialParam", updates, paramTime);
+	printRate("GraphicsVariant retype", updates, variantRetypeTime);
+	printRate("MaterialParam retype", updates, paramRetypeTime);
+	std::cout << (checksum == 0.0f ? " (no work)" : "") << std::endl;
+}
+
+int
+benchUniforms(const BenchArgs& args)
+{
+	std::size_t frames = benchArg(args, 0, 100);
+
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "  params | uniform4fmat updates, best of " << rounds << " x " << frames << " frames" << std::endl;
+
+	for (std::size_t numParams : { 1000, 10000, 100000 })
+		runUniforms(numParams, frames);
+
+	return 0;
+}
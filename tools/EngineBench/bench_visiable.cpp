@@ -0,0 +1,160 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <ray/aabb_tree.h>
+
+using namespace ray;
+
+// objects keep the same density at every count, so the fraction inside the frustum stays comparable
+static const float objectsPerUnit = 0.0005f;
+static const float objectSize = 2.0f;
+
+static std::size_t
+scanVisiable(const std::vector<AABB>& bounds, const Frustum& fru) noexcept
+{
+	std::size_t count = 0;
+	for (auto& it : bounds)
+	{
+		if (fru.contains(it))
+			count++;
+	}
+
+	return count;
+}
+
+static std::size_t
+treeVisiable(const AABBTree<std::uint32_t>& tree, const std::vector<AABB>& bounds, const Frustum& fru) noexcept
+{
+	std::size_t count = 0;
+	tree.query(fru, [&](std::uint32_t index)
+	{
+		if (fru.contains(bounds[index]))
+			count++;
+	});
+
+	return count;
+}
+
+static void
+runVisiable(std::size_t numObjects, std::size_t frames, float cameraFar) noexcept
+{
+	std::mt19937 rand(1);
+
+	float extent = std::cbrt(numObjects / objectsPerUnit) * 0.5f;
+	std::uniform_real_distribution<float> position(-extent, extent);
+	std::uniform_real_distribution<float> size(objectSize * 0.25f, objectSize);
+
+	std::vector<AABB> bounds(numObjects);
+	for (auto& it : bounds)
+	{
+		float3 center(position(rand), position(rand), position(rand));
+		float3 half(size(rand), size(rand), size(rand));
+		it = AABB(center - half, center + half);
+	}
+
+	AABBTree<std::uint32_t> tree;
+
+	BenchTimer buildTimer;
+	for (std::size_t i = 0; i < numObjects; i++)
+		tree.createProxy(bounds[i], static_cast<std::uint32_t>(i));
+	double buildTime = buildTimer.elapsed();
+
+	std::vector<Frustum> frustums(frames);
+	for (auto& it : frustums)
+	{
+		float3 eye(position(rand), position(rand), position(rand));
+		float3 lookat(position(rand), position(rand), position(rand));
+
+		float4x4 view;
+		view.makeLookAt_lh(eye, lookat, float3::UnitY);
+
+		float4x4 project;
+		project.makePerspective_fov_lh(60.0f, 16.0f / 9.0f, 0.1f, cameraFar);
+
+		it.extract(project * view);
+	}
+
+	std::size_t scanCount = 0;
+	BenchTimer scanTimer;
+	for (auto& it : frustums)
+		scanCount += scanVisiable(bounds, it);
+	double scanTime = scanTimer.elapsed();
+
+	std::size_t treeCount = 0;
+	BenchTimer treeTimer;
+	for (auto& it : frustums)
+		treeCount += treeVisiable(tree, bounds, it);
+	double treeTime = treeTimer.elapsed();
+
+	// every object drifts a little each frame, most stay inside their fat box
+	std::uniform_real_distribution<float> drift(-0.05f, 0.05f);
+
+	BenchTimer moveTimer;
+	for (std::size_t i = 0; i < numObjects; i++)
+	{
+		float3 offset(drift(rand), drift(rand), drift(rand));
+		bounds[i] += offset;
+		tree.moveProxy(static_cast<AABBTree<std::uint32_t>::proxy_type>(i), bounds[i]);
+	}
+	double moveTime = moveTimer.elapsed();
+
+	double culled = double(numObjects) * frames;
+
+	std::cout << std::setw(8) << numObjects << std::setw(6) << (int)cameraFar
+		<< " | scan " << std::setw(9) << scanTime / frames << " ms " << std::setw(8) << culled / scanTime / 1000.0 << " Mobj/s"
+		<< " | tree " << std::setw(9) << treeTime / frames << " ms " << std::setw(8) << culled / treeTime / 1000.0 << " Mobj/s"
+		<< " | build " << std::setw(8) << buildTime << " ms | move all " << std::setw(8) << moveTime << " ms"
+		<< " | visiable " << scanCount / frames << (scanCount == treeCount ? "" : " MISMATCH") << std::endl;
+}
+
+int
+benchVisiable(const BenchArgs& args)
+{
+	std::size_t frames = benchArg(args, 0, 100);
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << " objects   far | linear scan per frustum            | AABB tree per frustum              | " << frames << " frustums" << std::endl;
+
+	// a main view and a short range camera such as a spot light shadow or a light probe face
+	for (float cameraFar : { 250.0f, 50.0f })
+	{
+		for (std::size_t numObjects : { 1000, 10000, 100000 })
+			runVisiable(numObjects, frames, cameraFar);
+	}
+
+	return 0;
+}
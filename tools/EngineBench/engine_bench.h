@@ -0,0 +1,86 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef _H_ENGINE_BENCH_H_
+#define _H_ENGINE_BENCH_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+typedef std::vector<std::string> BenchArgs;
+
+// every mode compares the current code path against the one it replaced, in the same process
+int benchVisiable(const BenchArgs& args);
+int benchDrawKeys(const BenchArgs& args);
+int benchUniforms(const BenchArgs& args);
+int benchPoses(const BenchArgs& args);
+int benchMotion(const BenchArgs& args);
+int benchClips(const BenchArgs& args);
+int benchAnimThreads(const BenchArgs& args);
+int benchObjects(const BenchArgs& args);
+int benchContacts(const BenchArgs& args);
+
+class BenchTimer
+{
+public:
+	BenchTimer() noexcept
+		: _begin(std::chrono::high_resolution_clock::now())
+	{
+	}
+
+	double elapsed() const noexcept
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - _begin).count();
+	}
+
+private:
+	std::chrono::high_resolution_clock::time_point _begin;
+};
+
+inline std::size_t
+benchArg(const BenchArgs& args, std::size_t index, std::size_t value) noexcept
+{
+	if (index < args.size())
+		return std::max(1, std::atoi(args[index].c_str()));
+	return value;
+}
+
+#endif
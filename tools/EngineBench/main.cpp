@@ -0,0 +1,85 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2015.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "engine_bench.h"
+
+#include <cstring>
+
+struct BenchMode
+{
+	const char* name;
+	const char* help;
+	int(*func)(const BenchArgs& args);
+};
+
+static const BenchMode modes[] =
+{
+	{ "visiable", "visiable [frames] : AABB tree frustum culling against the linear scan at 1k, 10k and 100k objects", benchVisiable },
+	{ "drawkeys", "drawkeys [frames] : radix sorted draw keys against the distance sort, with state change counts", benchDrawKeys },
+	{ "uniforms", "uniforms [frames] : GraphicsVariant and MaterialParam uniform4fmat throughput, steady and with type changes", benchUniforms },
+	{ "poses", "poses [frames] : characters animated per ms through the pose buffer against per bone GameObjects", benchPoses },
+	{ "motion", "motion [seeks] : updateBoneMotion with track cursors and baked curves against binary search and bisection", benchMotion },
+	{ "clips", "clips [seeks] : compressed AnimationClip memory, error and decode time against the raw AnimationProperty tracks", benchClips },
+	{ "animthreads", "animthreads [frames] [threads] : 100 characters sampled, solved and skinned on 1 to N ThreadPool threads", benchAnimThreads },
+	{ "objects", "objects [lookups] : findObject and component type queries through the manager indices against a scan of every object", benchObjects },
+	{ "contacts", "contacts [frames] [columns] : physics step and contact dispatch for a field of stacked boxes", benchContacts },
+};
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: EngineBench mode [args]" << std::endl;
+		std::cout << "Times engine subsystems against the code paths they replaced." << std::endl;
+
+		for (auto& mode : modes)
+			std::cout << "  " << mode.help << std::endl;
+
+		return 1;
+	}
+
+	BenchArgs args;
+	for (int i = 2; i < argc; i++)
+		args.push_back(argv[i]);
+
+	for (auto& mode : modes)
+	{
+		if (std::strcmp(argv[1], mode.name) == 0)
+			return mode.func(args);
+	}
+
+	std::cerr << "Unknown mode : " << argv[1] << std::endl;
+	return 1;
+}
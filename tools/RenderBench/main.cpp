@@ -0,0 +1,242 @@
+// +----------------------------------------------------------------------
+// | Project : ray.
+// | All rights reserved.
+// +----------------------------------------------------------------------
+// | Copyright (c) 2013-2017.
+// +----------------------------------------------------------------------
+// | * Redistribution and use of this software in source and binary forms,
+// |   with or without modification, are permitted provided that the following
+// |   conditions are met:
+// |
+// | * Redistributions of source code must retain the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer.
+// |
+// | * Redistributions in binary form must reproduce the above
+// |   copyright notice, this list of conditions and the
+// |   following disclaimer in the documentation and/or other
+// |   materials provided with the distribution.
+// |
+// | * Neither the name of the ray team, nor the names of its
+// |   contributors may be used to endorse or promote products
+// |   derived from this software without specific prior
+// |   written permission of the ray team.
+// |
+// | THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// | "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// | LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// | A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// | OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// | SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// | LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// | DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// | THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// | (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// | OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// +----------------------------------------------------------------------
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+
+#include <ray/game_server.h>
+#include <ray/game_listener.h>
+#include <ray/ioserver.h>
+#include <ray/iointerface.h>
+#include <ray/rtti_factory.h>
+#include <ray/render_feature.h>
+#include <ray/render_system.h>
+#include <ray/graphics_command_log.h>
+
+#if defined(_BUILD_BASEGAME)
+#	include <ray/game_base_features.h>
+#endif
+
+#if defined(_BUILD_PHYSIC)
+#	include <ray/physics_features.h>
+#endif
+
+class BenchListener final : public ray::GameListener
+{
+public:
+	virtual void onMessage(const ray::util::string& message) noexcept
+	{
+		std::cerr << message << std::endl;
+	}
+};
+
+int main(int argc, char** argv)
+{
+	bool enableClusteredLighting = true;
+	bool enableInstancing = true;
+
+	std::vector<std::string> args;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--no-clustered") == 0)
+			enableClusteredLighting = false;
+		else if (std::strcmp(argv[i], "--no-instancing") == 0)
+			enableInstancing = false;
+		else
+			args.push_back(argv[i]);
+	}
+
+	if (args.empty())
+	{
+		std::cout << "Usage: RenderBench [--no-clustered] [--no-instancing] scene [frames] [log]" << std::endl;
+		std::cout << "Renders a scene on the Null graphics device and reports per-stage CPU cost." << std::endl;
+		std::cout << "--no-clustered draws point and spot lights one by one instead of the clustered pass." << std::endl;
+		std::cout << "--no-instancing loads static meshes with the per-object materials instead of the instanced ones." << std::endl;
+		return 1;
+	}
+
+	std::string scene = args[0];
+	std::uint32_t frames = args.size() > 1 ? std::max(1, std::atoi(args[1].c_str())) : 100;
+	std::string logPath = args.size() > 2 ? args[2] : "";
+
+	auto ioServer = ray::IoServer::instance();
+	ioServer->addAssign({ "bin", "" });
+	ioServer->addAssign({ "sys", "../../engine/" });
+	ioServer->addAssign({ "dlc", "../../dlc/" });
+
+	if (!ray::rtti::Factory::instance()->open())
+	{
+		std::cerr << "Could not initialize with RTTI." << std::endl;
+		return 1;
+	}
+
+	ray::IoInterface::instance()->open();
+
+	auto gameServer = ray::GameServer::instance();
+	gameServer->setGameListener(std::make_shared<BenchListener>());
+
+	if (!gameServer->open())
+		return 1;
+
+	ray::RenderSetting setting;
+	setting.deviceType = ray::GraphicsDeviceType::GraphicsDeviceTypeNull;
+	setting.swapInterval = ray::GraphicsSwapInterval::GraphicsSwapIntervalFree;
+	setting.width = 1376;
+	setting.height = 768;
+	setting.dpi_w = 1376;
+	setting.dpi_h = 768;
+	setting.enableClusteredLighting = enableClusteredLighting;
+	setting.enableInstancing = enableInstancing;
+
+#if defined(_BUILD_BASEGAME)
+	ray::GameFeaturePtr gameBaseFeature = std::make_shared<ray::GameBaseFeatures>();
+	gameServer->addFeature(gameBaseFeature);
+#endif
+#if defined(_BUILD_PHYSIC)
+	ray::GameFeaturePtr physicFeature = std::make_shared<ray::PhysicFeatures>();
+	gameServer->addFeature(physicFeature);
+#endif
+	ray::GameFeaturePtr renderFeature = std::make_shared<ray::RenderFeature>(setting);
+	gameServer->addFeature(renderFeature);
+
+	if (!gameServer->start())
+		return 1;
+
+	if (!gameServer->openScene(scene))
+	{
+		std::cerr << "Could not open scene : " << scene << std::endl;
+		return 1;
+	}
+
+	auto commandLog = ray::GraphicsCommandLog::instance();
+	commandLog->clear();
+	commandLog->setRecordEnable(!logPath.empty());
+
+	ray::RenderStatistics total;
+	double frameTime = 0.0;
+	std::uint64_t uniformUploadBytes = 0;
+	std::uint64_t uniformUploadSkips = 0;
+
+	for (std::uint32_t i = 0; i < frames; i++)
+	{
+		auto begin = std::chrono::high_resolution_clock::now();
+		gameServer->update();
+		frameTime += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - begin).count();
+
+		auto& statistics = ray::RenderSystem::instance()->getRenderStatistics();
+		total.visiableTime += statistics.visiableTime;
+		total.shadowTime += statistics.shadowTime;
+		total.lightProbeTime += statistics.lightProbeTime;
+		total.deferredTime += statistics.deferredTime;
+		total.forwardTime += statistics.forwardTime;
+		total.presentTime += statistics.presentTime;
+		total.occlusionTime += statistics.occlusionTime;
+		total.numCameras += statistics.numCameras;
+		total.drawCalls += statistics.drawCalls;
+		total.drawInstances += statistics.drawInstances;
+		total.numOccluders += statistics.numOccluders;
+		total.numOccluderTriangles += statistics.numOccluderTriangles;
+		total.numOccludees += statistics.numOccludees;
+		total.numOccluded += statistics.numOccluded;
+		total.shadowDrawCalls += statistics.shadowDrawCalls;
+		total.numShadowUpdates += statistics.numShadowUpdates;
+		total.numShadowCached += statistics.numShadowCached;
+
+		for (std::size_t j = 0; j < ray::LightShadowCascade::LightShadowCascadeMax; j++)
+		{
+			total.shadowCascadeCullTime[j] += statistics.shadowCascadeCullTime[j];
+			total.shadowCascadeDrawTime[j] += statistics.shadowCascadeDrawTime[j];
+		}
+
+		uniformUploadBytes += statistics.uniformUploadBytes;
+		uniformUploadSkips += statistics.uniformUploadSkips;
+	}
+
+	auto counter = commandLog->getCounter();
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "scene            : " << scene << std::endl;
+	std::cout << "frames           : " << frames << std::endl;
+	std::cout << "clustered lights : " << (enableClusteredLighting ? "on" : "off") << std::endl;
+	std::cout << "instancing       : " << (enableInstancing ? "on" : "off") << std::endl;
+	std::cout << "frame (ms)       : " << frameTime / frames << std::endl;
+	std::cout << "visiable (ms)    : " << total.visiableTime / frames << std::endl;
+	std::cout << "shadow (ms)      : " << total.shadowTime / frames << std::endl;
+	std::cout << "shadow draws     : " << (double)total.shadowDrawCalls / frames << std::endl;
+	std::cout << "shadow updates   : " << (double)total.numShadowUpdates / frames << std::endl;
+	std::cout << "shadow cached    : " << (double)total.numShadowCached / frames << std::endl;
+
+	for (std::size_t i = 0; i < ray::LightShadowCascade::LightShadowCascadeMax; i++)
+		std::cout << "cascade " << i << " (ms)   : " << total.shadowCascadeCullTime[i] / frames << " cull, " << total.shadowCascadeDrawTime[i] / frames << " draw" << std::endl;
+
+	std::cout << "light probe (ms) : " << total.lightProbeTime / frames << std::endl;
+	std::cout << "deferred (ms)    : " << total.deferredTime / frames << std::endl;
+	std::cout << "forward (ms)     : " << total.forwardTime / frames << std::endl;
+	std::cout << "present (ms)     : " << total.presentTime / frames << std::endl;
+	std::cout << "occlusion (ms)   : " << total.occlusionTime / frames << std::endl;
+	std::cout << "occluders        : " << (double)total.numOccluders / frames << std::endl;
+	std::cout << "occluder tris    : " << (double)total.numOccluderTriangles / frames << std::endl;
+	std::cout << "occludees        : " << (double)total.numOccludees / frames << std::endl;
+	std::cout << "occluded (%)     : " << (total.numOccludees ? 100.0 * total.numOccluded / total.numOccludees : 0.0) << std::endl;
+	std::cout << "cameras          : " << (double)total.numCameras / frames << std::endl;
+	std::cout << "draw calls       : " << (double)total.drawCalls / frames << std::endl;
+	std::cout << "draw instances   : " << (double)total.drawInstances / frames << std::endl;
+	std::cout << "primitives       : " << (double)counter.numPrimitives / frames << std::endl;
+	std::cout << "state changes    : " << (double)counter.getStateChanges() / frames << std::endl;
+	std::cout << "uniform bytes    : " << (double)uniformUploadBytes / frames << std::endl;
+	std::cout << "uniform skips    : " << (double)uniformUploadSkips / frames << std::endl;
+	std::cout << "upload bytes     : " << (double)counter.numUploadBytes / frames << std::endl;
+
+	if (!logPath.empty())
+	{
+		std::ofstream stream(logPath);
+		if (!stream)
+		{
+			std::cerr << "Failed to write file : " << logPath << std::endl;
+			return 1;
+		}
+
+		commandLog->save(stream);
+	}
+
+	gameServer->close();
+	ray::IoInterface::instance()->close();
+
+	return 0;
+}